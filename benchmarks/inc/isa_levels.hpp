@@ -0,0 +1,84 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+#if (defined(_M_IX86) || defined(_M_X64)) && !defined(_M_ARM64EC)
+#include <isa_availability.h>
+
+extern "C" {
+extern int __isa_enabled; // TRANSITION, <isa_availability.h> will declare this soon after 2026-06-09
+}
+#endif // ^^^ (defined(_M_IX86) || defined(_M_X64)) && !defined(_M_ARM64EC) ^^^
+
+// Vectorized algorithm benchmarks take the highest ISA level to dispatch to as their last argument,
+// so that a single run reports every dispatch tier side by side.
+enum isa_level : std::int64_t {
+    isa_level_sse42  = 0,
+    isa_level_avx2   = 1,
+    isa_level_avx512 = 2,
+};
+
+#if defined(_M_X64) && !defined(_M_ARM64EC)
+inline constexpr std::int64_t isa_levels[] = {isa_level_sse42, isa_level_avx2, isa_level_avx512};
+#elif defined(_M_IX86) // ^^^ x64 / x86 vvv
+inline constexpr std::int64_t isa_levels[] = {isa_level_sse42, isa_level_avx2};
+#else // ^^^ x86 / ARM64, ARM64EC vvv
+inline constexpr std::int64_t isa_levels[] = {isa_level_avx512}; // no ISA levels to choose from
+#endif // ^^^ ARM64, ARM64EC ^^^
+
+inline void isa_level_args(benchmark::Benchmark* const bm) {
+    for (const auto level : isa_levels) {
+        bm->Arg(level);
+    }
+}
+
+// Caps the ISA level used by the vectorized algorithms for the lifetime of the guard.
+// Levels that the machine doesn't support are skipped, instead of being reported as if they were a lower tier.
+class isa_level_guard {
+public:
+    isa_level_guard(benchmark::State& state, const std::int64_t level) {
+#if (defined(_M_IX86) || defined(_M_X64)) && !defined(_M_ARM64EC)
+        original_isa = __isa_enabled;
+
+        const int wanted_feature = level == isa_level_avx512 ? __ISA_AVAILABLE_AVX512
+                                 : level == isa_level_avx2   ? __ISA_AVAILABLE_AVX2
+                                                             : __ISA_AVAILABLE_SSE42;
+        if ((__isa_enabled & (1 << wanted_feature)) == 0) {
+            state.SkipWithMessage("ISA level not supported by this machine");
+            return;
+        }
+
+        if (level < isa_level_avx512) {
+            __isa_enabled &= ~(1 << __ISA_AVAILABLE_AVX512);
+        }
+
+        if (level < isa_level_avx2) {
+            __isa_enabled &= ~(1 << __ISA_AVAILABLE_AVX2);
+        }
+
+        state.SetLabel(level == isa_level_avx512 ? "AVX-512" : level == isa_level_avx2 ? "AVX2" : "SSE4.2");
+#else // ^^^ x86, x64 / ARM64, ARM64EC vvv
+        (void) state;
+        (void) level;
+#endif // ^^^ ARM64, ARM64EC ^^^
+    }
+
+    isa_level_guard(const isa_level_guard&)            = delete;
+    isa_level_guard& operator=(const isa_level_guard&) = delete;
+
+    ~isa_level_guard() {
+#if (defined(_M_IX86) || defined(_M_X64)) && !defined(_M_ARM64EC)
+        __isa_enabled = original_isa;
+#endif // ^^^ (defined(_M_IX86) || defined(_M_X64)) && !defined(_M_ARM64EC) ^^^
+    }
+
+private:
+#if (defined(_M_IX86) || defined(_M_X64)) && !defined(_M_ARM64EC)
+    int original_isa;
+#endif // ^^^ (defined(_M_IX86) || defined(_M_X64)) && !defined(_M_ARM64EC) ^^^
+};
@@ -0,0 +1,88 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+using namespace std;
+
+enum class Alg { lower_bound, upper_bound, equal_range };
+enum class Pred { less, lambda };
+
+template <class T, Alg Algorithm, Pred Predicate>
+void bm(benchmark::State& state) {
+    const auto size = static_cast<size_t>(state.range(0));
+
+    vector<T> v(size);
+    vector<T> keys(1024);
+
+    mt19937_64 gen(84710);
+
+    if constexpr (is_floating_point_v<T>) {
+        normal_distribution<T> dis(0, 100000.0);
+        ranges::generate(v, [&] { return dis(gen); });
+        ranges::generate(keys, [&] { return dis(gen); });
+    } else {
+        uniform_int_distribution<conditional_t<sizeof(T) != 1, T, int>> dis(0, static_cast<T>(-1));
+        ranges::generate(v, [&] { return static_cast<T>(dis(gen)); });
+        ranges::generate(keys, [&] { return static_cast<T>(dis(gen)); });
+    }
+
+    ranges::sort(v);
+
+    // Not recognized as less<>, so not vectorized; the baseline
+    const auto pred = [](const T& left, const T& right) { return left < right; };
+
+    for (auto _ : state) {
+        for (const auto& key : keys) {
+            benchmark::DoNotOptimize(v);
+            if constexpr (Algorithm == Alg::lower_bound) {
+                if constexpr (Predicate == Pred::less) {
+                    benchmark::DoNotOptimize(lower_bound(v.begin(), v.end(), key));
+                } else {
+                    benchmark::DoNotOptimize(lower_bound(v.begin(), v.end(), key, pred));
+                }
+            } else if constexpr (Algorithm == Alg::upper_bound) {
+                if constexpr (Predicate == Pred::less) {
+                    benchmark::DoNotOptimize(upper_bound(v.begin(), v.end(), key));
+                } else {
+                    benchmark::DoNotOptimize(upper_bound(v.begin(), v.end(), key, pred));
+                }
+            } else {
+                if constexpr (Predicate == Pred::less) {
+                    benchmark::DoNotOptimize(equal_range(v.begin(), v.end(), key));
+                } else {
+                    benchmark::DoNotOptimize(equal_range(v.begin(), v.end(), key, pred));
+                }
+            }
+        }
+    }
+}
+
+void common_args(benchmark::Benchmark* const bm) {
+    bm->Arg(40)->Arg(8021)->Arg(3'000'000);
+}
+
+BENCHMARK(bm<uint8_t, Alg::lower_bound, Pred::less>)->Apply(common_args);
+BENCHMARK(bm<uint8_t, Alg::lower_bound, Pred::lambda>)->Apply(common_args);
+BENCHMARK(bm<uint32_t, Alg::lower_bound, Pred::less>)->Apply(common_args);
+BENCHMARK(bm<uint32_t, Alg::lower_bound, Pred::lambda>)->Apply(common_args);
+BENCHMARK(bm<uint32_t, Alg::upper_bound, Pred::less>)->Apply(common_args);
+BENCHMARK(bm<uint32_t, Alg::upper_bound, Pred::lambda>)->Apply(common_args);
+BENCHMARK(bm<uint32_t, Alg::equal_range, Pred::less>)->Apply(common_args);
+BENCHMARK(bm<uint32_t, Alg::equal_range, Pred::lambda>)->Apply(common_args);
+BENCHMARK(bm<uint64_t, Alg::lower_bound, Pred::less>)->Apply(common_args);
+BENCHMARK(bm<uint64_t, Alg::lower_bound, Pred::lambda>)->Apply(common_args);
+
+BENCHMARK(bm<float, Alg::lower_bound, Pred::less>)->Apply(common_args);
+BENCHMARK(bm<float, Alg::lower_bound, Pred::lambda>)->Apply(common_args);
+BENCHMARK(bm<double, Alg::lower_bound, Pred::less>)->Apply(common_args);
+BENCHMARK(bm<double, Alg::lower_bound, Pred::lambda>)->Apply(common_args);
+
+BENCHMARK_MAIN();
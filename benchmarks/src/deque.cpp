@@ -0,0 +1,156 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// The deque_large_blocks benchmark is built from this file with _USE_STD_LARGE_DEQUE_BLOCKS defined.
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+struct bytes32 {
+    uint64_t vals[4];
+};
+
+template <class T>
+T make_value(const size_t idx) {
+    return T{static_cast<uint32_t>(idx)};
+}
+
+uint64_t key(const uint32_t val) {
+    return val;
+}
+
+uint64_t key(const uint64_t val) {
+    return val;
+}
+
+uint64_t key(const bytes32& val) {
+    return val.vals[0];
+}
+
+template <class T>
+deque<T> make_deque(const size_t size) {
+    deque<T> d;
+    for (size_t idx = 0; idx < size; ++idx) {
+        d.push_back(make_value<T>(idx));
+    }
+
+    return d;
+}
+
+template <class T>
+void bm_push_back(benchmark::State& state) {
+    const auto size = static_cast<size_t>(state.range(0));
+
+    for (auto _ : state) {
+        deque<T> d;
+        for (size_t idx = 0; idx < size; ++idx) {
+            d.push_back(make_value<T>(idx));
+        }
+
+        benchmark::DoNotOptimize(d);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class T>
+void bm_push_front(benchmark::State& state) {
+    const auto size = static_cast<size_t>(state.range(0));
+
+    for (auto _ : state) {
+        deque<T> d;
+        for (size_t idx = 0; idx < size; ++idx) {
+            d.push_front(make_value<T>(idx));
+        }
+
+        benchmark::DoNotOptimize(d);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class T>
+void bm_queue(benchmark::State& state) {
+    // a FIFO of steady size, which keeps allocating blocks at the back and freeing them at the front
+    auto d = make_deque<T>(static_cast<size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        for (size_t idx = 0; idx < 1024; ++idx) {
+            d.push_back(d.front());
+            d.pop_front();
+        }
+
+        benchmark::DoNotOptimize(d);
+    }
+
+    state.SetItemsProcessed(state.iterations() * 1024);
+}
+
+template <class T>
+void bm_iterate(benchmark::State& state) {
+    const auto d = make_deque<T>(static_cast<size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        uint64_t sum = 0;
+        for (const auto& val : d) {
+            sum += key(val);
+        }
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class T>
+void bm_random_access(benchmark::State& state) {
+    const auto size = static_cast<size_t>(state.range(0));
+    const auto d    = make_deque<T>(size);
+
+    mt19937_64 gen(1729);
+    uniform_int_distribution<size_t> dis(0, size - 1);
+    vector<size_t> indices(4096);
+    for (auto& idx : indices) {
+        idx = dis(gen);
+    }
+
+    for (auto _ : state) {
+        uint64_t sum = 0;
+        for (const auto idx : indices) {
+            sum += key(d[idx]);
+        }
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(indices.size()));
+}
+
+void common_args(benchmark::Benchmark* bm) {
+    bm->RangeMultiplier(32)->Range(1 << 5, 1 << 20);
+}
+
+BENCHMARK(bm_push_back<uint32_t>)->Apply(common_args);
+BENCHMARK(bm_push_back<uint64_t>)->Apply(common_args);
+BENCHMARK(bm_push_back<bytes32>)->Apply(common_args);
+BENCHMARK(bm_push_front<uint32_t>)->Apply(common_args);
+BENCHMARK(bm_push_front<uint64_t>)->Apply(common_args);
+BENCHMARK(bm_push_front<bytes32>)->Apply(common_args);
+BENCHMARK(bm_queue<uint32_t>)->Apply(common_args);
+BENCHMARK(bm_queue<uint64_t>)->Apply(common_args);
+BENCHMARK(bm_queue<bytes32>)->Apply(common_args);
+BENCHMARK(bm_iterate<uint32_t>)->Apply(common_args);
+BENCHMARK(bm_iterate<uint64_t>)->Apply(common_args);
+BENCHMARK(bm_iterate<bytes32>)->Apply(common_args);
+BENCHMARK(bm_random_access<uint32_t>)->Apply(common_args);
+BENCHMARK(bm_random_access<uint64_t>)->Apply(common_args);
+BENCHMARK(bm_random_access<bytes32>)->Apply(common_args);
+
+BENCHMARK_MAIN();
@@ -12,6 +12,7 @@
 #include <type_traits>
 #include <vector>
 
+#include "isa_levels.hpp"
 #include "skewed_allocator.hpp"
 
 enum class Op {
@@ -30,6 +31,7 @@ template <class T, template <class> class Alloc, Op Operation, T FillVal = T{'0'
 void bm(benchmark::State& state) {
     const auto size = static_cast<size_t>(state.range(0));
     const auto pos  = static_cast<size_t>(state.range(1));
+    isa_level_guard guard{state, state.range(2)};
 
     using Container =
         conditional_t<Operation >= Op::StringFind, basic_string<T, char_traits<T>, Alloc<T>>, vector<T, Alloc<T>>>;
@@ -68,9 +70,11 @@ void bm(benchmark::State& state) {
 }
 
 void common_args(benchmark::Benchmark* bm) {
-    bm->Args({8021, 3056});
-    // AVX tail tests
-    bm->Args({63, 62})->Args({31, 30})->Args({15, 14})->Args({7, 6});
+    for (const auto level : isa_levels) {
+        bm->Args({8021, 3056, level});
+        // AVX tail tests
+        bm->Args({63, 62, level})->Args({31, 30, level})->Args({15, 14, level})->Args({7, 6, level});
+    }
 }
 
 struct point {
@@ -80,6 +84,13 @@ struct point {
     bool operator==(const point&) const = default;
 };
 
+template <class T, size_t N>
+struct wide {
+    T vals[N];
+
+    bool operator==(const wide&) const = default;
+};
+
 BENCHMARK(bm<uint8_t, not_highly_aligned_allocator, Op::FindSized>)->Apply(common_args);
 BENCHMARK(bm<uint8_t, highly_aligned_allocator, Op::FindSized>)->Apply(common_args);
 BENCHMARK(bm<uint8_t, not_highly_aligned_allocator, Op::FindUnsized>)->Apply(common_args);
@@ -110,4 +121,11 @@ BENCHMARK(bm<uint64_t, not_highly_aligned_allocator, Op::Count>)->Apply(common_a
 BENCHMARK(bm<point, not_highly_aligned_allocator, Op::FindSized>)->Apply(common_args);
 BENCHMARK(bm<point, not_highly_aligned_allocator, Op::Count>)->Apply(common_args);
 
+BENCHMARK(bm<wide<uint8_t, 3>, not_highly_aligned_allocator, Op::FindSized>)->Apply(common_args);
+BENCHMARK(bm<wide<uint8_t, 3>, not_highly_aligned_allocator, Op::Count>)->Apply(common_args);
+BENCHMARK(bm<wide<uint32_t, 4>, not_highly_aligned_allocator, Op::FindSized>)->Apply(common_args);
+BENCHMARK(bm<wide<uint32_t, 4>, not_highly_aligned_allocator, Op::Count>)->Apply(common_args);
+BENCHMARK(bm<wide<uint64_t, 3>, not_highly_aligned_allocator, Op::FindSized>)->Apply(common_args);
+BENCHMARK(bm<wide<uint64_t, 3>, not_highly_aligned_allocator, Op::Count>)->Apply(common_args);
+
 BENCHMARK_MAIN();
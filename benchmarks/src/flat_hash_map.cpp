@@ -0,0 +1,99 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <flat_hash_map>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+using namespace std;
+
+vector<uint64_t> make_keys(const size_t size) {
+    mt19937_64 gen(1729);
+    vector<uint64_t> keys(size);
+    for (auto& key : keys) {
+        key = gen();
+    }
+
+    return keys;
+}
+
+template <class Map>
+void bm_insert(benchmark::State& state) {
+    const auto keys = make_keys(static_cast<size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        Map m;
+        for (const auto key : keys) {
+            m.emplace(key, key);
+        }
+
+        benchmark::DoNotOptimize(m);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class Map>
+void bm_find(benchmark::State& state) {
+    const auto keys = make_keys(static_cast<size_t>(state.range(0)));
+    Map m;
+    for (const auto key : keys) {
+        m.emplace(key, key);
+    }
+
+    for (auto _ : state) {
+        uint64_t sum = 0;
+        for (const auto key : keys) {
+            // flipping the low bit turns a hit into a miss, mixing both kinds of lookups
+            const auto it = m.find(key ^ (sum & 1));
+            if (it != m.end()) {
+                sum += it->second;
+            }
+        }
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class Map>
+void bm_erase_insert(benchmark::State& state) {
+    const auto keys = make_keys(static_cast<size_t>(state.range(0)));
+    Map m;
+    for (const auto key : keys) {
+        m.emplace(key, key);
+    }
+
+    for (auto _ : state) {
+        for (const auto key : keys) {
+            m.erase(key);
+            m.emplace(key, key);
+        }
+
+        benchmark::DoNotOptimize(m);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void common_args(benchmark::Benchmark* bm) {
+    bm->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+}
+
+using std_map  = unordered_map<uint64_t, uint64_t>;
+using flat_map = stdext::flat_hash_map<uint64_t, uint64_t>;
+
+BENCHMARK(bm_insert<std_map>)->Apply(common_args);
+BENCHMARK(bm_insert<flat_map>)->Apply(common_args);
+BENCHMARK(bm_find<std_map>)->Apply(common_args);
+BENCHMARK(bm_find<flat_map>)->Apply(common_args);
+BENCHMARK(bm_erase_insert<std_map>)->Apply(common_args);
+BENCHMARK(bm_erase_insert<flat_map>)->Apply(common_args);
+
+BENCHMARK_MAIN();
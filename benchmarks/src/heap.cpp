@@ -0,0 +1,107 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+using namespace std;
+
+enum class Alg { make_heap, pop_heap, sort_heap, is_heap_until };
+enum class Pred { less, lambda };
+
+template <class T, Alg Algorithm, Pred Predicate>
+void bm(benchmark::State& state) {
+    const auto size = static_cast<size_t>(state.range(0));
+
+    vector<T> src(size);
+
+    mt19937_64 gen(84710);
+
+    if constexpr (is_floating_point_v<T>) {
+        normal_distribution<T> dis(0, 100000.0);
+        ranges::generate(src, [&] { return dis(gen); });
+    } else {
+        uniform_int_distribution<conditional_t<sizeof(T) != 1, T, int>> dis(0, static_cast<T>(-1));
+        ranges::generate(src, [&] { return static_cast<T>(dis(gen)); });
+    }
+
+    // Not recognized as less<>, so not vectorized; the baseline
+    const auto pred = [](const T& left, const T& right) { return left < right; };
+
+    if constexpr (Algorithm != Alg::make_heap) {
+        ranges::make_heap(src);
+    }
+
+    vector<T> v(size);
+
+    for (auto _ : state) {
+        if constexpr (Algorithm == Alg::is_heap_until) {
+            benchmark::DoNotOptimize(src);
+            if constexpr (Predicate == Pred::less) {
+                benchmark::DoNotOptimize(is_heap_until(src.begin(), src.end()));
+            } else {
+                benchmark::DoNotOptimize(is_heap_until(src.begin(), src.end(), pred));
+            }
+        } else {
+            v = src;
+            benchmark::DoNotOptimize(v);
+            if constexpr (Algorithm == Alg::make_heap) {
+                if constexpr (Predicate == Pred::less) {
+                    make_heap(v.begin(), v.end());
+                } else {
+                    make_heap(v.begin(), v.end(), pred);
+                }
+            } else if constexpr (Algorithm == Alg::pop_heap) {
+                // Pops a fixed number of elements, so that the cost doesn't grow with the size beyond the heap depth
+                const auto stop = v.end() - static_cast<ptrdiff_t>(min<size_t>(size, 256));
+                for (auto last = v.end(); last != stop; --last) {
+                    if constexpr (Predicate == Pred::less) {
+                        pop_heap(v.begin(), last);
+                    } else {
+                        pop_heap(v.begin(), last, pred);
+                    }
+                }
+            } else {
+                if constexpr (Predicate == Pred::less) {
+                    sort_heap(v.begin(), v.end());
+                } else {
+                    sort_heap(v.begin(), v.end(), pred);
+                }
+            }
+            benchmark::DoNotOptimize(v);
+        }
+    }
+}
+
+void common_args(benchmark::Benchmark* const bm) {
+    bm->Arg(300)->Arg(8021)->Arg(3'000'000);
+}
+
+BENCHMARK(bm<uint8_t, Alg::is_heap_until, Pred::less>)->Apply(common_args);
+BENCHMARK(bm<uint8_t, Alg::is_heap_until, Pred::lambda>)->Apply(common_args);
+BENCHMARK(bm<uint32_t, Alg::is_heap_until, Pred::less>)->Apply(common_args);
+BENCHMARK(bm<uint32_t, Alg::is_heap_until, Pred::lambda>)->Apply(common_args);
+BENCHMARK(bm<uint64_t, Alg::is_heap_until, Pred::less>)->Apply(common_args);
+BENCHMARK(bm<uint64_t, Alg::is_heap_until, Pred::lambda>)->Apply(common_args);
+
+BENCHMARK(bm<uint32_t, Alg::make_heap, Pred::less>)->Apply(common_args);
+BENCHMARK(bm<uint32_t, Alg::make_heap, Pred::lambda>)->Apply(common_args);
+BENCHMARK(bm<uint32_t, Alg::pop_heap, Pred::less>)->Apply(common_args);
+BENCHMARK(bm<uint32_t, Alg::pop_heap, Pred::lambda>)->Apply(common_args);
+BENCHMARK(bm<uint32_t, Alg::sort_heap, Pred::less>)->Apply(common_args);
+BENCHMARK(bm<uint32_t, Alg::sort_heap, Pred::lambda>)->Apply(common_args);
+
+BENCHMARK(bm<float, Alg::is_heap_until, Pred::less>)->Apply(common_args);
+BENCHMARK(bm<float, Alg::is_heap_until, Pred::lambda>)->Apply(common_args);
+BENCHMARK(bm<double, Alg::make_heap, Pred::less>)->Apply(common_args);
+BENCHMARK(bm<double, Alg::make_heap, Pred::lambda>)->Apply(common_args);
+BENCHMARK(bm<double, Alg::pop_heap, Pred::less>)->Apply(common_args);
+BENCHMARK(bm<double, Alg::pop_heap, Pred::lambda>)->Apply(common_args);
+
+BENCHMARK_MAIN();
@@ -11,6 +11,7 @@
 #include <type_traits>
 #include <vector>
 
+#include "isa_levels.hpp"
 #include "skewed_allocator.hpp"
 
 enum class Op {
@@ -26,7 +27,9 @@ using namespace std;
 
 template <class T, Op Operation>
 void bm(benchmark::State& state) {
-    vector<T, not_highly_aligned_allocator<T>> a(static_cast<size_t>(state.range()));
+    isa_level_guard guard{state, state.range(1)};
+
+    vector<T, not_highly_aligned_allocator<T>> a(static_cast<size_t>(state.range(0)));
 
     mt19937 gen(84710);
 
@@ -59,9 +62,11 @@ void bm(benchmark::State& state) {
 
 template <size_t ElementSize>
 void common_arg(benchmark::Benchmark* bm) {
-    bm->Arg(8021);
-    // AVX tail tests
-    bm->Arg(63 / ElementSize);
+    for (const auto level : isa_levels) {
+        bm->Args({8021, level});
+        // AVX tail tests
+        bm->Args({63 / ElementSize, level});
+    }
 }
 
 BENCHMARK(bm<uint8_t, Op::Min>)->Apply(common_arg<1>);
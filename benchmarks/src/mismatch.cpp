@@ -9,6 +9,7 @@
 #include <ranges>
 #include <vector>
 
+#include "isa_levels.hpp"
 #include "skewed_allocator.hpp"
 
 using namespace std;
@@ -33,6 +34,8 @@ constexpr color c2{30000, 40000, 30000};
 
 template <class T, op Op, T MatchVal = T{'.'}, T MismatchVal = T{'x'}>
 void bm(benchmark::State& state) {
+    isa_level_guard guard{state, state.range(2)};
+
     vector<T, not_highly_aligned_allocator<T>> a(static_cast<size_t>(state.range(0)), MatchVal);
     vector<T, not_highly_aligned_allocator<T>> b(static_cast<size_t>(state.range(0)), MatchVal);
 
@@ -50,7 +53,9 @@ void bm(benchmark::State& state) {
 }
 
 void common_args(benchmark::Benchmark* bm) {
-    bm->Args({8, 3})->Args({24, 22})->Args({105, -1})->Args({4021, 3056});
+    for (const auto level : isa_levels) {
+        bm->Args({8, 3, level})->Args({24, 22, level})->Args({105, -1, level})->Args({4021, 3056, level});
+    }
 }
 
 BENCHMARK(bm<uint8_t, op::mismatch>)->Apply(common_args);
@@ -5,9 +5,13 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <random>
 #include <vector>
 
+#include "isa_levels.hpp"
+
 using namespace std;
 
 constexpr int tukey_ninther_adversary1[] = {0, 6, 12, 18, 22, 28, 34, 38, 44, 50, 54, 60, 66, 70, 76, 82, 86, 92, 98,
@@ -138,4 +142,67 @@ BENCHMARK_CAPTURE(benchmark_common<alg_type::rng>, adversary1, tukey_ninther_adv
 BENCHMARK_CAPTURE(benchmark_common<alg_type::std_fn>, adversary2, tukey_ninther_adversary2);
 BENCHMARK_CAPTURE(benchmark_common<alg_type::rng>, adversary2, tukey_ninther_adversary2);
 
+// Percentiles of latency-like samples; the last argument is the ISA level.
+template <class T, alg_type Type>
+void bm_percentile(benchmark::State& state) {
+    isa_level_guard guard{state, state.range(1)};
+
+    vector<T> src(static_cast<size_t>(state.range(0)));
+    mt19937 gen(84710);
+    lognormal_distribution<double> dis(3.0, 1.0);
+    ranges::generate(src, [&] { return static_cast<T>(dis(gen) * 1000.0); });
+
+    vector<T> v;
+    v.reserve(src.size());
+
+    for (auto _ : state) {
+        v.assign(src.begin(), src.end());
+        benchmark::DoNotOptimize(v);
+        auto p99 = v.begin() + static_cast<ptrdiff_t>(v.size() * 99 / 100);
+        if constexpr (Type == alg_type::std_fn) {
+            nth_element(v.begin(), p99, v.end());
+        } else {
+            ranges::nth_element(v, p99);
+        }
+        benchmark::DoNotOptimize(*p99);
+    }
+}
+
+// The greatest 1% of the samples, in order
+template <class T>
+void bm_partial_sort(benchmark::State& state) {
+    isa_level_guard guard{state, state.range(1)};
+
+    vector<T> src(static_cast<size_t>(state.range(0)));
+    mt19937 gen(84710);
+    lognormal_distribution<double> dis(3.0, 1.0);
+    ranges::generate(src, [&] { return static_cast<T>(dis(gen) * 1000.0); });
+
+    vector<T> v;
+    v.reserve(src.size());
+
+    for (auto _ : state) {
+        v.assign(src.begin(), src.end());
+        benchmark::DoNotOptimize(v);
+        partial_sort(v.begin(), v.begin() + static_cast<ptrdiff_t>(v.size() / 100), v.end(), greater<>{});
+        benchmark::DoNotOptimize(v);
+    }
+}
+
+void sample_args(benchmark::Benchmark* const bm) {
+    for (const auto level : isa_levels) {
+        bm->Args({8192, level});
+        bm->Args({1'000'000, level});
+    }
+}
+
+BENCHMARK(bm_percentile<uint32_t, alg_type::std_fn>)->Apply(sample_args);
+BENCHMARK(bm_percentile<uint32_t, alg_type::rng>)->Apply(sample_args);
+BENCHMARK(bm_percentile<uint64_t, alg_type::std_fn>)->Apply(sample_args);
+BENCHMARK(bm_percentile<float, alg_type::std_fn>)->Apply(sample_args);
+BENCHMARK(bm_percentile<double, alg_type::std_fn>)->Apply(sample_args);
+
+BENCHMARK(bm_partial_sort<uint32_t>)->Apply(sample_args);
+BENCHMARK(bm_partial_sort<double>)->Apply(sample_args);
+
 BENCHMARK_MAIN();
@@ -0,0 +1,79 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <execution>
+#include <numeric>
+#include <vector>
+
+using namespace std;
+
+// Compares serial and parallel algorithms on element operations of different costs; the sizes where the par rows
+// start beating the seq rows are the crossover points the adaptive sequential cutoff has to find.
+
+enum class Alg { ForEach, Transform, TransformReduce };
+
+enum class Cost { Cheap, Expensive };
+
+template <Cost ElementCost>
+uint32_t op(const uint32_t val) {
+    if constexpr (ElementCost == Cost::Cheap) {
+        return val + 1;
+    } else {
+        return static_cast<uint32_t>(sqrt(static_cast<double>(val)) * cos(static_cast<double>(val)));
+    }
+}
+
+template <class ExecutionPolicy, Alg Algorithm, Cost ElementCost>
+void bm(benchmark::State& state) {
+    const size_t size = static_cast<size_t>(state.range(0));
+    const ExecutionPolicy exec{};
+
+    vector<uint32_t> src(size);
+    vector<uint32_t> dest(size);
+    iota(src.begin(), src.end(), uint32_t{0});
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(src);
+        if constexpr (Algorithm == Alg::ForEach) {
+            for_each(exec, src.begin(), src.end(), [](uint32_t& val) { val = op<ElementCost>(val); });
+        } else if constexpr (Algorithm == Alg::Transform) {
+            transform(exec, src.begin(), src.end(), dest.begin(), op<ElementCost>);
+        } else if constexpr (Algorithm == Alg::TransformReduce) {
+            benchmark::DoNotOptimize(
+                transform_reduce(exec, src.begin(), src.end(), uint32_t{0}, plus<>{}, op<ElementCost>));
+        }
+        benchmark::DoNotOptimize(dest);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void common_args(benchmark::Benchmark* bm) {
+    bm->RangeMultiplier(4)->Range(1 << 10, 1 << 22);
+}
+
+using execution::parallel_policy;
+using execution::sequenced_policy;
+
+BENCHMARK(bm<sequenced_policy, Alg::ForEach, Cost::Cheap>)->Apply(common_args);
+BENCHMARK(bm<parallel_policy, Alg::ForEach, Cost::Cheap>)->Apply(common_args);
+BENCHMARK(bm<sequenced_policy, Alg::ForEach, Cost::Expensive>)->Apply(common_args);
+BENCHMARK(bm<parallel_policy, Alg::ForEach, Cost::Expensive>)->Apply(common_args);
+
+BENCHMARK(bm<sequenced_policy, Alg::Transform, Cost::Cheap>)->Apply(common_args);
+BENCHMARK(bm<parallel_policy, Alg::Transform, Cost::Cheap>)->Apply(common_args);
+BENCHMARK(bm<sequenced_policy, Alg::Transform, Cost::Expensive>)->Apply(common_args);
+BENCHMARK(bm<parallel_policy, Alg::Transform, Cost::Expensive>)->Apply(common_args);
+
+BENCHMARK(bm<sequenced_policy, Alg::TransformReduce, Cost::Cheap>)->Apply(common_args);
+BENCHMARK(bm<parallel_policy, Alg::TransformReduce, Cost::Cheap>)->Apply(common_args);
+BENCHMARK(bm<sequenced_policy, Alg::TransformReduce, Cost::Expensive>)->Apply(common_args);
+BENCHMARK(bm<parallel_policy, Alg::TransformReduce, Cost::Expensive>)->Apply(common_args);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,83 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include "skewed_allocator.hpp"
+
+using namespace std;
+
+enum class Alg {
+    Accumulate,
+    Reduce,
+    TransformReduce,
+};
+
+template <class T, Alg Algorithm>
+void bm(benchmark::State& state) {
+    mt19937 gen(96337);
+
+    const size_t size = static_cast<size_t>(state.range(0));
+
+    vector<T, not_highly_aligned_allocator<T>> input1(size);
+    vector<T, not_highly_aligned_allocator<T>> input2(size);
+
+    if constexpr (is_floating_point_v<T>) {
+        normal_distribution<T> dis(0, 100000.0);
+        ranges::generate(input1, [&] { return dis(gen); });
+        ranges::generate(input2, [&] { return dis(gen); });
+    } else {
+        static_assert(is_unsigned_v<T>, "This avoids signed integers to avoid UB; they shouldn't perform differently");
+        uniform_int_distribution<conditional_t<sizeof(T) != 1, T, unsigned int>> dis(0, numeric_limits<T>::max());
+        ranges::generate(input1, [&] { return static_cast<T>(dis(gen)); });
+        ranges::generate(input2, [&] { return static_cast<T>(dis(gen)); });
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(input1);
+        benchmark::DoNotOptimize(input2);
+        if constexpr (Algorithm == Alg::Accumulate) {
+            benchmark::DoNotOptimize(accumulate(input1.begin(), input1.end(), T{0}));
+        } else if constexpr (Algorithm == Alg::Reduce) {
+            benchmark::DoNotOptimize(reduce(input1.begin(), input1.end(), T{0}));
+        } else if constexpr (Algorithm == Alg::TransformReduce) {
+            benchmark::DoNotOptimize(transform_reduce(input1.begin(), input1.end(), input2.begin(), T{0}));
+        }
+    }
+}
+
+void common_args(benchmark::Benchmark* bm) {
+    bm->Arg(3000)->Arg(1'000'000);
+}
+
+#pragma warning(push)
+#pragma warning(disable : 4244) // warning C4244: '=': conversion from 'int' to 'unsigned char', possible loss of data
+BENCHMARK(bm<uint8_t, Alg::Accumulate>)->Apply(common_args);
+BENCHMARK(bm<uint8_t, Alg::Reduce>)->Apply(common_args);
+BENCHMARK(bm<uint16_t, Alg::Reduce>)->Apply(common_args);
+#pragma warning(pop)
+
+BENCHMARK(bm<uint32_t, Alg::Accumulate>)->Apply(common_args);
+BENCHMARK(bm<uint64_t, Alg::Accumulate>)->Apply(common_args);
+BENCHMARK(bm<double, Alg::Accumulate>)->Apply(common_args);
+
+BENCHMARK(bm<uint32_t, Alg::Reduce>)->Apply(common_args);
+BENCHMARK(bm<uint64_t, Alg::Reduce>)->Apply(common_args);
+BENCHMARK(bm<float, Alg::Reduce>)->Apply(common_args);
+BENCHMARK(bm<double, Alg::Reduce>)->Apply(common_args);
+
+BENCHMARK(bm<uint32_t, Alg::TransformReduce>)->Apply(common_args);
+BENCHMARK(bm<uint64_t, Alg::TransformReduce>)->Apply(common_args);
+BENCHMARK(bm<float, Alg::TransformReduce>)->Apply(common_args);
+BENCHMARK(bm<double, Alg::TransformReduce>)->Apply(common_args);
+
+BENCHMARK_MAIN();
@@ -7,6 +7,7 @@
 #include <cstdint>
 #include <vector>
 
+#include "isa_levels.hpp"
 #include "lorem.hpp"
 #include "skewed_allocator.hpp"
 
@@ -14,6 +15,8 @@ enum class alg_type { std_fn, rng };
 
 template <alg_type Type, class T>
 void r(benchmark::State& state) {
+    isa_level_guard guard{state, state.range(0)};
+
     const std::vector<T, not_highly_aligned_allocator<T>> src(lorem_ipsum.begin(), lorem_ipsum.end());
     std::vector<T, not_highly_aligned_allocator<T>> v;
     v.reserve(lorem_ipsum.size());
@@ -30,6 +33,8 @@ void r(benchmark::State& state) {
 
 template <alg_type Type, class T>
 void rc(benchmark::State& state) {
+    isa_level_guard guard{state, state.range(0)};
+
     std::vector<T, not_highly_aligned_allocator<T>> src(lorem_ipsum.begin(), lorem_ipsum.end());
     std::vector<T, not_highly_aligned_allocator<T>> v(lorem_ipsum.size());
     for (auto _ : state) {
@@ -43,24 +48,24 @@ void rc(benchmark::State& state) {
     }
 }
 
-BENCHMARK(r<alg_type::std_fn, std::uint8_t>);
-BENCHMARK(r<alg_type::std_fn, std::uint16_t>);
-BENCHMARK(r<alg_type::std_fn, std::uint32_t>);
-BENCHMARK(r<alg_type::std_fn, std::uint64_t>);
+BENCHMARK(r<alg_type::std_fn, std::uint8_t>)->Apply(isa_level_args);
+BENCHMARK(r<alg_type::std_fn, std::uint16_t>)->Apply(isa_level_args);
+BENCHMARK(r<alg_type::std_fn, std::uint32_t>)->Apply(isa_level_args);
+BENCHMARK(r<alg_type::std_fn, std::uint64_t>)->Apply(isa_level_args);
 
-BENCHMARK(r<alg_type::rng, std::uint8_t>);
-BENCHMARK(r<alg_type::rng, std::uint16_t>);
-BENCHMARK(r<alg_type::rng, std::uint32_t>);
-BENCHMARK(r<alg_type::rng, std::uint64_t>);
+BENCHMARK(r<alg_type::rng, std::uint8_t>)->Apply(isa_level_args);
+BENCHMARK(r<alg_type::rng, std::uint16_t>)->Apply(isa_level_args);
+BENCHMARK(r<alg_type::rng, std::uint32_t>)->Apply(isa_level_args);
+BENCHMARK(r<alg_type::rng, std::uint64_t>)->Apply(isa_level_args);
 
-BENCHMARK(rc<alg_type::std_fn, std::uint8_t>);
-BENCHMARK(rc<alg_type::std_fn, std::uint16_t>);
-BENCHMARK(rc<alg_type::std_fn, std::uint32_t>);
-BENCHMARK(rc<alg_type::std_fn, std::uint64_t>);
+BENCHMARK(rc<alg_type::std_fn, std::uint8_t>)->Apply(isa_level_args);
+BENCHMARK(rc<alg_type::std_fn, std::uint16_t>)->Apply(isa_level_args);
+BENCHMARK(rc<alg_type::std_fn, std::uint32_t>)->Apply(isa_level_args);
+BENCHMARK(rc<alg_type::std_fn, std::uint64_t>)->Apply(isa_level_args);
 
-BENCHMARK(rc<alg_type::rng, std::uint8_t>);
-BENCHMARK(rc<alg_type::rng, std::uint16_t>);
-BENCHMARK(rc<alg_type::rng, std::uint32_t>);
-BENCHMARK(rc<alg_type::rng, std::uint64_t>);
+BENCHMARK(rc<alg_type::rng, std::uint8_t>)->Apply(isa_level_args);
+BENCHMARK(rc<alg_type::rng, std::uint16_t>)->Apply(isa_level_args);
+BENCHMARK(rc<alg_type::rng, std::uint32_t>)->Apply(isa_level_args);
+BENCHMARK(rc<alg_type::rng, std::uint64_t>)->Apply(isa_level_args);
 
 BENCHMARK_MAIN();
@@ -0,0 +1,74 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include "skewed_allocator.hpp"
+
+using namespace std;
+
+enum class Alg {
+    PartialSum,
+    InclusiveScan,
+    ExclusiveScan,
+};
+
+template <class T, Alg Algorithm>
+void bm(benchmark::State& state) {
+    mt19937 gen(96337);
+
+    const size_t size = static_cast<size_t>(state.range(0));
+
+    vector<T, not_highly_aligned_allocator<T>> input(size);
+    vector<T, not_highly_aligned_allocator<T>> output(size);
+
+    if constexpr (is_floating_point_v<T>) {
+        normal_distribution<T> dis(0, 100000.0);
+        ranges::generate(input, [&] { return dis(gen); });
+    } else {
+        static_assert(is_unsigned_v<T>, "This avoids signed integers to avoid UB; they shouldn't perform differently");
+        uniform_int_distribution<T> dis(0, numeric_limits<T>::max());
+        ranges::generate(input, [&] { return dis(gen); });
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(input);
+        if constexpr (Algorithm == Alg::PartialSum) {
+            partial_sum(input.begin(), input.end(), output.begin());
+        } else if constexpr (Algorithm == Alg::InclusiveScan) {
+            inclusive_scan(input.begin(), input.end(), output.begin());
+        } else if constexpr (Algorithm == Alg::ExclusiveScan) {
+            exclusive_scan(input.begin(), input.end(), output.begin(), T{0});
+        }
+        benchmark::DoNotOptimize(output);
+    }
+}
+
+void common_args(benchmark::Benchmark* bm) {
+    bm->Arg(3000)->Arg(1'000'000);
+}
+
+BENCHMARK(bm<uint32_t, Alg::PartialSum>)->Apply(common_args);
+BENCHMARK(bm<uint64_t, Alg::PartialSum>)->Apply(common_args);
+BENCHMARK(bm<double, Alg::PartialSum>)->Apply(common_args);
+
+BENCHMARK(bm<uint32_t, Alg::InclusiveScan>)->Apply(common_args);
+BENCHMARK(bm<uint64_t, Alg::InclusiveScan>)->Apply(common_args);
+BENCHMARK(bm<float, Alg::InclusiveScan>)->Apply(common_args);
+BENCHMARK(bm<double, Alg::InclusiveScan>)->Apply(common_args);
+
+BENCHMARK(bm<uint32_t, Alg::ExclusiveScan>)->Apply(common_args);
+BENCHMARK(bm<uint64_t, Alg::ExclusiveScan>)->Apply(common_args);
+BENCHMARK(bm<float, Alg::ExclusiveScan>)->Apply(common_args);
+BENCHMARK(bm<double, Alg::ExclusiveScan>)->Apply(common_args);
+
+BENCHMARK_MAIN();
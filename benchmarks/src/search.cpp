@@ -10,6 +10,7 @@
 #include <functional>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <vector>
 
 #include "lorem.hpp"
@@ -121,6 +122,42 @@ void search_default_searcher(benchmark::State& state) {
     }
 }
 
+// Elements of a fixed stride, each character spread over all of the components
+template <class T, size_t N>
+struct wide {
+    T vals[N];
+
+    bool operator==(const wide&) const = default;
+};
+
+template <class W>
+std::vector<W, not_highly_aligned_allocator<W>> make_wide(const std::string_view src) {
+    std::vector<W, not_highly_aligned_allocator<W>> result(src.size());
+    for (size_t i = 0; i != src.size(); ++i) {
+        for (auto& val : result[i].vals) {
+            val = static_cast<std::remove_reference_t<decltype(val)>>(src[i]);
+        }
+    }
+
+    return result;
+}
+
+template <class W>
+void classic_search_wide(benchmark::State& state) {
+    const auto& src_haystack = patterns[static_cast<size_t>(state.range())].data;
+    const auto& src_needle   = patterns[static_cast<size_t>(state.range())].pattern;
+
+    const auto haystack = make_wide<W>(src_haystack);
+    const auto needle   = make_wide<W>(src_needle);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(haystack);
+        benchmark::DoNotOptimize(needle);
+        auto res = std::search(haystack.begin(), haystack.end(), needle.begin(), needle.end());
+        benchmark::DoNotOptimize(res);
+    }
+}
+
 template <class T>
 void member_find(benchmark::State& state) {
     const auto& src_haystack = patterns[static_cast<size_t>(state.range())].data;
@@ -196,6 +233,10 @@ BENCHMARK(classic_search<std::uint16_t>)->Apply(common_args);
 BENCHMARK(classic_search<std::uint32_t>)->Apply(common_args);
 BENCHMARK(classic_search<std::uint64_t>)->Apply(common_args);
 
+BENCHMARK(classic_search_wide<wide<std::uint8_t, 3>>)->Apply(common_args);
+BENCHMARK(classic_search_wide<wide<std::uint32_t, 4>>)->Apply(common_args);
+BENCHMARK(classic_search_wide<wide<std::uint64_t, 3>>)->Apply(common_args);
+
 BENCHMARK(ranges_search<std::uint8_t>)->Apply(common_args);
 BENCHMARK(ranges_search<std::uint16_t>)->Apply(common_args);
 BENCHMARK(ranges_search<std::uint32_t>)->Apply(common_args);
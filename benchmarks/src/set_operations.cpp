@@ -0,0 +1,101 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+using namespace std;
+
+enum class Alg { merge, set_intersection, set_difference, set_union, set_symmetric_difference };
+enum class Pred { less, lambda };
+
+template <class T, Alg Algorithm, Pred Predicate>
+void bm(benchmark::State& state) {
+    const auto size1 = static_cast<size_t>(state.range(0));
+    const auto size2 = static_cast<size_t>(state.range(1));
+
+    // Values from four times the larger size, so that a fair share of the shorter range is in the longer one,
+    // like posting lists of document IDs
+    mt19937_64 gen(84710);
+    uniform_int_distribution<T> dis(0, static_cast<T>(4 * max(size1, size2)));
+
+    vector<T> v1(size1);
+    vector<T> v2(size2);
+    ranges::generate(v1, [&] { return dis(gen); });
+    ranges::generate(v2, [&] { return dis(gen); });
+    ranges::sort(v1);
+    ranges::sort(v2);
+
+    vector<T> dest(size1 + size2);
+
+    // Not recognized as less<>, so not vectorized; the baseline
+    const auto pred = [](const T& left, const T& right) { return left < right; };
+
+    const auto run = [&](const auto... pred_arg) {
+        if constexpr (Algorithm == Alg::merge) {
+            return merge(v1.begin(), v1.end(), v2.begin(), v2.end(), dest.begin(), pred_arg...);
+        } else if constexpr (Algorithm == Alg::set_intersection) {
+            return set_intersection(v1.begin(), v1.end(), v2.begin(), v2.end(), dest.begin(), pred_arg...);
+        } else if constexpr (Algorithm == Alg::set_difference) {
+            return set_difference(v1.begin(), v1.end(), v2.begin(), v2.end(), dest.begin(), pred_arg...);
+        } else if constexpr (Algorithm == Alg::set_union) {
+            return set_union(v1.begin(), v1.end(), v2.begin(), v2.end(), dest.begin(), pred_arg...);
+        } else {
+            return set_symmetric_difference(v1.begin(), v1.end(), v2.begin(), v2.end(), dest.begin(), pred_arg...);
+        }
+    };
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(v1);
+        benchmark::DoNotOptimize(v2);
+        if constexpr (Predicate == Pred::less) {
+            benchmark::DoNotOptimize(run());
+        } else {
+            benchmark::DoNotOptimize(run(pred));
+        }
+        benchmark::DoNotOptimize(dest);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * (size1 + size2)));
+}
+
+void common_args(benchmark::Benchmark* bm) {
+    bm->Args({3000, 3000});
+    bm->Args({100000, 100000});
+    bm->Args({100000, 10000});
+    bm->Args({100000, 1000});
+    bm->Args({1000, 100000});
+}
+
+BENCHMARK(bm<uint32_t, Alg::merge, Pred::less>)->Apply(common_args);
+BENCHMARK(bm<uint32_t, Alg::merge, Pred::lambda>)->Apply(common_args);
+BENCHMARK(bm<uint64_t, Alg::merge, Pred::less>)->Apply(common_args);
+BENCHMARK(bm<uint64_t, Alg::merge, Pred::lambda>)->Apply(common_args);
+
+BENCHMARK(bm<uint32_t, Alg::set_intersection, Pred::less>)->Apply(common_args);
+BENCHMARK(bm<uint32_t, Alg::set_intersection, Pred::lambda>)->Apply(common_args);
+BENCHMARK(bm<uint64_t, Alg::set_intersection, Pred::less>)->Apply(common_args);
+BENCHMARK(bm<uint64_t, Alg::set_intersection, Pred::lambda>)->Apply(common_args);
+
+BENCHMARK(bm<uint32_t, Alg::set_difference, Pred::less>)->Apply(common_args);
+BENCHMARK(bm<uint32_t, Alg::set_difference, Pred::lambda>)->Apply(common_args);
+BENCHMARK(bm<uint64_t, Alg::set_difference, Pred::less>)->Apply(common_args);
+BENCHMARK(bm<uint64_t, Alg::set_difference, Pred::lambda>)->Apply(common_args);
+
+BENCHMARK(bm<uint32_t, Alg::set_union, Pred::less>)->Apply(common_args);
+BENCHMARK(bm<uint32_t, Alg::set_union, Pred::lambda>)->Apply(common_args);
+BENCHMARK(bm<uint64_t, Alg::set_union, Pred::less>)->Apply(common_args);
+BENCHMARK(bm<uint64_t, Alg::set_union, Pred::lambda>)->Apply(common_args);
+
+BENCHMARK(bm<uint32_t, Alg::set_symmetric_difference, Pred::less>)->Apply(common_args);
+BENCHMARK(bm<uint32_t, Alg::set_symmetric_difference, Pred::lambda>)->Apply(common_args);
+BENCHMARK(bm<uint64_t, Alg::set_symmetric_difference, Pred::less>)->Apply(common_args);
+BENCHMARK(bm<uint64_t, Alg::set_symmetric_difference, Pred::lambda>)->Apply(common_args);
+
+BENCHMARK_MAIN();
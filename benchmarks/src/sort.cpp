@@ -0,0 +1,79 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include "isa_levels.hpp"
+#include "skewed_allocator.hpp"
+
+using namespace std;
+
+enum class Pred { less, greater, lambda };
+
+template <class T, Pred Predicate>
+void bm(benchmark::State& state) {
+    isa_level_guard guard{state, state.range(1)};
+
+    vector<T, not_highly_aligned_allocator<T>> src(static_cast<size_t>(state.range(0)));
+    vector<T, not_highly_aligned_allocator<T>> v;
+    v.reserve(src.size());
+
+    mt19937_64 gen(84710);
+
+    if constexpr (is_floating_point_v<T>) {
+        normal_distribution<T> dis(0, 100000.0);
+        ranges::generate(src, [&] { return dis(gen); });
+    } else {
+        uniform_int_distribution<conditional_t<sizeof(T) != 1, T, int>> dis(0, static_cast<T>(-1));
+        ranges::generate(src, [&] { return static_cast<T>(dis(gen)); });
+    }
+
+    for (auto _ : state) {
+        v.assign(src.begin(), src.end());
+        benchmark::DoNotOptimize(v);
+
+        if constexpr (Predicate == Pred::less) {
+            sort(v.begin(), v.end());
+        } else if constexpr (Predicate == Pred::greater) {
+            sort(v.begin(), v.end(), greater<>{});
+        } else {
+            // Not recognized as less<>, so not vectorized; the baseline
+            sort(v.begin(), v.end(), [](const T& left, const T& right) { return left < right; });
+        }
+
+        benchmark::DoNotOptimize(v);
+    }
+}
+
+void common_args(benchmark::Benchmark* const bm) {
+    for (const auto level : isa_levels) {
+        bm->Args({8021, level});
+        bm->Args({300'000, level});
+        bm->Args({40, level});
+    }
+}
+
+BENCHMARK(bm<uint8_t, Pred::less>)->Apply(common_args);
+BENCHMARK(bm<uint8_t, Pred::lambda>)->Apply(common_args);
+BENCHMARK(bm<uint16_t, Pred::less>)->Apply(common_args);
+BENCHMARK(bm<uint16_t, Pred::lambda>)->Apply(common_args);
+BENCHMARK(bm<uint32_t, Pred::less>)->Apply(common_args);
+BENCHMARK(bm<uint32_t, Pred::greater>)->Apply(common_args);
+BENCHMARK(bm<uint32_t, Pred::lambda>)->Apply(common_args);
+BENCHMARK(bm<uint64_t, Pred::less>)->Apply(common_args);
+BENCHMARK(bm<uint64_t, Pred::lambda>)->Apply(common_args);
+
+BENCHMARK(bm<float, Pred::less>)->Apply(common_args);
+BENCHMARK(bm<float, Pred::lambda>)->Apply(common_args);
+BENCHMARK(bm<double, Pred::less>)->Apply(common_args);
+BENCHMARK(bm<double, Pred::lambda>)->Apply(common_args);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,46 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <random>
+#include <string>
+
+using namespace std;
+
+enum class Alg { fnv1a, fast };
+
+template <Alg Algorithm>
+void bm(benchmark::State& state) {
+    const auto size = static_cast<size_t>(state.range(0));
+
+    mt19937_64 gen(96337);
+    uniform_int_distribution<int> dis('a', 'z');
+
+    string key(size, '\0');
+    for (auto& ch : key) {
+        ch = static_cast<char>(dis(gen));
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(key);
+        if constexpr (Algorithm == Alg::fnv1a) {
+            // What hash<string> uses by default
+            benchmark::DoNotOptimize(_Hash_array_representation(key.data(), key.size()));
+        } else {
+            // What hash<string> uses with _USE_STD_FAST_STRING_HASH
+            benchmark::DoNotOptimize(__std_hash_bytes(key.data(), key.size()));
+        }
+    }
+
+}
+
+void common_args(benchmark::Benchmark* const bm) {
+    bm->Arg(3)->Arg(8)->Arg(15)->Arg(24)->Arg(40)->Arg(100)->Arg(200)->Arg(1000)->Arg(5000);
+}
+
+BENCHMARK(bm<Alg::fnv1a>)->Apply(common_args);
+BENCHMARK(bm<Alg::fast>)->Apply(common_args);
+
+BENCHMARK_MAIN();
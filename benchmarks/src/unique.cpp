@@ -10,12 +10,15 @@
 #include <type_traits>
 #include <vector>
 
+#include "isa_levels.hpp"
 #include "skewed_allocator.hpp"
 
 enum class alg_type { std_fn, rng };
 
 template <alg_type Type, class T>
 void u(benchmark::State& state) {
+    isa_level_guard guard{state, state.range(0)};
+
     std::mt19937_64 gen(22033);
     using TD = std::conditional_t<sizeof(T) == 1, int, T>;
     std::binomial_distribution<TD> dis(5);
@@ -40,6 +43,8 @@ void u(benchmark::State& state) {
 
 template <alg_type Type, class T>
 void uc(benchmark::State& state) {
+    isa_level_guard guard{state, state.range(0)};
+
     std::mt19937_64 gen(22033);
     using TD = std::conditional_t<sizeof(T) == 1, int, T>;
     std::binomial_distribution<TD> dis(5);
@@ -59,24 +64,24 @@ void uc(benchmark::State& state) {
     }
 }
 
-BENCHMARK(u<alg_type::std_fn, std::uint8_t>);
-BENCHMARK(u<alg_type::std_fn, std::uint16_t>);
-BENCHMARK(u<alg_type::std_fn, std::uint32_t>);
-BENCHMARK(u<alg_type::std_fn, std::uint64_t>);
-
-BENCHMARK(u<alg_type::rng, std::uint8_t>);
-BENCHMARK(u<alg_type::rng, std::uint16_t>);
-BENCHMARK(u<alg_type::rng, std::uint32_t>);
-BENCHMARK(u<alg_type::rng, std::uint64_t>);
-
-BENCHMARK(uc<alg_type::std_fn, std::uint8_t>);
-BENCHMARK(uc<alg_type::std_fn, std::uint16_t>);
-BENCHMARK(uc<alg_type::std_fn, std::uint32_t>);
-BENCHMARK(uc<alg_type::std_fn, std::uint64_t>);
-
-BENCHMARK(uc<alg_type::rng, std::uint8_t>);
-BENCHMARK(uc<alg_type::rng, std::uint16_t>);
-BENCHMARK(uc<alg_type::rng, std::uint32_t>);
-BENCHMARK(uc<alg_type::rng, std::uint64_t>);
+BENCHMARK(u<alg_type::std_fn, std::uint8_t>)->Apply(isa_level_args);
+BENCHMARK(u<alg_type::std_fn, std::uint16_t>)->Apply(isa_level_args);
+BENCHMARK(u<alg_type::std_fn, std::uint32_t>)->Apply(isa_level_args);
+BENCHMARK(u<alg_type::std_fn, std::uint64_t>)->Apply(isa_level_args);
+
+BENCHMARK(u<alg_type::rng, std::uint8_t>)->Apply(isa_level_args);
+BENCHMARK(u<alg_type::rng, std::uint16_t>)->Apply(isa_level_args);
+BENCHMARK(u<alg_type::rng, std::uint32_t>)->Apply(isa_level_args);
+BENCHMARK(u<alg_type::rng, std::uint64_t>)->Apply(isa_level_args);
+
+BENCHMARK(uc<alg_type::std_fn, std::uint8_t>)->Apply(isa_level_args);
+BENCHMARK(uc<alg_type::std_fn, std::uint16_t>)->Apply(isa_level_args);
+BENCHMARK(uc<alg_type::std_fn, std::uint32_t>)->Apply(isa_level_args);
+BENCHMARK(uc<alg_type::std_fn, std::uint64_t>)->Apply(isa_level_args);
+
+BENCHMARK(uc<alg_type::rng, std::uint8_t>)->Apply(isa_level_args);
+BENCHMARK(uc<alg_type::rng, std::uint16_t>)->Apply(isa_level_args);
+BENCHMARK(uc<alg_type::rng, std::uint32_t>)->Apply(isa_level_args);
+BENCHMARK(uc<alg_type::rng, std::uint64_t>)->Apply(isa_level_args);
 
 BENCHMARK_MAIN();
@@ -83,6 +83,8 @@
 #include <exception>
 #include <expected>
 #include <filesystem>
+#include <flat_hash_map>
+#include <flat_hash_set>
 #include <flat_map>
 #include <flat_set>
 #include <format>
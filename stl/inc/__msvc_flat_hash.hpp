@@ -0,0 +1,982 @@
+// __msvc_flat_hash.hpp internal header
+
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef __MSVC_FLAT_HASH_HPP
+#define __MSVC_FLAT_HASH_HPP
+#include <yvals_core.h>
+#if _STL_COMPILER_PREPROCESSOR
+
+#include <__msvc_bit_utils.hpp>
+#include <xhash>
+
+#if _HAS_CXX17
+#if ((defined(_M_IX86) && _M_IX86_FP >= 2) || (defined(_M_X64) && !defined(_M_ARM64EC))) && !defined(_M_CEE)
+#define _FLAT_HASH_USE_SSE2 1
+#include <emmintrin.h>
+#else // ^^^ SSE2 available / SSE2 unavailable vvv
+#define _FLAT_HASH_USE_SSE2 0
+#endif // ^^^ SSE2 unavailable ^^^
+#endif // _HAS_CXX17
+
+#pragma pack(push, _CRT_PACKING)
+#pragma warning(push, _STL_WARNING_LEVEL)
+#pragma warning(disable : _STL_DISABLED_WARNINGS)
+_STL_DISABLE_CLANG_WARNINGS
+#pragma push_macro("new")
+#undef new
+
+#if _HAS_CXX17
+_STD_BEGIN
+// _Flat_hash is an open-addressing hash table that stores its elements in one array of slots, next to an array of
+// control bytes with one byte per slot. A full slot's byte holds the low 7 bits of its element's hash (so it is
+// non-negative), and lookups compare a whole group of 16 control bytes against those 7 bits at once, so that most
+// probes touch one cache line of control bytes and, on a hit, one slot.
+//
+// Capacities are 2^n - 1. The control byte at index _Capacity is a sentinel that ends iteration, and the
+// _Flat_hash_group_width - 1 bytes after it mirror the first bytes of the table, so that a group can be loaded at any
+// slot index without wrapping around.
+
+using _Flat_hash_ctrl = signed char;
+
+_INLINE_VAR constexpr _Flat_hash_ctrl _Flat_hash_empty    = -128;
+_INLINE_VAR constexpr _Flat_hash_ctrl _Flat_hash_deleted  = -2;
+_INLINE_VAR constexpr _Flat_hash_ctrl _Flat_hash_sentinel = -1;
+
+_INLINE_VAR constexpr size_t _Flat_hash_group_width = 16;
+
+// the control bytes of a table without slots: lookups stop at the first group and begin() == end()
+alignas(_Flat_hash_group_width) _INLINE_VAR constexpr _Flat_hash_ctrl
+    _Flat_hash_empty_group[_Flat_hash_group_width] = {_Flat_hash_sentinel, _Flat_hash_empty, _Flat_hash_empty,
+        _Flat_hash_empty, _Flat_hash_empty, _Flat_hash_empty, _Flat_hash_empty, _Flat_hash_empty, _Flat_hash_empty,
+        _Flat_hash_empty, _Flat_hash_empty, _Flat_hash_empty, _Flat_hash_empty, _Flat_hash_empty, _Flat_hash_empty,
+        _Flat_hash_empty};
+
+class _Flat_hash_group { // _Flat_hash_group_width consecutive control bytes, matched into masks of one bit per byte
+public:
+    explicit _Flat_hash_group(const _Flat_hash_ctrl* const _Pos) noexcept
+#if _FLAT_HASH_USE_SSE2
+        : _Ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(_Pos))) {
+    }
+#else // ^^^ _FLAT_HASH_USE_SSE2 / !_FLAT_HASH_USE_SSE2 vvv
+    {
+        _CSTD memcpy(_Ctrl, _Pos, _Flat_hash_group_width);
+    }
+#endif // ^^^ !_FLAT_HASH_USE_SSE2 ^^^
+
+    _NODISCARD unsigned int _Match(const _Flat_hash_ctrl _Hash2) const noexcept { // bytes equal to _Hash2
+#if _FLAT_HASH_USE_SSE2
+        return static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(_Hash2), _Ctrl)));
+#else // ^^^ _FLAT_HASH_USE_SSE2 / !_FLAT_HASH_USE_SSE2 vvv
+        unsigned int _Mask = 0;
+        for (size_t _Idx = 0; _Idx != _Flat_hash_group_width; ++_Idx) {
+            _Mask |= static_cast<unsigned int>(_Ctrl[_Idx] == _Hash2) << _Idx;
+        }
+
+        return _Mask;
+#endif // ^^^ !_FLAT_HASH_USE_SSE2 ^^^
+    }
+
+    _NODISCARD unsigned int _Match_empty() const noexcept {
+        return _Match(_Flat_hash_empty);
+    }
+
+    _NODISCARD unsigned int _Match_empty_or_deleted() const noexcept { // bytes below _Flat_hash_sentinel
+#if _FLAT_HASH_USE_SSE2
+        return static_cast<unsigned int>(
+            _mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(_Flat_hash_sentinel), _Ctrl)));
+#else // ^^^ _FLAT_HASH_USE_SSE2 / !_FLAT_HASH_USE_SSE2 vvv
+        unsigned int _Mask = 0;
+        for (size_t _Idx = 0; _Idx != _Flat_hash_group_width; ++_Idx) {
+            _Mask |= static_cast<unsigned int>(_Ctrl[_Idx] < _Flat_hash_sentinel) << _Idx;
+        }
+
+        return _Mask;
+#endif // ^^^ !_FLAT_HASH_USE_SSE2 ^^^
+    }
+
+    _NODISCARD size_t _Count_leading_empty_or_deleted() const noexcept {
+        // adding 1 turns the trailing ones into zeros; the mask has _Flat_hash_group_width bits, so the sum is nonzero
+        return static_cast<size_t>(_STD _Countr_zero(_Match_empty_or_deleted() + 1));
+    }
+
+private:
+#if _FLAT_HASH_USE_SSE2
+    __m128i _Ctrl;
+#else // ^^^ _FLAT_HASH_USE_SSE2 / !_FLAT_HASH_USE_SSE2 vvv
+    _Flat_hash_ctrl _Ctrl[_Flat_hash_group_width];
+#endif // ^^^ !_FLAT_HASH_USE_SSE2 ^^^
+};
+
+template <class _Ty>
+class _Flat_hash_const_iterator {
+public:
+    using iterator_category = forward_iterator_tag;
+    using value_type        = _Ty;
+    using difference_type   = ptrdiff_t;
+    using pointer           = const _Ty*;
+    using reference         = const _Ty&;
+
+    _Flat_hash_const_iterator() noexcept = default;
+
+    _Flat_hash_const_iterator(const _Flat_hash_ctrl* const _Ctrl_, _Ty* const _Slot_) noexcept
+        : _Ctrl(_Ctrl_), _Slot(_Slot_) {}
+
+    _NODISCARD reference operator*() const noexcept {
+#if _ITERATOR_DEBUG_LEVEL == 2
+        _STL_VERIFY(_Ctrl, "cannot dereference value-initialized flat hash iterator");
+        _STL_VERIFY(*_Ctrl >= 0, "cannot dereference end flat hash iterator");
+#endif // _ITERATOR_DEBUG_LEVEL == 2
+
+        return *_Slot;
+    }
+
+    _NODISCARD pointer operator->() const noexcept {
+        return _STD addressof(**this);
+    }
+
+    _Flat_hash_const_iterator& operator++() noexcept {
+#if _ITERATOR_DEBUG_LEVEL == 2
+        _STL_VERIFY(_Ctrl, "cannot increment value-initialized flat hash iterator");
+        _STL_VERIFY(*_Ctrl != _Flat_hash_sentinel, "cannot increment end flat hash iterator");
+#endif // _ITERATOR_DEBUG_LEVEL == 2
+
+        ++_Ctrl;
+        ++_Slot;
+        _Skip_empty_or_deleted();
+        return *this;
+    }
+
+    _Flat_hash_const_iterator operator++(int) noexcept {
+        _Flat_hash_const_iterator _Tmp = *this;
+        ++*this;
+        return _Tmp;
+    }
+
+    _NODISCARD bool operator==(const _Flat_hash_const_iterator& _Right) const noexcept {
+        return _Ctrl == _Right._Ctrl;
+    }
+
+#if !_HAS_CXX20
+    _NODISCARD bool operator!=(const _Flat_hash_const_iterator& _Right) const noexcept {
+        return _Ctrl != _Right._Ctrl;
+    }
+#endif // !_HAS_CXX20
+
+    void _Skip_empty_or_deleted() noexcept { // advance to the next full slot or the sentinel
+        while (*_Ctrl < _Flat_hash_sentinel) {
+            const size_t _Shift = _Flat_hash_group{_Ctrl}._Count_leading_empty_or_deleted();
+            _Ctrl += _Shift;
+            _Slot += _Shift;
+        }
+    }
+
+    const _Flat_hash_ctrl* _Ctrl = nullptr;
+    _Ty* _Slot                   = nullptr;
+};
+
+template <class _Ty>
+class _Flat_hash_iterator : public _Flat_hash_const_iterator<_Ty> {
+public:
+    using _Mybase           = _Flat_hash_const_iterator<_Ty>;
+    using iterator_category = forward_iterator_tag;
+    using value_type        = _Ty;
+    using difference_type   = ptrdiff_t;
+    using pointer           = _Ty*;
+    using reference         = _Ty&;
+
+    using _Mybase::_Mybase;
+
+    _NODISCARD reference operator*() const noexcept {
+        return const_cast<reference>(_Mybase::operator*());
+    }
+
+    _NODISCARD pointer operator->() const noexcept {
+        return const_cast<pointer>(_Mybase::operator->());
+    }
+
+    _Flat_hash_iterator& operator++() noexcept {
+        _Mybase::operator++();
+        return *this;
+    }
+
+    _Flat_hash_iterator operator++(int) noexcept {
+        _Flat_hash_iterator _Tmp = *this;
+        _Mybase::operator++();
+        return _Tmp;
+    }
+};
+
+template <class _Ty>
+struct _Flat_hash_storage {
+    _Flat_hash_ctrl* _Ctrl = const_cast<_Flat_hash_ctrl*>(_Flat_hash_empty_group);
+    _Ty* _Slots            = nullptr;
+    size_t _Capacity       = 0; // 0 or 2^n - 1 with n >= 4
+    size_t _Size           = 0;
+    size_t _Growth_left    = 0; // number of empty slots that can still be filled before a rehash
+};
+
+template <class _Traits>
+class _Flat_hash { // open-addressing hash table, elements move when the table rehashes
+protected:
+    using _Mutable_value_type = typename _Traits::_Mutable_value_type;
+    using _Key_compare        = typename _Traits::key_compare;
+    using _Alty               = _Rebind_alloc_t<typename _Traits::allocator_type, typename _Traits::value_type>;
+    using _Alty_traits        = allocator_traits<_Alty>;
+    using _Alctrl             = _Rebind_alloc_t<_Alty, _Flat_hash_ctrl>;
+    using _Alctrl_traits      = allocator_traits<_Alctrl>;
+    using _Storage            = _Flat_hash_storage<typename _Traits::value_type>;
+
+    static_assert(is_same_v<typename _Alty_traits::pointer, typename _Traits::value_type*>,
+        "flat_hash_map and flat_hash_set require an allocator whose pointer type is a raw pointer.");
+
+public:
+    using key_type        = typename _Traits::key_type;
+    using value_type      = typename _Traits::value_type;
+    using allocator_type  = typename _Traits::allocator_type;
+    using size_type       = size_t;
+    using difference_type = ptrdiff_t;
+    using pointer         = typename _Alty_traits::pointer;
+    using const_pointer   = typename _Alty_traits::const_pointer;
+    using reference       = value_type&;
+    using const_reference = const value_type&;
+
+    using iterator       = conditional_t<is_same_v<key_type, value_type>, _Flat_hash_const_iterator<value_type>,
+        _Flat_hash_iterator<value_type>>;
+    using const_iterator = _Flat_hash_const_iterator<value_type>;
+
+    static constexpr size_type _Min_capacity = _Flat_hash_group_width - 1;
+
+protected:
+    _Flat_hash(const _Key_compare& _Parg, const allocator_type& _Al)
+        : _Traitsobj(_Parg), _Mypair(_One_then_variadic_args_t{}, _Al) {}
+
+    template <class _Any_alloc>
+    _Flat_hash(const _Flat_hash& _Right, const _Any_alloc& _Al)
+        : _Traitsobj(_Right._Traitsobj), _Mypair(_One_then_variadic_args_t{}, static_cast<_Alty>(_Al)) {
+        // construct hash table by copying _Right
+        _TRY_BEGIN
+        _Copy_elements(_Right);
+        _CATCH_ALL
+        _Tidy();
+        _RERAISE;
+        _CATCH_END
+    }
+
+    _Flat_hash(_Flat_hash&& _Right) noexcept(is_nothrow_copy_constructible_v<_Traits>)
+        : _Traitsobj(_Right._Traitsobj), _Mypair(_One_then_variadic_args_t{}, _STD move(_Right._Getal())) {
+        _Mypair._Myval2 = _STD exchange(_Right._Mypair._Myval2, _Storage{});
+    }
+
+    _Flat_hash(_Flat_hash&& _Right, const allocator_type& _Al)
+        : _Traitsobj(_Right._Traitsobj), _Mypair(_One_then_variadic_args_t{}, _Al) {
+        // construct hash table by moving _Right, allocator
+        if constexpr (!_Alty_traits::is_always_equal::value) {
+            if (_Getal() != _Right._Getal()) {
+                _TRY_BEGIN
+                _Move_elements(_Right);
+                _CATCH_ALL
+                _Tidy();
+                _RERAISE;
+                _CATCH_END
+                return;
+            }
+        }
+
+        _Mypair._Myval2 = _STD exchange(_Right._Mypair._Myval2, _Storage{});
+    }
+
+public:
+    ~_Flat_hash() noexcept {
+        _Tidy();
+    }
+
+    _Flat_hash& operator=(const _Flat_hash& _Right) {
+        if (this == _STD addressof(_Right)) {
+            return *this;
+        }
+
+        clear();
+        if constexpr (_Choose_pocca_v<_Alty>) {
+            if (_Getal() != _Right._Getal()) {
+                _Tidy();
+            }
+        }
+
+        _Pocca(_Getal(), _Right._Getal());
+        _Traitsobj = _Right._Traitsobj;
+        _Copy_elements(_Right);
+        return *this;
+    }
+
+    _Flat_hash& operator=(_Flat_hash&& _Right) noexcept(
+        _Choose_pocma_v<_Alty> != _Pocma_values::_No_propagate_allocators && is_nothrow_copy_assignable_v<_Traits>) {
+        if (this == _STD addressof(_Right)) {
+            return *this;
+        }
+
+        _Traitsobj = _Right._Traitsobj;
+        if constexpr (_Choose_pocma_v<_Alty> == _Pocma_values::_No_propagate_allocators) {
+            if (_Getal() != _Right._Getal()) {
+                clear();
+                _Move_elements(_Right);
+                return *this;
+            }
+        }
+
+        _Tidy();
+        _Pocma(_Getal(), _Right._Getal());
+        _Mypair._Myval2 = _STD exchange(_Right._Mypair._Myval2, _Storage{});
+        return *this;
+    }
+
+    template <class... _Valtys>
+    pair<iterator, bool> emplace(_Valtys&&... _Vals) { // try to insert value_type(_Vals...)
+        using _In_place_key_extractor = typename _Traits::template _In_place_key_extractor<_Valtys...>;
+        if constexpr (_In_place_key_extractor::_Extractable) {
+            const auto& _Keyval = _In_place_key_extractor::_Extract(_Vals...);
+            const size_t _Hashval = _Traitsobj(_Keyval);
+            const auto _Found     = _Find_index(_Keyval, _Hashval);
+            if (_Found != _Mypair._Myval2._Capacity) {
+                return {_Make_iter(_Found), false};
+            }
+
+            return {_Make_iter(_Emplace_new(_Hashval, _STD forward<_Valtys>(_Vals)...)), true};
+        } else {
+            _Alloc_temporary2<_Alty> _Tmp(_Getal(), _STD forward<_Valtys>(_Vals)...);
+            const auto& _Keyval   = _Traits::_Kfn(_Tmp._Get_value());
+            const size_t _Hashval = _Traitsobj(_Keyval);
+            const auto _Found     = _Find_index(_Keyval, _Hashval);
+            if (_Found != _Mypair._Myval2._Capacity) {
+                return {_Make_iter(_Found), false};
+            }
+
+            return {_Make_iter(_Emplace_new(_Hashval, reinterpret_cast<_Mutable_value_type&&>(_Tmp._Get_value()))),
+                true};
+        }
+    }
+
+    template <class... _Valtys>
+    iterator emplace_hint(const_iterator, _Valtys&&... _Vals) { // try to insert value_type(_Vals...), hint ignored
+        return emplace(_STD forward<_Valtys>(_Vals)...).first;
+    }
+
+    pair<iterator, bool> insert(const value_type& _Val) {
+        return emplace(_Val);
+    }
+
+    pair<iterator, bool> insert(value_type&& _Val) {
+        return emplace(_STD move(_Val));
+    }
+
+    iterator insert(const_iterator, const value_type& _Val) {
+        return emplace(_Val).first;
+    }
+
+    iterator insert(const_iterator, value_type&& _Val) {
+        return emplace(_STD move(_Val)).first;
+    }
+
+    template <class _Iter>
+    void insert(_Iter _First, _Iter _Last) {
+        _STD _Adl_verify_range(_First, _Last);
+        auto _UFirst      = _STD _Get_unwrapped(_First);
+        const auto _ULast = _STD _Get_unwrapped(_Last);
+        if constexpr (_Is_cpp17_fwd_iter_v<_Iter>) {
+            reserve(_Mypair._Myval2._Size + static_cast<size_type>(_STD distance(_UFirst, _ULast)));
+        }
+
+        for (; _UFirst != _ULast; ++_UFirst) {
+            emplace(*_UFirst);
+        }
+    }
+
+    void insert(initializer_list<value_type> _Ilist) {
+        insert(_Ilist.begin(), _Ilist.end());
+    }
+
+    template <class _Iter = iterator, enable_if_t<!is_same_v<_Iter, const_iterator>, int> = 0>
+    iterator erase(iterator _Plist) noexcept /* strengthened */ {
+        return _Erase_at(_Plist);
+    }
+
+    iterator erase(const_iterator _Plist) noexcept /* strengthened */ {
+        return _Erase_at(_Plist);
+    }
+
+    iterator erase(const_iterator _First, const_iterator _Last) noexcept /* strengthened */ {
+        // erasing never moves other elements, so _Last stays valid
+        for (; _First != _Last; ++_First) {
+            _Erase_index(_Index_of(_First));
+        }
+
+        return _Make_iter(_Index_of(_Last));
+    }
+
+    size_type erase(const key_type& _Keyval) {
+        const auto _Found = _Find_index(_Keyval, _Traitsobj(_Keyval));
+        if (_Found == _Mypair._Myval2._Capacity) {
+            return 0;
+        }
+
+        _Erase_index(_Found);
+        return 1;
+    }
+
+    void clear() noexcept {
+        auto& _Data = _Mypair._Myval2;
+        if (_Data._Size != 0) {
+            _Destroy_elements();
+        }
+
+        if (_Data._Capacity != 0) {
+            _Reset_ctrl(_Data._Ctrl, _Data._Capacity);
+            _Data._Size        = 0;
+            _Data._Growth_left = _Capacity_to_growth(_Data._Capacity);
+        }
+    }
+
+    void swap(_Flat_hash& _Right) noexcept(noexcept(_Traitsobj.swap(_Right._Traitsobj))) /* strengthened */ {
+        if (this != _STD addressof(_Right)) {
+            _Pocs(_Getal(), _Right._Getal());
+            _STD swap(_Mypair._Myval2, _Right._Mypair._Myval2);
+            _Traitsobj.swap(_Right._Traitsobj);
+        }
+    }
+
+    _NODISCARD iterator find(const key_type& _Keyval) {
+        return _Make_iter(_Find_index(_Keyval, _Traitsobj(_Keyval)));
+    }
+
+    _NODISCARD const_iterator find(const key_type& _Keyval) const {
+        return _Make_iter(_Find_index(_Keyval, _Traitsobj(_Keyval)));
+    }
+
+    _NODISCARD size_type count(const key_type& _Keyval) const {
+        return _Find_index(_Keyval, _Traitsobj(_Keyval)) != _Mypair._Myval2._Capacity;
+    }
+
+    _NODISCARD bool contains(const key_type& _Keyval) const {
+        return _Find_index(_Keyval, _Traitsobj(_Keyval)) != _Mypair._Myval2._Capacity;
+    }
+
+    _NODISCARD pair<iterator, iterator> equal_range(const key_type& _Keyval) {
+        return _Equal_range(_Find_index(_Keyval, _Traitsobj(_Keyval)));
+    }
+
+    _NODISCARD pair<const_iterator, const_iterator> equal_range(const key_type& _Keyval) const {
+        return _Equal_range(_Find_index(_Keyval, _Traitsobj(_Keyval)));
+    }
+
+#if _HAS_CXX20
+    template <class _Kx, class _Mytraits = _Traits, enable_if_t<_Mytraits::_Has_transparent_overloads, int> = 0>
+    _NODISCARD iterator find(const _Kx& _Keyval) {
+        return _Make_iter(_Find_index(_Keyval, _Traitsobj(_Keyval)));
+    }
+
+    template <class _Kx, class _Mytraits = _Traits, enable_if_t<_Mytraits::_Has_transparent_overloads, int> = 0>
+    _NODISCARD const_iterator find(const _Kx& _Keyval) const {
+        return _Make_iter(_Find_index(_Keyval, _Traitsobj(_Keyval)));
+    }
+
+    template <class _Kx, class _Mytraits = _Traits, enable_if_t<_Mytraits::_Has_transparent_overloads, int> = 0>
+    _NODISCARD size_type count(const _Kx& _Keyval) const {
+        return _Find_index(_Keyval, _Traitsobj(_Keyval)) != _Mypair._Myval2._Capacity;
+    }
+
+    template <class _Kx, class _Mytraits = _Traits, enable_if_t<_Mytraits::_Has_transparent_overloads, int> = 0>
+    _NODISCARD bool contains(const _Kx& _Keyval) const {
+        return _Find_index(_Keyval, _Traitsobj(_Keyval)) != _Mypair._Myval2._Capacity;
+    }
+
+    template <class _Kx, class _Mytraits = _Traits, enable_if_t<_Mytraits::_Has_transparent_overloads, int> = 0>
+    _NODISCARD pair<iterator, iterator> equal_range(const _Kx& _Keyval) {
+        return _Equal_range(_Find_index(_Keyval, _Traitsobj(_Keyval)));
+    }
+
+    template <class _Kx, class _Mytraits = _Traits, enable_if_t<_Mytraits::_Has_transparent_overloads, int> = 0>
+    _NODISCARD pair<const_iterator, const_iterator> equal_range(const _Kx& _Keyval) const {
+        return _Equal_range(_Find_index(_Keyval, _Traitsobj(_Keyval)));
+    }
+#endif // _HAS_CXX20
+
+    _NODISCARD iterator begin() noexcept {
+        iterator _First{_Mypair._Myval2._Ctrl, _Mypair._Myval2._Slots};
+        _First._Skip_empty_or_deleted();
+        return _First;
+    }
+
+    _NODISCARD const_iterator begin() const noexcept {
+        const_iterator _First{_Mypair._Myval2._Ctrl, _Mypair._Myval2._Slots};
+        _First._Skip_empty_or_deleted();
+        return _First;
+    }
+
+    _NODISCARD iterator end() noexcept {
+        return _Make_iter(_Mypair._Myval2._Capacity);
+    }
+
+    _NODISCARD const_iterator end() const noexcept {
+        return _Make_iter(_Mypair._Myval2._Capacity);
+    }
+
+    _NODISCARD const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    _NODISCARD const_iterator cend() const noexcept {
+        return end();
+    }
+
+    _NODISCARD size_type size() const noexcept {
+        return _Mypair._Myval2._Size;
+    }
+
+    _NODISCARD size_type max_size() const noexcept {
+        constexpr auto _Diff_max = static_cast<size_type>(_STD _Max_limit<difference_type>());
+        return _Capacity_to_growth((_STD min) (_Diff_max, _Alty_traits::max_size(_Getal())));
+    }
+
+    _NODISCARD_EMPTY_MEMBER bool empty() const noexcept {
+        return _Mypair._Myval2._Size == 0;
+    }
+
+    _NODISCARD allocator_type get_allocator() const noexcept {
+        return static_cast<allocator_type>(_Getal());
+    }
+
+    _NODISCARD size_type bucket_count() const noexcept { // the number of slots
+        return _Mypair._Myval2._Capacity;
+    }
+
+    _NODISCARD float load_factor() const noexcept {
+        const auto& _Data = _Mypair._Myval2;
+        return _Data._Capacity == 0 ? 0.0f : static_cast<float>(_Data._Size) / static_cast<float>(_Data._Capacity);
+    }
+
+    _NODISCARD float max_load_factor() const noexcept {
+        return 0.875f;
+    }
+
+    void max_load_factor(float) noexcept {
+        // the maximum load factor is fixed; the probing scheme relies on at least one empty slot in every table
+    }
+
+    void rehash(const size_type _Buckets) { // rebuild the table with at least _Buckets slots
+        auto& _Data = _Mypair._Myval2;
+        if (_Buckets == 0 && _Data._Size == 0) {
+            _Tidy();
+            return;
+        }
+
+        const auto _New_capacity = (_STD max) (_Normalize_capacity(_Buckets), _Growth_to_capacity(_Data._Size));
+        if (_New_capacity != _Data._Capacity
+            || _Data._Growth_left != _Capacity_to_growth(_Data._Capacity) - _Data._Size) {
+            // resizing also reclaims the slots of erased elements
+            _Resize(_New_capacity);
+        }
+    }
+
+    void reserve(const size_type _Maxcount) { // make room for _Maxcount elements without further rehashing
+        const auto& _Data = _Mypair._Myval2;
+        if (_Maxcount > _Data._Size + _Data._Growth_left) {
+            _Resize(_Growth_to_capacity(_Maxcount));
+        }
+    }
+
+protected:
+    template <class _Keyty>
+    _NODISCARD size_type _Find_index(const _Keyty& _Keyval, const size_t _Hashval) const
+        noexcept(_Nothrow_compare<_Key_compare, _Keyty, key_type>) {
+        // returns the index of the element equal to _Keyval, or _Capacity if there is none
+        const auto& _Data     = _Mypair._Myval2;
+        const auto _Hash2val  = _Hash2(_Hashval);
+        size_type _Offset     = _Hash1(_Hashval) & _Data._Capacity;
+        size_type _Probe_step = 0;
+        for (;;) {
+            const _Flat_hash_group _Group{_Data._Ctrl + _Offset};
+            for (auto _Bits = _Group._Match(_Hash2val); _Bits != 0; _Bits &= _Bits - 1) {
+                const size_type _Idx = (_Offset + static_cast<size_type>(_STD _Countr_zero(_Bits))) & _Data._Capacity;
+                if (!_Traitsobj(_Keyval, _Traits::_Kfn(_Data._Slots[_Idx]))) {
+                    return _Idx;
+                }
+            }
+
+            if (_Group._Match_empty() != 0) { // an insertion would have stopped here
+                return _Data._Capacity;
+            }
+
+            _Probe_step += _Flat_hash_group_width;
+            _Offset = (_Offset + _Probe_step) & _Data._Capacity;
+        }
+    }
+
+    _NODISCARD size_type _Find_first_non_full(const size_t _Hashval) const noexcept {
+        // returns the first empty or deleted slot on _Hashval's probe sequence
+        const auto& _Data     = _Mypair._Myval2;
+        size_type _Offset     = _Hash1(_Hashval) & _Data._Capacity;
+        size_type _Probe_step = 0;
+        for (;;) {
+            const auto _Bits = _Flat_hash_group{_Data._Ctrl + _Offset}._Match_empty_or_deleted();
+            if (_Bits != 0) {
+                return (_Offset + static_cast<size_type>(_STD _Countr_zero(_Bits))) & _Data._Capacity;
+            }
+
+            _Probe_step += _Flat_hash_group_width;
+            _Offset = (_Offset + _Probe_step) & _Data._Capacity;
+        }
+    }
+
+    template <class... _Valtys>
+    size_type _Emplace_new(const size_t _Hashval, _Valtys&&... _Vals) {
+        // construct an element whose key isn't in the table yet, returning its index
+        auto& _Data = _Mypair._Myval2;
+        if (_Data._Size == max_size()) {
+            _Xlength_error("flat_hash_map/set too long");
+        }
+
+        auto _Target = _Find_first_non_full(_Hashval);
+        if (_Data._Growth_left == 0 && _Data._Ctrl[_Target] != _Flat_hash_deleted) {
+            // _Vals may refer to elements of *this, so construct the new element before the rehash moves them
+            _Alloc_temporary2<_Alty> _Tmp(_Getal(), _STD forward<_Valtys>(_Vals)...);
+            _Rehash_and_grow_if_necessary();
+            _Target = _Find_first_non_full(_Hashval);
+            _Construct_in_slot(_Target, _Hashval, reinterpret_cast<_Mutable_value_type&&>(_Tmp._Get_value()));
+        } else {
+            _Construct_in_slot(_Target, _Hashval, _STD forward<_Valtys>(_Vals)...);
+        }
+
+        return _Target;
+    }
+
+    template <class... _Valtys>
+    void _Construct_in_slot(const size_type _Idx, const size_t _Hashval, _Valtys&&... _Vals) {
+        // construct an element in the empty or deleted slot _Idx
+        auto& _Data = _Mypair._Myval2;
+        _Alty_traits::construct(_Getal(), _Data._Slots + _Idx, _STD forward<_Valtys>(_Vals)...);
+        _Data._Growth_left -= _Data._Ctrl[_Idx] == _Flat_hash_empty;
+        _Set_ctrl(_Idx, _Hash2(_Hashval));
+        ++_Data._Size;
+    }
+
+    _NODISCARD iterator _Make_iter(const size_type _Idx) const noexcept {
+        const auto& _Data = _Mypair._Myval2;
+        return iterator{_Data._Ctrl + _Idx, _Data._Slots + _Idx};
+    }
+
+    _NODISCARD size_type _Index_of(const const_iterator _Where) const noexcept {
+        return static_cast<size_type>(_Where._Ctrl - _Mypair._Myval2._Ctrl);
+    }
+
+    _NODISCARD _Alty& _Getal() noexcept {
+        return _Mypair._Get_first();
+    }
+
+    _NODISCARD const _Alty& _Getal() const noexcept {
+        return _Mypair._Get_first();
+    }
+
+private:
+    _NODISCARD static size_t _Mix(size_t _Hashval) noexcept {
+        // spread every bit of the user's hash over the whole value; hashers like the identity hash of integers leave
+        // the high bits of nearby keys equal, which would give runs of 128 keys the same first group to probe
+#ifdef _WIN64
+        _Hashval ^= _Hashval >> 32;
+        _Hashval *= 0x9E3779B97F4A7C15ULL;
+        _Hashval ^= _Hashval >> 32;
+#else // ^^^ 64-bit / 32-bit vvv
+        _Hashval ^= _Hashval >> 16;
+        _Hashval *= 0x9E3779B9U;
+        _Hashval ^= _Hashval >> 16;
+#endif // ^^^ 32-bit ^^^
+        return _Hashval;
+    }
+
+    _NODISCARD static size_t _Hash1(const size_t _Hashval) noexcept { // selects the first group to probe
+        return _Mix(_Hashval) >> 7;
+    }
+
+    _NODISCARD static _Flat_hash_ctrl _Hash2(const size_t _Hashval) noexcept { // stored in a full slot's control byte
+        return static_cast<_Flat_hash_ctrl>(_Mix(_Hashval) & 0x7F);
+    }
+
+    _NODISCARD static size_type _Capacity_to_growth(const size_type _Capacity) noexcept {
+        // at most 7/8 of the slots are full or deleted, so every probe sequence reaches an empty slot
+        return _Capacity - _Capacity / 8;
+    }
+
+    _NODISCARD static size_type _Normalize_capacity(const size_type _Buckets) noexcept {
+        size_type _Capacity = _Min_capacity;
+        while (_Capacity < _Buckets) {
+            _Capacity = _Capacity * 2 + 1;
+        }
+
+        return _Capacity;
+    }
+
+    _NODISCARD size_type _Growth_to_capacity(const size_type _Maxcount) const {
+        // returns the smallest capacity that holds _Maxcount elements
+        if (_Maxcount > max_size()) {
+            _Xlength_error("flat_hash_map/set too long");
+        }
+
+        size_type _Capacity = _Min_capacity;
+        while (_Capacity_to_growth(_Capacity) < _Maxcount) {
+            _Capacity = _Capacity * 2 + 1;
+        }
+
+        return _Capacity;
+    }
+
+    void _Set_ctrl(const size_type _Idx, const _Flat_hash_ctrl _Val) noexcept {
+        // also update the mirror of _Idx after the sentinel, if any; for other indices, the second store is the first
+        auto& _Data = _Mypair._Myval2;
+
+        _Data._Ctrl[_Idx]                                                        = _Val;
+        _Data._Ctrl[((_Idx - _Min_capacity) & _Data._Capacity) + _Min_capacity] = _Val;
+    }
+
+    static void _Reset_ctrl(_Flat_hash_ctrl* const _Ctrl, const size_type _Capacity) noexcept {
+        _CSTD memset(_Ctrl, static_cast<unsigned char>(_Flat_hash_empty), _Capacity + _Flat_hash_group_width);
+        _Ctrl[_Capacity] = _Flat_hash_sentinel;
+    }
+
+    iterator _Erase_at(const const_iterator _Where) noexcept {
+#if _ITERATOR_DEBUG_LEVEL == 2
+        _STL_VERIFY(_Where._Ctrl && *_Where._Ctrl >= 0, "flat hash erase iterator outside range");
+#endif // _ITERATOR_DEBUG_LEVEL == 2
+        const auto _Idx = _Index_of(_Where);
+        _Erase_index(_Idx);
+        iterator _Next = _Make_iter(_Idx);
+        _Next._Skip_empty_or_deleted();
+        return _Next;
+    }
+
+    void _Erase_index(const size_type _Idx) noexcept {
+        auto& _Data = _Mypair._Myval2;
+        _Alty_traits::destroy(_Getal(), _Data._Slots + _Idx);
+        --_Data._Size;
+
+        // A lookup passes slot _Idx only if it found a whole group without empty slots around it. If the full and
+        // deleted slots around _Idx don't span a group, no lookup has, so the slot can become empty again. In a table
+        // smaller than a group, the first group of every lookup covers the whole table, which always has an empty slot.
+        bool _Was_never_full = _Data._Capacity < _Flat_hash_group_width;
+        if (!_Was_never_full) {
+            const auto _Empty_before = static_cast<unsigned short>(
+                _Flat_hash_group{_Data._Ctrl + ((_Idx - _Flat_hash_group_width) & _Data._Capacity)}._Match_empty());
+            const auto _Empty_after = _Flat_hash_group{_Data._Ctrl + _Idx}._Match_empty();
+            _Was_never_full         = _Empty_before != 0 && _Empty_after != 0
+                           && static_cast<size_t>(_STD _Countl_zero(_Empty_before) + _STD _Countr_zero(_Empty_after))
+                                  < _Flat_hash_group_width;
+        }
+
+        if (_Was_never_full) {
+            _Set_ctrl(_Idx, _Flat_hash_empty);
+            ++_Data._Growth_left;
+        } else {
+            _Set_ctrl(_Idx, _Flat_hash_deleted);
+        }
+    }
+
+    _NODISCARD pair<iterator, iterator> _Equal_range(const size_type _Idx) const noexcept {
+        const auto _First = _Make_iter(_Idx);
+        if (_Idx == _Mypair._Myval2._Capacity) {
+            return {_First, _First};
+        }
+
+        auto _Last = _First;
+        ++_Last;
+        return {_First, _Last};
+    }
+
+    void _Rehash_and_grow_if_necessary() {
+        const auto& _Data = _Mypair._Myval2;
+        if (_Data._Capacity > _Flat_hash_group_width && _Data._Size <= _Data._Capacity / 32 * 25) {
+            // most of the missing growth is held by deleted slots, so reclaim them instead of growing
+            _Resize(_Data._Capacity);
+        } else {
+            _Resize(_Data._Capacity == 0 ? _Min_capacity : _Data._Capacity * 2 + 1);
+        }
+    }
+
+    void _Resize(const size_type _New_capacity) {
+        // move all elements to a new table of _New_capacity slots; if a hasher, allocation, or constructor throws, the
+        // container is unchanged, unless value_type isn't copyable and its move constructor threw (as in vector)
+        auto& _Data     = _Mypair._Myval2;
+        const auto _Old = _Data;
+        if constexpr (_Nothrow_hash<_Traits, key_type>) {
+            _Allocate_table(_New_capacity);
+            _TRY_BEGIN
+            for (size_type _Idx = 0; _Idx != _Old._Capacity; ++_Idx) {
+                if (_Old._Ctrl[_Idx] >= 0) {
+                    _Move_to_new_table(_Old._Slots[_Idx], _Traitsobj(_Traits::_Kfn(_Old._Slots[_Idx])));
+                }
+            }
+            _CATCH_ALL
+            _Restore_table(_Old);
+            _RERAISE;
+            _CATCH_END
+        } else if (_Old._Size == 0) {
+            _Allocate_table(_New_capacity);
+        } else {
+            // moving an element may leave it unusable, so hash every element before moving any
+            using _Alhash        = _Rebind_alloc_t<_Alty, size_t>;
+            using _Alhash_traits = allocator_traits<_Alhash>;
+            _Alhash _Al_hash(_Getal());
+            const auto _Hashes = _STD _Unfancy(_Al_hash.allocate(_Old._Size));
+            _TRY_BEGIN
+            size_type _Count = 0;
+            for (size_type _Idx = 0; _Idx != _Old._Capacity; ++_Idx) {
+                if (_Old._Ctrl[_Idx] >= 0) {
+                    _Hashes[_Count++] = _Traitsobj(_Traits::_Kfn(_Old._Slots[_Idx]));
+                }
+            }
+
+            _Allocate_table(_New_capacity);
+            _TRY_BEGIN
+            _Count = 0;
+            for (size_type _Idx = 0; _Idx != _Old._Capacity; ++_Idx) {
+                if (_Old._Ctrl[_Idx] >= 0) {
+                    _Move_to_new_table(_Old._Slots[_Idx], _Hashes[_Count++]);
+                }
+            }
+            _CATCH_ALL
+            _Restore_table(_Old);
+            _RERAISE;
+            _CATCH_END
+            _CATCH_ALL
+            _Al_hash.deallocate(_STD _Refancy<typename _Alhash_traits::pointer>(_Hashes), _Old._Size);
+            _RERAISE;
+            _CATCH_END
+
+            _Al_hash.deallocate(_STD _Refancy<typename _Alhash_traits::pointer>(_Hashes), _Old._Size);
+        }
+
+        if constexpr (
+            !conjunction_v<is_trivially_destructible<value_type>, _Uses_default_destroy<_Alty, value_type*>>) {
+            for (size_type _Idx = 0; _Idx != _Old._Capacity; ++_Idx) {
+                if (_Old._Ctrl[_Idx] >= 0) {
+                    _Alty_traits::destroy(_Getal(), _Old._Slots + _Idx);
+                }
+            }
+        }
+
+        _Deallocate_table(_Old);
+    }
+
+    void _Move_to_new_table(value_type& _Val, const size_t _Hashval) {
+        // copy or move _Val from the old table into the one being filled, copying if moving could throw
+        _Construct_in_slot(_Find_first_non_full(_Hashval), _Hashval,
+            _STD move_if_noexcept(reinterpret_cast<_Mutable_value_type&>(_Val)));
+    }
+
+    void _Restore_table(const _Storage& _Old) noexcept {
+        // discard the partly filled new table and go back to _Old, whose elements are still intact
+        _Destroy_elements();
+        _Deallocate_table(_Mypair._Myval2);
+        _Mypair._Myval2 = _Old;
+    }
+
+    void _Allocate_table(const size_type _Capacity) {
+        // replace the storage with an empty table of _Capacity slots, without freeing the old one
+        _Alctrl _Al_ctrl(_Getal());
+        const auto _Ctrl = _STD _Unfancy(_Al_ctrl.allocate(_Capacity + _Flat_hash_group_width));
+        _TRY_BEGIN
+        _Mypair._Myval2._Slots = _STD _Unfancy(_Getal().allocate(_Capacity));
+        _CATCH_ALL
+        _Al_ctrl.deallocate(_STD _Refancy<typename _Alctrl_traits::pointer>(_Ctrl), _Capacity + _Flat_hash_group_width);
+        _RERAISE;
+        _CATCH_END
+
+        auto& _Data = _Mypair._Myval2;
+        _Reset_ctrl(_Ctrl, _Capacity);
+        _Data._Ctrl        = _Ctrl;
+        _Data._Capacity    = _Capacity;
+        _Data._Size        = 0;
+        _Data._Growth_left = _Capacity_to_growth(_Capacity);
+    }
+
+    void _Deallocate_table(const _Storage& _Table) noexcept {
+        if (_Table._Capacity != 0) {
+            _Alctrl _Al_ctrl(_Getal());
+            _Al_ctrl.deallocate(_STD _Refancy<typename _Alctrl_traits::pointer>(_Table._Ctrl),
+                _Table._Capacity + _Flat_hash_group_width);
+            _Getal().deallocate(_STD _Refancy<pointer>(_Table._Slots), _Table._Capacity);
+        }
+    }
+
+    void _Destroy_elements() noexcept {
+        auto& _Data = _Mypair._Myval2;
+        if constexpr (
+            !conjunction_v<is_trivially_destructible<value_type>, _Uses_default_destroy<_Alty, value_type*>>) {
+            for (size_type _Idx = 0; _Idx != _Data._Capacity; ++_Idx) {
+                if (_Data._Ctrl[_Idx] >= 0) {
+                    _Alty_traits::destroy(_Getal(), _Data._Slots + _Idx);
+                }
+            }
+        }
+    }
+
+    void _Tidy() noexcept { // free all storage
+        _Destroy_elements();
+        _Deallocate_table(_Mypair._Myval2);
+        _Mypair._Myval2 = _Storage{};
+    }
+
+    void _Copy_elements(const _Flat_hash& _Right) {
+        // copy the elements of _Right into this empty table; they are known to be unique
+        if (_Right.empty()) {
+            return;
+        }
+
+        reserve(_Right.size());
+        for (const auto& _Val : _Right) {
+            const size_t _Hashval = _Traitsobj(_Traits::_Kfn(_Val));
+            _Construct_in_slot(_Find_first_non_full(_Hashval), _Hashval, _Val);
+        }
+    }
+
+    void _Move_elements(_Flat_hash& _Right) {
+        // move the elements of _Right, which has an unequal allocator, into this empty table, then clear _Right
+        if (!_Right.empty()) {
+            reserve(_Right.size());
+            for (auto& _Val : _Right) {
+                const size_t _Hashval = _Traitsobj(_Traits::_Kfn(_Val));
+                _Construct_in_slot(
+                    _Find_first_non_full(_Hashval), _Hashval, reinterpret_cast<_Mutable_value_type&&>(_Val));
+            }
+        }
+
+        _Right.clear();
+    }
+
+protected:
+    _Traits _Traitsobj; // traits to customize behavior
+    _Compressed_pair<_Alty, _Storage> _Mypair;
+};
+
+template <class _Traits>
+_NODISCARD bool _Flat_hash_equal(const _Flat_hash<_Traits>& _Left, const _Flat_hash<_Traits>& _Right) {
+    if (_Left.size() != _Right.size()) {
+        return false;
+    }
+
+    for (const auto& _Val : _Left) {
+        const auto _Where = _Right.find(_Traits::_Kfn(_Val));
+        if (_Where == _Right.end() || !static_cast<bool>(*_Where == _Val)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+_STD_END
+#endif // _HAS_CXX17
+
+#pragma pop_macro("new")
+_STL_RESTORE_CLANG_WARNINGS
+#pragma warning(pop)
+#pragma pack(pop)
+#endif // _STL_COMPILER_PREPROCESSOR
+#endif // __MSVC_FLAT_HASH_HPP
@@ -97,6 +97,18 @@ _CONSTEXPR20 void _Pop_heap_hole_unchecked(_RanIt _First, _RanIt _Last, _RanIt _
 template <class _RanIt, class _Pr>
 _CONSTEXPR20 void _Pop_heap_unchecked(_RanIt _First, _RanIt _Last, _Pr _Pred) {
     // pop *_First to *(_Last - 1) and reheap
+#if _VECTORIZED_HEAP
+    if constexpr (_Is_min_max_iterators_safe<_RanIt>) {
+        constexpr bool _Is_greater = _Is_predicate_greater<_RanIt, _Pr>;
+        if constexpr (_Is_greater || _Is_predicate_less<_RanIt, _Pr>) {
+            if (!_STD _Is_constant_evaluated()) {
+                _STD _Pop_heap_vectorized(_STD _To_address(_First), _STD _To_address(_Last), _Is_greater);
+                return;
+            }
+        }
+    }
+#endif // ^^^ _VECTORIZED_HEAP ^^^
+
     if (2 <= _Last - _First) {
         --_Last;
         _Iter_value_t<_RanIt> _Val(_STD move(*_Last));
@@ -120,6 +132,18 @@ _CONSTEXPR20 void pop_heap(_RanIt _First, _RanIt _Last) {
 template <class _RanIt, class _Pr>
 _CONSTEXPR20 void _Make_heap_unchecked(_RanIt _First, _RanIt _Last, _Pr _Pred) {
     // make [_First, _Last) into a heap
+#if _VECTORIZED_HEAP
+    if constexpr (_Is_min_max_iterators_safe<_RanIt>) {
+        constexpr bool _Is_greater = _Is_predicate_greater<_RanIt, _Pr>;
+        if constexpr (_Is_greater || _Is_predicate_less<_RanIt, _Pr>) {
+            if (!_STD _Is_constant_evaluated()) {
+                _STD _Make_heap_vectorized(_STD _To_address(_First), _STD _To_address(_Last), _Is_greater);
+                return;
+            }
+        }
+    }
+#endif // ^^^ _VECTORIZED_HEAP ^^^
+
     using _Diff   = _Iter_diff_t<_RanIt>;
     _Diff _Bottom = _Last - _First;
     for (_Diff _Hole = _Bottom >> 1; _Hole > 0;) { // shift for codegen
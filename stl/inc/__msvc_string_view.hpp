@@ -78,6 +78,10 @@ __declspec(noalias) size_t __stdcall __std_find_last_not_of_trivial_pos_2(
     const void* _Haystack, size_t _Haystack_length, const void* _Needle, size_t _Needle_length) noexcept;
 #endif // ^^^ _VECTORIZED_FIND_LAST_OF ^^^
 
+#if _VECTORIZED_STRING_HASH
+__declspec(noalias) size_t __stdcall __std_hash_bytes(const void* _First, size_t _Count) noexcept;
+#endif // ^^^ _VECTORIZED_STRING_HASH ^^^
+
 } // extern "C"
 
 _STD_BEGIN
@@ -2108,10 +2112,19 @@ _EXPORT_STD using u16string_view = basic_string_view<char16_t>;
 _EXPORT_STD using u32string_view = basic_string_view<char32_t>;
 _EXPORT_STD using wstring_view   = basic_string_view<wchar_t>;
 
+template <class _Elem>
+_NODISCARD size_t _Hash_string_representation(const _Elem* const _First, const size_t _Count) noexcept {
+#if _USE_STD_FAST_STRING_HASH
+    return ::__std_hash_bytes(_First, _Count * sizeof(_Elem));
+#else // ^^^ _USE_STD_FAST_STRING_HASH / !_USE_STD_FAST_STRING_HASH vvv
+    return _Hash_array_representation(_First, _Count);
+#endif // ^^^ !_USE_STD_FAST_STRING_HASH ^^^
+}
+
 template <class _Elem>
 struct hash<basic_string_view<_Elem>> : _Conditionally_enabled_hash<basic_string_view<_Elem>, _Is_EcharT<_Elem>> {
     _NODISCARD static size_t _Do_hash(const basic_string_view<_Elem> _Keyval) noexcept {
-        return _Hash_array_representation(_Keyval.data(), _Keyval.size());
+        return _Hash_string_representation(_Keyval.data(), _Keyval.size());
     }
 };
 
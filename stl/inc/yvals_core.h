@@ -415,8 +415,9 @@
 // This implementation parallelizes several common algorithm calls, but not all.
 //
 // std::execution::unseq has no direct analogue for any optimizer we target as of 2020-07-29,
-// though we will map it to #pragma loop(ivdep) for the for_each algorithms only as these are the only algorithms where
-// the library does not need to introduce inter-loop-body dependencies to accomplish the algorithm's goals.
+// though we will map it to #pragma loop(ivdep) for the fill, for_each, and transform algorithms only as these are the
+// only algorithms where the library does not need to introduce inter-loop-body dependencies to accomplish the
+// algorithm's goals. (The reductions reach the vectorized kernels through the serial algorithms where those apply.)
 //
 // The following algorithms are parallelized.
 // * adjacent_difference
@@ -3,10 +3,420 @@
 
 // support for <execution>
 
+#include <atomic>
+#include <cstddef>
 #include <internal_shared.h>
+#include <memory>
+#include <new>
 #include <thread>
+#include <vector>
 #include <xatomic_wait.h>
 
+#if _STL_PARALLEL_ALGORITHMS_STD_THREAD_POOL
+// Instead of the Windows thread pool, run the parallel algorithms on a pool of std::threads. Each worker owns a
+// Chase-Lev deque: submissions from a worker go to the bottom of its own deque, idle workers steal from the top of
+// the others' deques, and submissions from threads outside the pool go through a shared injection queue.
+//
+// The number of workers defaults to one per hardware thread. The STL_STD_THREAD_POOL_WORKERS environment variable
+// overrides it at run time, and _STL_PARALLEL_ALGORITHMS_STD_THREAD_POOL_WORKERS at build time. Setting the
+// STL_STD_THREAD_POOL_AFFINITY environment variable to a nonzero number, or building with
+// _STL_PARALLEL_ALGORITHMS_STD_THREAD_POOL_AFFINITY=1, pins each worker to one of the process's processors.
+
+#ifndef _STL_PARALLEL_ALGORITHMS_STD_THREAD_POOL_WORKERS
+#define _STL_PARALLEL_ALGORITHMS_STD_THREAD_POOL_WORKERS 0 // one worker per hardware thread
+#endif // ^^^ !defined(_STL_PARALLEL_ALGORITHMS_STD_THREAD_POOL_WORKERS) ^^^
+
+#ifndef _STL_PARALLEL_ALGORITHMS_STD_THREAD_POOL_AFFINITY
+#define _STL_PARALLEL_ALGORITHMS_STD_THREAD_POOL_AFFINITY 0
+#endif // ^^^ !defined(_STL_PARALLEL_ALGORITHMS_STD_THREAD_POOL_AFFINITY) ^^^
+
+namespace {
+    constexpr size_t _No_worker = static_cast<size_t>(-1);
+
+    thread_local size_t _Current_worker = _No_worker; // set by each worker of the pool to its index
+
+    [[nodiscard]] size_t _Environment_count(const wchar_t* const _Name) noexcept {
+        // returns the value of the environment variable _Name, or 0 if it is unset or not a decimal number
+        constexpr DWORD _Max_digits = 6;
+        wchar_t _Buffer[_Max_digits + 1];
+        const auto _Length = GetEnvironmentVariableW(_Name, _Buffer, _Max_digits + 1);
+        if (_Length == 0 || _Length > _Max_digits) {
+            return 0;
+        }
+
+        size_t _Result = 0;
+        for (DWORD _Idx = 0; _Idx < _Length; ++_Idx) {
+            if (_Buffer[_Idx] < L'0' || _Buffer[_Idx] > L'9') {
+                return 0;
+            }
+
+            _Result = _Result * 10 + static_cast<size_t>(_Buffer[_Idx] - L'0');
+        }
+
+        return _Result;
+    }
+
+    void _Pin_current_thread(const size_t _Worker) noexcept {
+        // pin to one of the processors the process may run on, going round-robin over them by worker index
+        DWORD_PTR _Process_mask;
+        DWORD_PTR _System_mask;
+        if (!GetProcessAffinityMask(GetCurrentProcess(), &_Process_mask, &_System_mask) || _Process_mask == 0) {
+            return;
+        }
+
+        size_t _Allowed = 0;
+        for (auto _Mask = _Process_mask; _Mask != 0; _Mask &= _Mask - 1) {
+            ++_Allowed;
+        }
+
+        auto _Mask = _Process_mask;
+        for (auto _Skip = _Worker % _Allowed; _Skip != 0; --_Skip) {
+            _Mask &= _Mask - 1; // drop the lowest allowed processor
+        }
+
+        (void) SetThreadAffinityMask(GetCurrentThread(), _Mask & (~_Mask + 1));
+    }
+
+    class [[nodiscard]] _SrwLock_guard {
+    public:
+        explicit _SrwLock_guard(SRWLOCK& _Locked_) noexcept : _Locked(&_Locked_) {
+            AcquireSRWLockExclusive(_Locked);
+        }
+
+        ~_SrwLock_guard() {
+            ReleaseSRWLockExclusive(_Locked);
+        }
+
+        _SrwLock_guard(const _SrwLock_guard&)            = delete;
+        _SrwLock_guard& operator=(const _SrwLock_guard&) = delete;
+
+    private:
+        SRWLOCK* _Locked;
+    };
+
+    struct _Pool_work { // stands in for a PTP_WORK
+        PTP_WORK_CALLBACK _Callback;
+        void* _Context;
+        _STD atomic<size_t> _Outstanding{0}; // submissions that are queued or running
+        _STD atomic<bool> _Canceled{false}; // queued submissions are dropped instead of run
+        size_t _Injected           = 0; // submissions in the injection queue, guarded by the pool's lock
+        _Pool_work* _Next_injected = nullptr;
+
+        _Pool_work(const PTP_WORK_CALLBACK _Callback_, void* const _Context_) noexcept
+            : _Callback(_Callback_), _Context(_Context_) {}
+
+        _Pool_work(const _Pool_work&)            = delete;
+        _Pool_work& operator=(const _Pool_work&) = delete;
+    };
+
+#pragma warning(push)
+#pragma warning(disable : 4324) // structure was padded due to alignment specifier
+    // A fixed capacity Chase-Lev deque, as described in "Correct and Efficient Work-Stealing for Weak Memory Models".
+    // Only the owning worker pushes and pops at the bottom; any thread can steal from the top.
+    class _Work_deque {
+    public:
+        bool _Push_bottom(_Pool_work* const _Work) noexcept { // returns false if the deque is full
+            const auto _Local_bottom = _Bottom.load(_STD memory_order_relaxed);
+            const auto _Local_top    = _Top.load(_STD memory_order_acquire);
+            if (_Local_bottom - _Local_top >= static_cast<ptrdiff_t>(_Capacity)) {
+                return false;
+            }
+
+            _Items[static_cast<size_t>(_Local_bottom) & _Mask].store(_Work, _STD memory_order_relaxed);
+            _Bottom.store(_Local_bottom + 1, _STD memory_order_release); // publishes the item to thieves
+            return true;
+        }
+
+        [[nodiscard]] _Pool_work* _Pop_bottom() noexcept {
+            const auto _Local_bottom = _Bottom.load(_STD memory_order_relaxed) - 1;
+            _Bottom.store(_Local_bottom, _STD memory_order_relaxed);
+            _STD atomic_thread_fence(_STD memory_order_seq_cst);
+            auto _Local_top = _Top.load(_STD memory_order_relaxed);
+            if (_Local_top > _Local_bottom) { // empty
+                _Bottom.store(_Local_bottom + 1, _STD memory_order_relaxed);
+                return nullptr;
+            }
+
+            auto _Work = _Items[static_cast<size_t>(_Local_bottom) & _Mask].load(_STD memory_order_relaxed);
+            if (_Local_top == _Local_bottom) { // taking the last item races with thieves
+                if (!_Top.compare_exchange_strong(
+                        _Local_top, _Local_top + 1, _STD memory_order_seq_cst, _STD memory_order_relaxed)) {
+                    _Work = nullptr;
+                }
+
+                _Bottom.store(_Local_bottom + 1, _STD memory_order_relaxed);
+            }
+
+            return _Work;
+        }
+
+        [[nodiscard]] _Pool_work* _Steal() noexcept {
+            auto _Local_top = _Top.load(_STD memory_order_acquire);
+            _STD atomic_thread_fence(_STD memory_order_seq_cst);
+            const auto _Local_bottom = _Bottom.load(_STD memory_order_acquire);
+            if (_Local_top >= _Local_bottom) { // empty
+                return nullptr;
+            }
+
+            const auto _Work = _Items[static_cast<size_t>(_Local_top) & _Mask].load(_STD memory_order_relaxed);
+            if (!_Top.compare_exchange_strong(
+                    _Local_top, _Local_top + 1, _STD memory_order_seq_cst, _STD memory_order_relaxed)) {
+                return nullptr; // lost the race with the owner or another thief
+            }
+
+            return _Work;
+        }
+
+    private:
+        static constexpr size_t _Capacity = 1024; // submissions that don't fit go to the injection queue
+        static constexpr size_t _Mask     = _Capacity - 1;
+
+        alignas(_STD hardware_destructive_interference_size) _STD atomic<ptrdiff_t> _Top{0};
+        alignas(_STD hardware_destructive_interference_size) _STD atomic<ptrdiff_t> _Bottom{0};
+        _STD atomic<_Pool_work*> _Items[_Capacity]{};
+    };
+#pragma warning(pop)
+
+    class _Std_thread_pool {
+    public:
+        _Std_thread_pool(const size_t _Requested_workers, const bool _Pin_workers)
+            : _Worker_count(_Requested_workers == 0 ? 1 : _Requested_workers),
+              _Deques(new _Work_deque[_Worker_count]), _Pin(_Pin_workers) {
+            _Workers.reserve(_Worker_count);
+            try {
+                for (size_t _Idx = 0; _Idx < _Worker_count; ++_Idx) {
+                    _Workers.emplace_back(&_Std_thread_pool::_Worker_main, this, _Idx);
+                }
+            } catch (...) {
+                // run with the workers that did start; waiting threads also run submissions, so even none is enough
+            }
+        }
+
+        _Std_thread_pool(const _Std_thread_pool&)            = delete;
+        _Std_thread_pool& operator=(const _Std_thread_pool&) = delete;
+
+        void _Submit(_Pool_work& _Work, size_t _Submissions) noexcept {
+            if (_Submissions == 0) {
+                return;
+            }
+
+            _Work._Outstanding.fetch_add(_Submissions, _STD memory_order_relaxed);
+            _Queued.fetch_add(_Submissions, _STD memory_order_relaxed);
+            const auto _Self = _Current_worker;
+            if (_Self != _No_worker) { // keep work submitted by a worker close to it
+                for (; _Submissions != 0 && _Deques[_Self]._Push_bottom(&_Work); --_Submissions) {
+                }
+            }
+
+            _SrwLock_guard _Guard{_Lock};
+            if (_Submissions != 0) {
+                if (_Work._Injected == 0) {
+                    if (_Injected_tail) {
+                        _Injected_tail->_Next_injected = &_Work;
+                    } else {
+                        _Injected_head = &_Work;
+                    }
+
+                    _Injected_tail = &_Work;
+                }
+
+                _Work._Injected += _Submissions;
+                _Injected_pending.fetch_add(_Submissions, _STD memory_order_relaxed);
+            }
+
+            WakeAllConditionVariable(&_State_changed);
+        }
+
+        void _Wait(_Pool_work& _Work, const bool _Cancel) noexcept {
+            // wait for _Work's submissions to finish, running those of them this thread can reach meanwhile so that
+            // a thread waiting on the pool (for example, a parallel algorithm nested in another one) can't starve
+            // it; running anything else here could wait on the caller itself, like a chunk of an enclosing scan
+            // spinning on the lookback of the chunk that started this nested algorithm
+            if (_Cancel) {
+                _Work._Canceled.store(true, _STD memory_order_relaxed);
+            }
+
+            while (_Work._Outstanding.load(_STD memory_order_acquire) != 0) {
+                if (_Try_take_submission_of(_Work)) {
+                    _Run(_Work);
+                    continue;
+                }
+
+                // only this thread pushes to its own deque, so only the injection queue can bring more to run
+                _SrwLock_guard _Guard{_Lock};
+                while (_Work._Outstanding.load(_STD memory_order_acquire) != 0 && _Work._Injected == 0) {
+                    SleepConditionVariableSRW(&_State_changed, &_Lock, INFINITE, 0);
+                }
+            }
+
+            _Work._Canceled.store(false, _STD memory_order_relaxed);
+        }
+
+    private:
+        void _Take_injected(_Pool_work& _Work) noexcept { // requires _Lock and _Work._Injected != 0
+            _Injected_pending.fetch_sub(1, _STD memory_order_relaxed);
+            if (--_Work._Injected != 0) {
+                return;
+            }
+
+            _Pool_work* _Prev = nullptr;
+            for (auto _Node = _Injected_head; _Node != &_Work; _Node = _Node->_Next_injected) {
+                _Prev = _Node;
+            }
+
+            (_Prev ? _Prev->_Next_injected : _Injected_head) = _Work._Next_injected;
+            if (_Injected_tail == &_Work) {
+                _Injected_tail = _Prev;
+            }
+
+            _Work._Next_injected = nullptr;
+        }
+
+        [[nodiscard]] bool _Try_take_submission_of(_Pool_work& _Work) noexcept {
+            // take one of _Work's queued submissions without taking anything else: submissions from this thread
+            // sit at the bottom of its own deque, above anything that was queued before this thread started _Work
+            const auto _Self = _Current_worker;
+            if (_Self != _No_worker) {
+                auto& _Own = _Deques[_Self];
+                if (const auto _Found = _Own._Pop_bottom()) {
+                    if (_Found == &_Work) {
+                        _Queued.fetch_sub(1, _STD memory_order_relaxed);
+                        return true;
+                    }
+
+                    (void) _Own._Push_bottom(_Found); // can't fail, as we just made room for it
+                }
+            }
+
+            if (_Injected_pending.load(_STD memory_order_relaxed) == 0) {
+                return false;
+            }
+
+            _SrwLock_guard _Guard{_Lock};
+            if (_Work._Injected == 0) {
+                return false;
+            }
+
+            _Take_injected(_Work);
+            _Queued.fetch_sub(1, _STD memory_order_relaxed);
+            return true;
+        }
+
+        [[nodiscard]] _Pool_work* _Try_take(const size_t _Self) noexcept {
+            // take a queued submission: from our own deque, then the injection queue, then by stealing
+            _Pool_work* _Work = nullptr;
+            if (_Self != _No_worker) {
+                _Work = _Deques[_Self]._Pop_bottom();
+            }
+
+            if (!_Work && _Injected_pending.load(_STD memory_order_relaxed) != 0) {
+                _SrwLock_guard _Guard{_Lock};
+                _Work = _Injected_head;
+                if (_Work) {
+                    _Take_injected(*_Work);
+                }
+            }
+
+            const auto _First_victim = _Self == _No_worker ? 0 : _Self + 1;
+            for (size_t _Idx = 0; !_Work && _Idx < _Worker_count; ++_Idx) {
+                const auto _Victim = (_First_victim + _Idx) % _Worker_count;
+                if (_Victim != _Self) {
+                    _Work = _Deques[_Victim]._Steal();
+                }
+            }
+
+            if (_Work) {
+                _Queued.fetch_sub(1, _STD memory_order_relaxed);
+            }
+
+            return _Work;
+        }
+
+        void _Run(_Pool_work& _Work) noexcept {
+            if (!_Work._Canceled.load(_STD memory_order_relaxed)) {
+                _Work._Callback(nullptr, _Work._Context, reinterpret_cast<PTP_WORK>(&_Work));
+            }
+
+            // _Work may be closed as soon as _Outstanding reaches 0, so don't touch it after that
+            _SrwLock_guard _Guard{_Lock};
+            if (_Work._Outstanding.fetch_sub(1, _STD memory_order_release) == 1) {
+                WakeAllConditionVariable(&_State_changed);
+            }
+        }
+
+        [[noreturn]] void _Worker_main(const size_t _Self) noexcept {
+            _Current_worker = _Self;
+            if (_Pin) {
+                _Pin_current_thread(_Self);
+            }
+
+            for (;;) {
+                if (const auto _Work = _Try_take(_Self)) {
+                    _Run(*_Work);
+                } else if (_Queued.load(_STD memory_order_relaxed) != 0) {
+                    _STD this_thread::yield(); // a submission is being pushed or stolen; look again shortly
+                } else {
+                    _SrwLock_guard _Guard{_Lock};
+                    while (_Queued.load(_STD memory_order_relaxed) == 0) {
+                        SleepConditionVariableSRW(&_State_changed, &_Lock, INFINITE, 0);
+                    }
+                }
+            }
+        }
+
+        size_t _Worker_count;
+        _STD unique_ptr<_Work_deque[]> _Deques;
+        bool _Pin; // whether each worker pins itself to a processor
+        _STD vector<_STD thread> _Workers;
+        SRWLOCK _Lock                     = SRWLOCK_INIT; // guards the injection queue and sleeping
+        CONDITION_VARIABLE _State_changed = CONDITION_VARIABLE_INIT; // new submissions or a work became idle
+        _Pool_work* _Injected_head        = nullptr;
+        _Pool_work* _Injected_tail        = nullptr;
+        _STD atomic<size_t> _Injected_pending{0};
+        _STD atomic<size_t> _Queued{0}; // submissions in the deques or the injection queue
+    };
+
+    // The pool is never destroyed: joining its workers while the DLL is being unloaded would deadlock on the loader
+    // lock, and the workers are only blocked waiting for submissions when the process exits.
+    SRWLOCK _Pool_creation_lock = SRWLOCK_INIT;
+    _STD atomic<_Std_thread_pool*> _Pool{nullptr};
+
+    [[nodiscard]] _Std_thread_pool* _Get_pool() noexcept {
+        auto _Result = _Pool.load(_STD memory_order_acquire);
+        if (!_Result) {
+            _SrwLock_guard _Guard{_Pool_creation_lock};
+            _Result = _Pool.load(_STD memory_order_relaxed);
+            if (!_Result) {
+                auto _Workers = _Environment_count(L"STL_STD_THREAD_POOL_WORKERS");
+                if (_Workers == 0) {
+                    _Workers = _STL_PARALLEL_ALGORITHMS_STD_THREAD_POOL_WORKERS;
+                }
+
+                if (_Workers == 0) {
+                    _Workers = _STD thread::hardware_concurrency();
+                }
+
+                const bool _Pin_workers = _STL_PARALLEL_ALGORITHMS_STD_THREAD_POOL_AFFINITY
+                                       || _Environment_count(L"STL_STD_THREAD_POOL_AFFINITY") != 0;
+                try {
+                    _Result = new _Std_thread_pool(_Workers, _Pin_workers);
+                } catch (...) {
+                    return nullptr;
+                }
+
+                _Pool.store(_Result, _STD memory_order_release);
+            }
+        }
+
+        return _Result;
+    }
+
+    [[nodiscard]] _Pool_work& _To_pool_work(const PTP_WORK _Work) noexcept {
+        return *reinterpret_cast<_Pool_work*>(_Work);
+    }
+} // unnamed namespace
+#endif // ^^^ _STL_PARALLEL_ALGORITHMS_STD_THREAD_POOL ^^^
+
 extern "C" {
 
 [[nodiscard]] unsigned int __stdcall __std_parallel_algorithms_hw_threads() noexcept {
@@ -20,6 +430,32 @@ extern "C" {
     return static_cast<unsigned int>(_Hw_concurrency);
 }
 
+#if _STL_PARALLEL_ALGORITHMS_STD_THREAD_POOL
+[[nodiscard]] PTP_WORK __stdcall __std_create_threadpool_work(
+    PTP_WORK_CALLBACK _Callback, void* _Context, PTP_CALLBACK_ENVIRON) noexcept {
+    if (!_Get_pool()) {
+        return nullptr;
+    }
+
+    return reinterpret_cast<PTP_WORK>(new (_STD nothrow) _Pool_work(_Callback, _Context));
+}
+
+void __stdcall __std_submit_threadpool_work(PTP_WORK _Work) noexcept {
+    _Get_pool()->_Submit(_To_pool_work(_Work), 1);
+}
+
+void __stdcall __std_bulk_submit_threadpool_work(PTP_WORK _Work, const size_t _Submissions) noexcept {
+    _Get_pool()->_Submit(_To_pool_work(_Work), _Submissions);
+}
+
+void __stdcall __std_close_threadpool_work(PTP_WORK _Work) noexcept {
+    delete &_To_pool_work(_Work);
+}
+
+void __stdcall __std_wait_for_threadpool_work_callbacks(PTP_WORK _Work, BOOL _Cancel) noexcept {
+    _Get_pool()->_Wait(_To_pool_work(_Work), _Cancel != FALSE);
+}
+#else // ^^^ _STL_PARALLEL_ALGORITHMS_STD_THREAD_POOL / !_STL_PARALLEL_ALGORITHMS_STD_THREAD_POOL vvv
 [[nodiscard]] PTP_WORK __stdcall __std_create_threadpool_work(
     PTP_WORK_CALLBACK _Callback, void* _Context, PTP_CALLBACK_ENVIRON _Callback_environ) noexcept {
     return CreateThreadpoolWork(_Callback, _Context, _Callback_environ);
@@ -42,6 +478,7 @@ void __stdcall __std_close_threadpool_work(PTP_WORK _Work) noexcept {
 void __stdcall __std_wait_for_threadpool_work_callbacks(PTP_WORK _Work, BOOL _Cancel) noexcept {
     WaitForThreadpoolWorkCallbacks(_Work, _Cancel);
 }
+#endif // ^^^ !_STL_PARALLEL_ALGORITHMS_STD_THREAD_POOL ^^^
 
 void __stdcall __std_execution_wait_on_uchar(const volatile unsigned char* _Address, unsigned char _Compare) noexcept {
     __std_atomic_wait_direct(const_cast<const unsigned char*>(_Address), &_Compare, 1, __std_atomic_wait_no_timeout);
@@ -5,6 +5,7 @@
 #error _M_CEE_PURE should not be defined when compiling vector_algorithms.cpp.
 #endif
 
+#include <__msvc_int128.hpp>
 #include <__msvc_minmax.hpp>
 #include <cstdint>
 #include <cstring>
@@ -26,6 +27,14 @@ extern int __isa_enabled; // TRANSITION, <isa_availability.h> will declare this
 
 namespace {
 #if !defined(_M_ARM64) && !defined(_M_ARM64EC)
+#ifdef _WIN64
+    // The AVX-512 tier is x64-only: it relies on 64-bit opmask registers and 64-bit bit scans.
+    // __ISA_AVAILABLE_AVX512 implies AVX512F, AVX512BW, AVX512CD, AVX512DQ, and AVX512VL.
+    [[nodiscard]] bool _Use_avx512() noexcept {
+        return __check_arch_support(__IA_SUPPORT_VECTOR512, 0) || (__isa_enabled & (1 << __ISA_AVAILABLE_AVX512));
+    }
+#endif // ^^^ defined(_WIN64) ^^^
+
     [[nodiscard]] bool _Use_avx2() noexcept {
         return __check_arch_support(__IA_SUPPORT_VECTOR256, 0) || (__isa_enabled & (1 << __ISA_AVAILABLE_AVX2));
     }
@@ -52,6 +61,13 @@ namespace {
         return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(
             reinterpret_cast<const unsigned char*>(_Tail_masks) + (32 - _Count_in_bytes)));
     }
+
+#ifdef _WIN64
+    uint64_t _Avx512_tail_mask(const size_t _Count_in_elements) noexcept {
+        // _Count_in_elements must be within [0, 63].
+        return (uint64_t{1} << _Count_in_elements) - 1;
+    }
+#endif // ^^^ defined(_WIN64) ^^^
 #endif // ^^^ !defined(_M_ARM64) && !defined(_M_ARM64EC) ^^^
 
 #if defined(_M_ARM64) || defined(_M_ARM64EC)
@@ -1077,6 +1093,18 @@ namespace {
             static unsigned long _Get_last_h_pos(const unsigned long _Mask) noexcept {
                 return 31 - _lzcnt_u32(_Mask);
             }
+
+            static __m256i _Make_tail_mask(const size_t _Tail_byte_size) noexcept {
+                return _Avx2_tail_mask_32(_Tail_byte_size);
+            }
+
+            static __m256i _Tail_and(const __m256i _Mask, const __m256i _Tail_mask) noexcept {
+                return _mm256_and_si256(_Tail_mask, _Mask);
+            }
+
+            static __m256i _Tail_andnot(const __m256i _Mask, const __m256i _Tail_mask) noexcept {
+                return _mm256_andnot_si256(_Mask, _Tail_mask);
+            }
         };
 
         struct _Traits_avx_i_base : _Traits_avx_base {
@@ -2855,6 +2883,427 @@ namespace {
         };
 #endif // ^^^ !defined(_M_ARM64) && !defined(_M_ARM64EC) ^^^
 
+#if !defined(_M_ARM64) && !defined(_M_ARM64EC) && defined(_WIN64)
+        // The AVX-512 traits plug into _Minmax_element_impl with opmask registers in place of vector masks.
+        // Masks have one bit per element, so the horizontal positions below scale bit indices to byte offsets.
+        // This tier covers 4-byte and 8-byte elements; narrower elements stay on AVX2.
+        struct _Traits_avx512_base {
+            using _Guard                            = _Zeroupper_on_exit;
+            static constexpr bool _Vectorized       = true;
+            static constexpr size_t _Vec_size       = 64;
+            static constexpr size_t _Vec_mask       = 0x3F;
+            static constexpr bool _Has_unsigned_cmp = false;
+
+            static __m512i _Zero() noexcept {
+                return _mm512_setzero_si512();
+            }
+
+            static __m512i _All_ones() noexcept {
+                return _mm512_set1_epi32(-1);
+            }
+
+            static void _Exit_vectorized() noexcept {
+                _mm256_zeroupper();
+            }
+        };
+
+        struct _Traits_avx512_32_base : _Traits_avx512_base {
+            static constexpr size_t _Tail_mask = 0x3C;
+
+            static __m512i _Blend(const __m512i _Px1, const __m512i _Px2, const __mmask16 _Msk) noexcept {
+                return _mm512_mask_blend_epi32(_Msk, _Px1, _Px2);
+            }
+
+            static unsigned long _Mask(const __mmask16 _Val) noexcept {
+                return _Val;
+            }
+
+            static unsigned long _Get_first_h_pos(const unsigned long _Mask) noexcept {
+                return _tzcnt_u32(_Mask) * 4;
+            }
+
+            static unsigned long _Get_last_h_pos(const unsigned long _Mask) noexcept {
+                return (31 - _lzcnt_u32(_Mask)) * 4 + 3; // the highest byte, like movemask-based traits
+            }
+
+            static __mmask16 _Make_tail_mask(const size_t _Tail_byte_size) noexcept {
+                return static_cast<__mmask16>(_Avx512_tail_mask(_Tail_byte_size / 4));
+            }
+
+            static __mmask16 _Tail_and(const __mmask16 _Mask, const __mmask16 _Tail_mask) noexcept {
+                return static_cast<__mmask16>(_Mask & _Tail_mask);
+            }
+
+            static __mmask16 _Tail_andnot(const __mmask16 _Mask, const __mmask16 _Tail_mask) noexcept {
+                return static_cast<__mmask16>(~_Mask & _Tail_mask);
+            }
+
+            static __m512i _Inc(const __m512i _Idx) noexcept {
+                return _mm512_add_epi32(_Idx, _mm512_set1_epi32(1));
+            }
+
+            static __mmask16 _Cmp_eq_idx(const __m512i _First, const __m512i _Second) noexcept {
+                return _mm512_cmpeq_epi32_mask(_First, _Second);
+            }
+        };
+
+        struct _Traits_avx512_64_base : _Traits_avx512_base {
+            static constexpr size_t _Tail_mask = 0x38;
+
+            static __m512i _Blend(const __m512i _Px1, const __m512i _Px2, const __mmask8 _Msk) noexcept {
+                return _mm512_mask_blend_epi64(_Msk, _Px1, _Px2);
+            }
+
+            static unsigned long _Mask(const __mmask8 _Val) noexcept {
+                return _Val;
+            }
+
+            static unsigned long _Get_first_h_pos(const unsigned long _Mask) noexcept {
+                return _tzcnt_u32(_Mask) * 8;
+            }
+
+            static unsigned long _Get_last_h_pos(const unsigned long _Mask) noexcept {
+                return (31 - _lzcnt_u32(_Mask)) * 8 + 7; // the highest byte, like movemask-based traits
+            }
+
+            static __mmask8 _Make_tail_mask(const size_t _Tail_byte_size) noexcept {
+                return static_cast<__mmask8>(_Avx512_tail_mask(_Tail_byte_size / 8));
+            }
+
+            static __mmask8 _Tail_and(const __mmask8 _Mask, const __mmask8 _Tail_mask) noexcept {
+                return static_cast<__mmask8>(_Mask & _Tail_mask);
+            }
+
+            static __mmask8 _Tail_andnot(const __mmask8 _Mask, const __mmask8 _Tail_mask) noexcept {
+                return static_cast<__mmask8>(~_Mask & _Tail_mask);
+            }
+
+            static __m512i _Inc(const __m512i _Idx) noexcept {
+                return _mm512_add_epi64(_Idx, _mm512_set1_epi64(1));
+            }
+
+            static __mmask8 _Cmp_eq_idx(const __m512i _First, const __m512i _Second) noexcept {
+                return _mm512_cmpeq_epi64_mask(_First, _Second);
+            }
+        };
+
+        struct _Traits_4_avx512 : _Traits_4_base, _Traits_avx512_32_base {
+            using _Vec_t = __m512i;
+
+            static __m512i _Load(const void* const _Src) noexcept {
+                return _mm512_loadu_si512(_Src);
+            }
+
+            static __m512i _Load_mask(const void* const _Src, const __mmask16 _Mask) noexcept {
+                return _mm512_maskz_loadu_epi32(_Mask, _Src);
+            }
+
+            static __m512i _Blendval(const __m512i _Px1, const __m512i _Px2, const __mmask16 _Msk) noexcept {
+                return _mm512_mask_blend_epi32(_Msk, _Px1, _Px2);
+            }
+
+            static __m512i _Sign_correction(const __m512i _Val, const bool _Sign) noexcept {
+                alignas(64) static constexpr _Unsigned_t _Sign_corrections[2][16] = {
+                    {0x8000'0000UL, 0x8000'0000UL, 0x8000'0000UL, 0x8000'0000UL, 0x8000'0000UL, 0x8000'0000UL,
+                        0x8000'0000UL, 0x8000'0000UL, 0x8000'0000UL, 0x8000'0000UL, 0x8000'0000UL, 0x8000'0000UL,
+                        0x8000'0000UL, 0x8000'0000UL, 0x8000'0000UL, 0x8000'0000UL},
+                    {}};
+                return _mm512_sub_epi32(_Val, _mm512_load_si512(_Sign_corrections[_Sign]));
+            }
+
+            template <class _Fn>
+            static __m512i _H_func(const __m512i _Cur, const _Fn _Funct) noexcept {
+                __m512i _H_min_val = _Cur;
+                _H_min_val = _Funct(_H_min_val, _mm512_shuffle_i32x4(_H_min_val, _H_min_val, _MM_SHUFFLE(1, 0, 3, 2)));
+                _H_min_val = _Funct(_H_min_val, _mm512_shuffle_i32x4(_H_min_val, _H_min_val, _MM_SHUFFLE(2, 3, 0, 1)));
+                _H_min_val = _Funct(_H_min_val, _mm512_shuffle_epi32(_H_min_val, _MM_PERM_BADC));
+                _H_min_val = _Funct(_H_min_val, _mm512_shuffle_epi32(_H_min_val, _MM_PERM_CDAB));
+                return _H_min_val;
+            }
+
+            static __m512i _H_min(const __m512i _Cur) noexcept {
+                return _H_func(_Cur,
+                    [](const __m512i _Val1, const __m512i _Val2) noexcept { return _mm512_min_epi32(_Val1, _Val2); });
+            }
+
+            static __m512i _H_max(const __m512i _Cur) noexcept {
+                return _H_func(_Cur,
+                    [](const __m512i _Val1, const __m512i _Val2) noexcept { return _mm512_max_epi32(_Val1, _Val2); });
+            }
+
+            static __m512i _H_min_u(const __m512i _Cur) noexcept {
+                return _H_func(_Cur,
+                    [](const __m512i _Val1, const __m512i _Val2) noexcept { return _mm512_min_epu32(_Val1, _Val2); });
+            }
+
+            static __m512i _H_max_u(const __m512i _Cur) noexcept {
+                return _H_func(_Cur,
+                    [](const __m512i _Val1, const __m512i _Val2) noexcept { return _mm512_max_epu32(_Val1, _Val2); });
+            }
+
+            static _Signed_t _Get_any(const __m512i _Cur) noexcept {
+                return static_cast<_Signed_t>(_mm_cvtsi128_si32(_mm512_castsi512_si128(_Cur)));
+            }
+
+            static _Unsigned_t _Get_v_pos(const __m512i _Idx) noexcept {
+                return static_cast<_Unsigned_t>(_Get_any(_Idx));
+            }
+
+            static __mmask16 _Cmp_eq(const __m512i _First, const __m512i _Second) noexcept {
+                return _mm512_cmpeq_epi32_mask(_First, _Second);
+            }
+
+            static __mmask16 _Cmp_gt(const __m512i _First, const __m512i _Second) noexcept {
+                return _mm512_cmpgt_epi32_mask(_First, _Second);
+            }
+
+            static __m512i _Min(const __m512i _First, const __m512i _Second, __mmask16 = 0) noexcept {
+                return _mm512_min_epi32(_First, _Second);
+            }
+
+            static __m512i _Max(const __m512i _First, const __m512i _Second, __mmask16 = 0) noexcept {
+                return _mm512_max_epi32(_First, _Second);
+            }
+
+            static __mmask16 _Mask_cast(const __mmask16 _Mask) noexcept {
+                return _Mask;
+            }
+        };
+
+        struct _Traits_8_avx512 : _Traits_8_base, _Traits_avx512_64_base {
+            using _Vec_t = __m512i;
+
+            static __m512i _Load(const void* const _Src) noexcept {
+                return _mm512_loadu_si512(_Src);
+            }
+
+            static __m512i _Load_mask(const void* const _Src, const __mmask8 _Mask) noexcept {
+                return _mm512_maskz_loadu_epi64(_Mask, _Src);
+            }
+
+            static __m512i _Blendval(const __m512i _Px1, const __m512i _Px2, const __mmask8 _Msk) noexcept {
+                return _mm512_mask_blend_epi64(_Msk, _Px1, _Px2);
+            }
+
+            static __m512i _Sign_correction(const __m512i _Val, const bool _Sign) noexcept {
+                alignas(64) static constexpr _Unsigned_t _Sign_corrections[2][8] = {
+                    {0x8000'0000'0000'0000ULL, 0x8000'0000'0000'0000ULL, 0x8000'0000'0000'0000ULL,
+                        0x8000'0000'0000'0000ULL, 0x8000'0000'0000'0000ULL, 0x8000'0000'0000'0000ULL,
+                        0x8000'0000'0000'0000ULL, 0x8000'0000'0000'0000ULL},
+                    {}};
+                return _mm512_sub_epi64(_Val, _mm512_load_si512(_Sign_corrections[_Sign]));
+            }
+
+            template <class _Fn>
+            static __m512i _H_func(const __m512i _Cur, const _Fn _Funct) noexcept {
+                __m512i _H_min_val = _Cur;
+                _H_min_val = _Funct(_H_min_val, _mm512_shuffle_i64x2(_H_min_val, _H_min_val, _MM_SHUFFLE(1, 0, 3, 2)));
+                _H_min_val = _Funct(_H_min_val, _mm512_shuffle_i64x2(_H_min_val, _H_min_val, _MM_SHUFFLE(2, 3, 0, 1)));
+                _H_min_val = _Funct(_H_min_val, _mm512_shuffle_epi32(_H_min_val, _MM_PERM_BADC));
+                return _H_min_val;
+            }
+
+            static __m512i _H_min(const __m512i _Cur) noexcept {
+                return _H_func(_Cur,
+                    [](const __m512i _Val1, const __m512i _Val2) noexcept { return _mm512_min_epi64(_Val1, _Val2); });
+            }
+
+            static __m512i _H_max(const __m512i _Cur) noexcept {
+                return _H_func(_Cur,
+                    [](const __m512i _Val1, const __m512i _Val2) noexcept { return _mm512_max_epi64(_Val1, _Val2); });
+            }
+
+            static __m512i _H_min_u(const __m512i _Cur) noexcept {
+                return _H_func(_Cur,
+                    [](const __m512i _Val1, const __m512i _Val2) noexcept { return _mm512_min_epu64(_Val1, _Val2); });
+            }
+
+            static __m512i _H_max_u(const __m512i _Cur) noexcept {
+                return _H_func(_Cur,
+                    [](const __m512i _Val1, const __m512i _Val2) noexcept { return _mm512_max_epu64(_Val1, _Val2); });
+            }
+
+            static _Signed_t _Get_any(const __m512i _Cur) noexcept {
+                return static_cast<_Signed_t>(_mm_cvtsi128_si64(_mm512_castsi512_si128(_Cur)));
+            }
+
+            static _Unsigned_t _Get_v_pos(const __m512i _Idx) noexcept {
+                return static_cast<_Unsigned_t>(_Get_any(_Idx));
+            }
+
+            static __mmask8 _Cmp_eq(const __m512i _First, const __m512i _Second) noexcept {
+                return _mm512_cmpeq_epi64_mask(_First, _Second);
+            }
+
+            static __mmask8 _Cmp_gt(const __m512i _First, const __m512i _Second) noexcept {
+                return _mm512_cmpgt_epi64_mask(_First, _Second);
+            }
+
+            static __m512i _Min(const __m512i _First, const __m512i _Second, __mmask8 = 0) noexcept {
+                return _mm512_min_epi64(_First, _Second);
+            }
+
+            static __m512i _Max(const __m512i _First, const __m512i _Second, __mmask8 = 0) noexcept {
+                return _mm512_max_epi64(_First, _Second);
+            }
+
+            static __mmask8 _Mask_cast(const __mmask8 _Mask) noexcept {
+                return _Mask;
+            }
+        };
+
+        struct _Traits_f_avx512 : _Traits_f_base, _Traits_avx512_32_base {
+            using _Vec_t = __m512;
+
+            static __m512 _Load(const void* const _Src) noexcept {
+                return _mm512_loadu_ps(_Src);
+            }
+
+            static __m512 _Load_mask(const void* const _Src, const __mmask16 _Mask) noexcept {
+                return _mm512_maskz_loadu_ps(_Mask, _Src);
+            }
+
+            static __m512 _Blendval(const __m512 _Px1, const __m512 _Px2, const __mmask16 _Msk) noexcept {
+                return _mm512_mask_blend_ps(_Msk, _Px1, _Px2);
+            }
+
+            static __m512 _Sign_correction(const __m512 _Val, bool) noexcept {
+                return _Val;
+            }
+
+            template <class _Fn>
+            static __m512 _H_func(const __m512 _Cur, const _Fn _Funct) noexcept {
+                __m512 _H_min_val = _Cur;
+                _H_min_val = _Funct(_mm512_permute_ps(_H_min_val, _MM_SHUFFLE(2, 3, 0, 1)), _H_min_val);
+                _H_min_val = _Funct(_mm512_permute_ps(_H_min_val, _MM_SHUFFLE(1, 0, 3, 2)), _H_min_val);
+                _H_min_val = _Funct(_mm512_shuffle_f32x4(_H_min_val, _H_min_val, _MM_SHUFFLE(2, 3, 0, 1)), _H_min_val);
+                _H_min_val = _Funct(_mm512_shuffle_f32x4(_H_min_val, _H_min_val, _MM_SHUFFLE(1, 0, 3, 2)), _H_min_val);
+                return _H_min_val;
+            }
+
+            static __m512 _H_min(const __m512 _Cur) noexcept {
+                return _H_func(
+                    _Cur, [](const __m512 _Val1, const __m512 _Val2) noexcept { return _mm512_min_ps(_Val1, _Val2); });
+            }
+
+            static __m512 _H_max(const __m512 _Cur) noexcept {
+                return _H_func(
+                    _Cur, [](const __m512 _Val1, const __m512 _Val2) noexcept { return _mm512_max_ps(_Val1, _Val2); });
+            }
+
+            static __m512i _H_min_u(const __m512i _Cur) noexcept {
+                return _Traits_4_avx512::_H_min_u(_Cur);
+            }
+
+            static __m512i _H_max_u(const __m512i _Cur) noexcept {
+                return _Traits_4_avx512::_H_max_u(_Cur);
+            }
+
+            static float _Get_any(const __m512 _Cur) noexcept {
+                return _mm512_cvtss_f32(_Cur);
+            }
+
+            static uint32_t _Get_v_pos(const __m512i _Idx) noexcept {
+                return _Traits_4_avx512::_Get_v_pos(_Idx);
+            }
+
+            static __mmask16 _Cmp_eq(const __m512 _First, const __m512 _Second) noexcept {
+                return _mm512_cmp_ps_mask(_First, _Second, _CMP_EQ_OQ);
+            }
+
+            static __mmask16 _Cmp_gt(const __m512 _First, const __m512 _Second) noexcept {
+                return _mm512_cmp_ps_mask(_First, _Second, _CMP_GT_OQ);
+            }
+
+            static __m512 _Min(const __m512 _First, const __m512 _Second, __mmask16 = 0) noexcept {
+                return _mm512_min_ps(_Second, _First);
+            }
+
+            static __m512 _Max(const __m512 _First, const __m512 _Second, __mmask16 = 0) noexcept {
+                return _mm512_max_ps(_Second, _First);
+            }
+
+            static __mmask16 _Mask_cast(const __mmask16 _Mask) noexcept {
+                return _Mask;
+            }
+        };
+
+        struct _Traits_d_avx512 : _Traits_d_base, _Traits_avx512_64_base {
+            using _Vec_t = __m512d;
+
+            static __m512d _Load(const void* const _Src) noexcept {
+                return _mm512_loadu_pd(_Src);
+            }
+
+            static __m512d _Load_mask(const void* const _Src, const __mmask8 _Mask) noexcept {
+                return _mm512_maskz_loadu_pd(_Mask, _Src);
+            }
+
+            static __m512d _Blendval(const __m512d _Px1, const __m512d _Px2, const __mmask8 _Msk) noexcept {
+                return _mm512_mask_blend_pd(_Msk, _Px1, _Px2);
+            }
+
+            static __m512d _Sign_correction(const __m512d _Val, bool) noexcept {
+                return _Val;
+            }
+
+            template <class _Fn>
+            static __m512d _H_func(const __m512d _Cur, const _Fn _Funct) noexcept {
+                __m512d _H_min_val = _Cur;
+                _H_min_val         = _Funct(_mm512_permute_pd(_H_min_val, 0b0101'0101), _H_min_val);
+                _H_min_val = _Funct(_mm512_shuffle_f64x2(_H_min_val, _H_min_val, _MM_SHUFFLE(2, 3, 0, 1)), _H_min_val);
+                _H_min_val = _Funct(_mm512_shuffle_f64x2(_H_min_val, _H_min_val, _MM_SHUFFLE(1, 0, 3, 2)), _H_min_val);
+                return _H_min_val;
+            }
+
+            static __m512d _H_min(const __m512d _Cur) noexcept {
+                return _H_func(_Cur,
+                    [](const __m512d _Val1, const __m512d _Val2) noexcept { return _mm512_min_pd(_Val1, _Val2); });
+            }
+
+            static __m512d _H_max(const __m512d _Cur) noexcept {
+                return _H_func(_Cur,
+                    [](const __m512d _Val1, const __m512d _Val2) noexcept { return _mm512_max_pd(_Val1, _Val2); });
+            }
+
+            static __m512i _H_min_u(const __m512i _Cur) noexcept {
+                return _Traits_8_avx512::_H_min_u(_Cur);
+            }
+
+            static __m512i _H_max_u(const __m512i _Cur) noexcept {
+                return _Traits_8_avx512::_H_max_u(_Cur);
+            }
+
+            static double _Get_any(const __m512d _Cur) noexcept {
+                return _mm512_cvtsd_f64(_Cur);
+            }
+
+            static uint64_t _Get_v_pos(const __m512i _Idx) noexcept {
+                return _Traits_8_avx512::_Get_v_pos(_Idx);
+            }
+
+            static __mmask8 _Cmp_eq(const __m512d _First, const __m512d _Second) noexcept {
+                return _mm512_cmp_pd_mask(_First, _Second, _CMP_EQ_OQ);
+            }
+
+            static __mmask8 _Cmp_gt(const __m512d _First, const __m512d _Second) noexcept {
+                return _mm512_cmp_pd_mask(_First, _Second, _CMP_GT_OQ);
+            }
+
+            static __m512d _Min(const __m512d _First, const __m512d _Second, __mmask8 = 0) noexcept {
+                return _mm512_min_pd(_Second, _First);
+            }
+
+            static __m512d _Max(const __m512d _First, const __m512d _Second, __mmask8 = 0) noexcept {
+                return _mm512_max_pd(_Second, _First);
+            }
+
+            static __mmask8 _Mask_cast(const __mmask8 _Mask) noexcept {
+                return _Mask;
+            }
+        };
+#endif // ^^^ !defined(_M_ARM64) && !defined(_M_ARM64EC) && defined(_WIN64) ^^^
+
         struct _Traits_1 {
             using _Scalar = _Traits_scalar<_Traits_1_base>;
 #if defined(_M_ARM64) || defined(_M_ARM64EC)
@@ -2882,6 +3331,9 @@ namespace {
 #else // ^^^ defined(_M_ARM64) || defined(_M_ARM64EC) / !defined(_M_ARM64) && !defined(_M_ARM64EC) vvv
             using _Sse = _Traits_4_sse;
             using _Avx = _Traits_4_avx;
+#ifdef _WIN64
+            using _Avx512 = _Traits_4_avx512;
+#endif // ^^^ defined(_WIN64) ^^^
 #endif // ^^^ !defined(_M_ARM64) && !defined(_M_ARM64EC) ^^^
         };
 
@@ -2892,6 +3344,9 @@ namespace {
 #else // ^^^ defined(_M_ARM64) || defined(_M_ARM64EC) / !defined(_M_ARM64) && !defined(_M_ARM64EC) vvv
             using _Sse = _Traits_8_sse;
             using _Avx = _Traits_8_avx;
+#ifdef _WIN64
+            using _Avx512 = _Traits_8_avx512;
+#endif // ^^^ defined(_WIN64) ^^^
 #endif // ^^^ !defined(_M_ARM64) && !defined(_M_ARM64EC) ^^^
         };
 
@@ -2902,6 +3357,9 @@ namespace {
 #else // ^^^ defined(_M_ARM64) || defined(_M_ARM64EC) / !defined(_M_ARM64) && !defined(_M_ARM64EC) vvv
             using _Sse = _Traits_f_sse;
             using _Avx = _Traits_f_avx;
+#ifdef _WIN64
+            using _Avx512 = _Traits_f_avx512;
+#endif // ^^^ defined(_WIN64) ^^^
 #endif // ^^^ !defined(_M_ARM64) && !defined(_M_ARM64EC) ^^^
         };
 
@@ -2912,6 +3370,9 @@ namespace {
 #else // ^^^ defined(_M_ARM64) || defined(_M_ARM64EC) / !defined(_M_ARM64) && !defined(_M_ARM64EC) vvv
             using _Sse = _Traits_d_sse;
             using _Avx = _Traits_d_avx;
+#ifdef _WIN64
+            using _Avx512 = _Traits_d_avx512;
+#endif // ^^^ defined(_WIN64) ^^^
 #endif // ^^^ !defined(_M_ARM64) && !defined(_M_ARM64EC) ^^^
         };
 
@@ -3106,19 +3567,19 @@ namespace {
                             const size_t _Tail_byte_size = _Remaining_byte_size & _Traits::_Tail_mask;
 
                             if (_Last_portion && _Tail_byte_size != 0) {
-                                const auto _Tail_mask = _Avx2_tail_mask_32(_Tail_byte_size);
+                                const auto _Tail_mask = _Traits::_Make_tail_mask(_Tail_byte_size);
                                 const auto _Tail_vals =
                                     _Traits::_Sign_correction(_Traits::_Load_mask(_First, _Tail_mask), _Sign);
                                 _Cur_vals = _Traits::_Blendval(_Cur_vals, _Tail_vals, _Tail_mask);
 
                                 const auto _Blend_idx_0_mask = [_Tail_mask](const auto _Prev, const auto _Cur,
                                                                    const auto _Mask) noexcept {
-                                    return _Traits::_Blend(_Prev, _Cur, _mm256_andnot_si256(_Mask, _Tail_mask));
+                                    return _Traits::_Blend(_Prev, _Cur, _Traits::_Tail_andnot(_Mask, _Tail_mask));
                                 };
 
                                 const auto _Blend_idx_1_mask = [_Tail_mask](const auto _Prev, const auto _Cur,
                                                                    const auto _Mask) noexcept {
-                                    return _Traits::_Blend(_Prev, _Cur, _mm256_and_si256(_Tail_mask, _Mask));
+                                    return _Traits::_Blend(_Prev, _Cur, _Traits::_Tail_and(_Mask, _Tail_mask));
                                 };
 
                                 _Update_min_max(_Cur_vals, _Blend_idx_0_mask, _Blend_idx_1_mask);
@@ -3296,6 +3757,14 @@ namespace {
 
             return _Minmax_element_impl<_Mode, typename _Traits::_Scalar, _Sign>(_First, _Last);
 #else // ^^^ defined(_M_ARM64) || defined(_M_ARM64EC) / !defined(_M_ARM64) && !defined(_M_ARM64EC) vvv
+#ifdef _WIN64
+            if constexpr (sizeof(typename _Traits::_Scalar::_Signed_t) >= 4) {
+                if (_Byte_length(_First, _Last) >= 64 && _Use_avx512()) {
+                    return _Minmax_element_impl<_Mode, typename _Traits::_Avx512>(_First, _Last, _Sign);
+                }
+            }
+#endif // ^^^ defined(_WIN64) ^^^
+
             if (_Byte_length(_First, _Last) >= 32 && _Use_avx2()) {
                 return _Minmax_element_impl<_Mode, typename _Traits::_Avx>(_First, _Last, _Sign);
             }
@@ -4195,13 +4664,3051 @@ const void* __stdcall __std_is_sorted_until_d(
 
 } // extern "C"
 
+#ifndef _M_ARM64
 namespace {
-    namespace _Finding {
-#if defined(_M_ARM64) || defined(_M_ARM64EC)
-        struct _Find_traits_1 {
-            static uint8x16_t _Load_q(const void* const _Ptr) noexcept {
-                return vld1q_u8(static_cast<const uint8_t*>(_Ptr));
-            }
+    namespace _Sorting_values {
+        // Sorts arithmetic values by themselves. Equivalent values can't be told apart by less<> or greater<>,
+        // so the order among them is free, and elements may be moved around as raw bits or even rewritten.
+        //
+        // 1-byte and 2-byte elements are not compared at all: 1-byte elements are counted and rewritten in order;
+        // 2-byte elements are bucketed in place by the high byte, then each bucket is counted by the low byte.
+        // This fully sorts in linear time, so it is also how nth_element and partial_sort are done for them.
+        //
+        // 4-byte and 8-byte elements are mapped in place to signed integer keys whose ascending order is the requested
+        // order, ordered by an introsort or an introselect with vectorized partitioning and a sorting network for small
+        // partitions, and then mapped back:
+        // * unsigned elements have the sign bit flipped;
+        // * floating-point elements have the non-sign bits of negative values flipped, so that the bit patterns order
+        //   like signed integers; -0.0 orders before +0.0, which is fine, as they are equivalent;
+        // * descending order has all bits flipped in addition.
+
+        constexpr size_t _Network_size = 16;
+
+        // Green's 60-comparator network; comparators within each group are independent.
+        constexpr uint8_t _Network_16[60][2] = {
+            {0, 13}, {1, 12}, {2, 15}, {3, 14}, {4, 8}, {5, 6}, {7, 11}, {9, 10}, // 1st group
+            {0, 5}, {1, 7}, {2, 9}, {3, 4}, {6, 13}, {8, 14}, {10, 15}, {11, 12}, // 2nd group
+            {0, 1}, {2, 3}, {4, 5}, {6, 8}, {7, 9}, {10, 11}, {12, 13}, {14, 15}, // 3rd group
+            {0, 2}, {1, 3}, {4, 10}, {5, 11}, {6, 7}, {8, 9}, {12, 14}, {13, 15}, // 4th group
+            {1, 2}, {3, 12}, {4, 6}, {5, 7}, {8, 10}, {9, 11}, {13, 14}, // 5th group
+            {1, 4}, {2, 6}, {5, 8}, {7, 10}, {9, 13}, {11, 14}, // 6th group
+            {2, 4}, {3, 6}, {9, 12}, {11, 13}, // 7th group
+            {3, 5}, {6, 8}, {7, 9}, {10, 12}, // 8th group
+            {3, 4}, {5, 6}, {7, 8}, {9, 10}, {11, 12}, // 9th group
+            {6, 7}, {8, 9}, // 10th group
+        };
+
+        template <class _Ty>
+        constexpr _Ty _Max_value = static_cast<_Ty>(
+            static_cast<std::make_unsigned_t<_Ty>>(-1) >> (std::is_signed_v<_Ty> ? 1 : 0));
+
+        template <class _Ty>
+        void _Compare_exchange(_Ty& _Left, _Ty& _Right) noexcept {
+            // Written to be branchless (cmov).
+            const _Ty _Lo = _Right < _Left ? _Right : _Left;
+            const _Ty _Hi = _Right < _Left ? _Left : _Right;
+            _Left         = _Lo;
+            _Right        = _Hi;
+        }
+
+        template <class _Ty>
+        void _Sort_small(_Ty* const _First, const size_t _Count) noexcept {
+            // _Count must be within [0, _Network_size]. The unused network inputs are padded with the greatest value;
+            // any real elements equal to it are indistinguishable from the padding.
+            _Ty _Buf[_Network_size];
+            memcpy(_Buf, _First, _Count * sizeof(_Ty));
+            for (size_t _Ix = _Count; _Ix != _Network_size; ++_Ix) {
+                _Buf[_Ix] = _Max_value<_Ty>;
+            }
+
+            for (const auto& _Comparator : _Network_16) {
+                _Compare_exchange(_Buf[_Comparator[0]], _Buf[_Comparator[1]]);
+            }
+
+            memcpy(_First, _Buf, _Count * sizeof(_Ty));
+        }
+
+        template <class _Ty>
+        void _Sift_down(_Ty* const _First, size_t _Hole, const size_t _Count, const _Ty _Val) noexcept {
+            for (;;) {
+                size_t _Child = 2 * _Hole + 1;
+                if (_Child >= _Count) {
+                    break;
+                }
+
+                if (_Child + 1 < _Count && _First[_Child] < _First[_Child + 1]) {
+                    ++_Child;
+                }
+
+                if (!(_Val < _First[_Child])) {
+                    break;
+                }
+
+                _First[_Hole] = _First[_Child];
+                _Hole         = _Child;
+            }
+
+            _First[_Hole] = _Val;
+        }
+
+        template <class _Ty>
+        void _Heap_sort(_Ty* const _First, const size_t _Count) noexcept {
+            for (size_t _Ix = _Count / 2; _Ix != 0;) {
+                --_Ix;
+                _Sift_down(_First, _Ix, _Count, _First[_Ix]);
+            }
+
+            for (size_t _Ix = _Count; _Ix > 1;) {
+                --_Ix;
+                const _Ty _Val = _First[_Ix];
+                _First[_Ix]    = _First[0];
+                _Sift_down(_First, 0, _Ix, _Val);
+            }
+        }
+
+        template <class _Ty>
+        _Ty _Median_of_3(const _Ty _Ax, const _Ty _Bx, const _Ty _Cx) noexcept {
+            const _Ty _Lo = _Bx < _Ax ? _Bx : _Ax;
+            const _Ty _Hi = _Bx < _Ax ? _Ax : _Bx;
+            const _Ty _Md = _Cx < _Hi ? _Cx : _Hi;
+            return _Md < _Lo ? _Lo : _Md;
+        }
+
+        template <class _Ty>
+        _Ty _Guess_median(const _Ty* const _First, const size_t _Count) noexcept {
+            const size_t _Mid  = _Count / 2;
+            const size_t _Last = _Count - 1;
+            if (_Count >= 128) { // Tukey's ninther
+                const size_t _Step = _Count / 8;
+                return _Median_of_3(_Median_of_3(_First[0], _First[_Step], _First[2 * _Step]),
+                    _Median_of_3(_First[_Mid - _Step], _First[_Mid], _First[_Mid + _Step]),
+                    _Median_of_3(_First[_Last - 2 * _Step], _First[_Last - _Step], _First[_Last]));
+            }
+
+            return _Median_of_3(_First[0], _First[_Mid], _First[_Last]);
+        }
+
+        // With _Or_equal == false, elements less than the pivot go left; otherwise, elements not greater than it do.
+        template <bool _Or_equal, class _Ty>
+        bool _Goes_left(const _Ty _Val, const _Ty _Pivot) noexcept {
+            if constexpr (_Or_equal) {
+                return !(_Pivot < _Val);
+            } else {
+                return _Val < _Pivot;
+            }
+        }
+
+        template <bool _Or_equal, class _Ty>
+        _Ty* _Partition_scalar(_Ty* const _First, _Ty* const _Last, const _Ty _Pivot) noexcept {
+            // Branchless Lomuto partition: [_First, _Left) goes left, [_Left, _Right) goes right
+            _Ty* _Left = _First;
+            for (_Ty* _Right = _First; _Right != _Last; ++_Right) {
+                const _Ty _Val = *_Right;
+                *_Right        = *_Left;
+                *_Left         = _Val;
+                _Left += _Goes_left<_Or_equal>(_Val, _Pivot);
+            }
+
+            return _Left;
+        }
+
+        struct _Scalar_traits {
+            static constexpr size_t _Lanes = 1;
+        };
+
+#ifndef _M_ARM64EC
+        template <size_t _Size_v, size_t _Size_h>
+        struct _Partition_tables {
+            uint8_t _Shuf[_Size_v][_Size_h];
+        };
+
+        template <size_t _Size_v, size_t _Size_h>
+        constexpr auto _Make_partition_tables() {
+            // Make vpermd patterns that put the lanes of set bits first and the lanes of clear bits last.
+            _Partition_tables<_Size_v, _Size_h> _Result{};
+
+            for (uint32_t _Vx = 0; _Vx != _Size_v; ++_Vx) {
+                uint32_t _Nx = 0;
+
+                for (uint32_t _Pass = 0; _Pass != 2; ++_Pass) {
+                    for (uint32_t _Hx = 0; _Hx != _Size_h; ++_Hx) {
+                        if (((_Vx >> _Hx) & 1) != _Pass) {
+                            _Result._Shuf[_Vx][_Nx] = static_cast<uint8_t>(_Hx);
+                            ++_Nx;
+                        }
+                    }
+                }
+            }
+
+            return _Result;
+        }
+
+        constexpr auto _Partition_tables_4_avx = _Make_partition_tables<256, 8>();
+
+        // Vectorized partition traits. _Store_partitioned stores a full vector at _Write_left, with the elements that
+        // go left in front, and a full vector ending at _Write_right, with the elements that go right at the back,
+        // then moves both write pointers past what they've kept.
+        struct _Avx2_4 {
+            static constexpr size_t _Lanes = 8;
+
+            static __m256i _Set(const int32_t _Val) noexcept {
+                return _mm256_set1_epi32(_Val);
+            }
+
+            static __m256i _Load(const int32_t* const _Src) noexcept {
+                return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Src));
+            }
+
+            template <bool _Or_equal>
+            static unsigned long _Left_mask(const __m256i _Val, const __m256i _Pivot) noexcept {
+                if constexpr (_Or_equal) {
+                    return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(_Val, _Pivot))) ^ 0xFF;
+                } else {
+                    return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(_Pivot, _Val)));
+                }
+            }
+
+            static void _Store_partitioned(const __m256i _Val, const unsigned long _Mask, int32_t*& _Write_left,
+                int32_t*& _Write_right) noexcept {
+                const __m128i _Shuf8 =
+                    _mm_loadl_epi64(reinterpret_cast<const __m128i*>(_Partition_tables_4_avx._Shuf[_Mask]));
+                const __m256i _Shuf = _mm256_cvtepu8_epi32(_Shuf8);
+                const __m256i _Dest = _mm256_permutevar8x32_epi32(_Val, _Shuf);
+                const size_t _Count = __popcnt(_Mask); // Assume available with AVX2
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Write_left), _Dest);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Write_right - _Lanes), _Dest);
+                _Write_left += _Count;
+                _Write_right -= _Lanes - _Count;
+            }
+        };
+
+#ifdef _WIN64
+        // With AVX-512, the two halves are compressed separately; the right half is stored with a mask,
+        // as its kept elements must end exactly at _Write_right.
+        struct _Avx512_4 {
+            static constexpr size_t _Lanes = 16;
+
+            static __m512i _Set(const int32_t _Val) noexcept {
+                return _mm512_set1_epi32(_Val);
+            }
+
+            static __m512i _Load(const int32_t* const _Src) noexcept {
+                return _mm512_loadu_si512(_Src);
+            }
+
+            template <bool _Or_equal>
+            static unsigned long _Left_mask(const __m512i _Val, const __m512i _Pivot) noexcept {
+                if constexpr (_Or_equal) {
+                    return _mm512_cmple_epi32_mask(_Val, _Pivot);
+                } else {
+                    return _mm512_cmplt_epi32_mask(_Val, _Pivot);
+                }
+            }
+
+            static void _Store_partitioned(const __m512i _Val, const unsigned long _Mask, int32_t*& _Write_left,
+                int32_t*& _Write_right) noexcept {
+                const __mmask16 _Left_mask  = static_cast<__mmask16>(_Mask);
+                const __mmask16 _Right_mask = static_cast<__mmask16>(~_Mask);
+                const size_t _Count         = __popcnt(_Mask);
+                _mm512_storeu_si512(_Write_left, _mm512_maskz_compress_epi32(_Left_mask, _Val));
+                _Write_left += _Count;
+                _Write_right -= _Lanes - _Count;
+                _mm512_mask_storeu_epi32(_Write_right, static_cast<__mmask16>(_Avx512_tail_mask(_Lanes - _Count)),
+                    _mm512_maskz_compress_epi32(_Right_mask, _Val));
+            }
+        };
+
+        struct _Avx512_8 {
+            static constexpr size_t _Lanes = 8;
+
+            static __m512i _Set(const int64_t _Val) noexcept {
+                return _mm512_set1_epi64(_Val);
+            }
+
+            static __m512i _Load(const int64_t* const _Src) noexcept {
+                return _mm512_loadu_si512(_Src);
+            }
+
+            template <bool _Or_equal>
+            static unsigned long _Left_mask(const __m512i _Val, const __m512i _Pivot) noexcept {
+                if constexpr (_Or_equal) {
+                    return _mm512_cmple_epi64_mask(_Val, _Pivot);
+                } else {
+                    return _mm512_cmplt_epi64_mask(_Val, _Pivot);
+                }
+            }
+
+            static void _Store_partitioned(const __m512i _Val, const unsigned long _Mask, int64_t*& _Write_left,
+                int64_t*& _Write_right) noexcept {
+                const __mmask8 _Left_mask  = static_cast<__mmask8>(_Mask);
+                const __mmask8 _Right_mask = static_cast<__mmask8>(~_Mask);
+                const size_t _Count        = __popcnt(_Mask);
+                _mm512_storeu_si512(_Write_left, _mm512_maskz_compress_epi64(_Left_mask, _Val));
+                _Write_left += _Count;
+                _Write_right -= _Lanes - _Count;
+                _mm512_mask_storeu_epi64(_Write_right, static_cast<__mmask8>(_Avx512_tail_mask(_Lanes - _Count)),
+                    _mm512_maskz_compress_epi64(_Right_mask, _Val));
+            }
+        };
+#endif // ^^^ defined(_WIN64) ^^^
+
+        template <class _Traits, bool _Or_equal, class _Ty>
+        _Ty* _Partition_vectorized(_Ty* const _First, _Ty* const _Last, const _Ty _Pivot) noexcept {
+            // [_First, _Last) must have at least 2 * _Lanes elements.
+            // The first and the last vectors are set aside, so that both ends have room for a full vector store.
+            // Each step reads a vector from the end with less room, then stores it to both ends. This keeps the room
+            // at each end at least a vector, as the total room stays at two vectors between steps.
+            constexpr size_t _Lanes = _Traits::_Lanes;
+
+            _Ty _Buf[3 * _Lanes];
+            memcpy(_Buf, _First, _Lanes * sizeof(_Ty));
+            memcpy(_Buf + _Lanes, _Last - _Lanes, _Lanes * sizeof(_Ty));
+
+            const auto _Pivot_vec = _Traits::_Set(_Pivot);
+
+            _Ty* _Read_left   = _First + _Lanes;
+            _Ty* _Read_right  = _Last - _Lanes;
+            _Ty* _Write_left  = _First;
+            _Ty* _Write_right = _Last;
+
+            while (static_cast<size_t>(_Read_right - _Read_left) >= _Lanes) {
+                // The side is data dependent, hence hard to predict, so it is selected without branching.
+                const bool _From_left = _Read_left - _Write_left <= _Write_right - _Read_right;
+                const size_t _Left_step = _From_left ? _Lanes : 0;
+                const auto _Val = _Traits::_Load(_From_left ? _Read_left : _Read_right - _Lanes);
+                _Read_left += _Left_step;
+                _Read_right -= _Lanes - _Left_step;
+
+                _Traits::_Store_partitioned(
+                    _Val, _Traits::template _Left_mask<_Or_equal>(_Val, _Pivot_vec), _Write_left, _Write_right);
+            }
+
+            // Now [_Write_left, _Write_right) is exactly the room for the set aside vectors and the unread rest.
+            const size_t _Rest = static_cast<size_t>(_Read_right - _Read_left);
+            memcpy(_Buf + 2 * _Lanes, _Read_left, _Rest * sizeof(_Ty));
+
+            for (size_t _Ix = 0; _Ix != 2 * _Lanes + _Rest; ++_Ix) {
+                const _Ty _Val = _Buf[_Ix];
+                if (_Goes_left<_Or_equal>(_Val, _Pivot)) {
+                    *_Write_left = _Val;
+                    ++_Write_left;
+                } else {
+                    --_Write_right;
+                    *_Write_right = _Val;
+                }
+            }
+
+            return _Write_left;
+        }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+
+        template <class _Traits, bool _Or_equal, class _Ty>
+        _Ty* _Partition(_Ty* const _First, _Ty* const _Last, const _Ty _Pivot) noexcept {
+#ifndef _M_ARM64EC
+            if constexpr (_Traits::_Lanes > 1) {
+                // The set aside vectors make short ranges not worth it
+                if (static_cast<size_t>(_Last - _First) >= 8 * _Traits::_Lanes) {
+                    return _Partition_vectorized<_Traits, _Or_equal>(_First, _Last, _Pivot);
+                }
+            }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+
+            return _Partition_scalar<_Or_equal>(_First, _Last, _Pivot);
+        }
+
+        template <class _Traits, class _Ty>
+        void _Introsort(_Ty* _First, _Ty* _Last, size_t _Ideal) noexcept {
+            for (;;) {
+                const size_t _Count = static_cast<size_t>(_Last - _First);
+                if (_Count <= _Network_size) {
+                    _Sort_small(_First, _Count);
+                    return;
+                }
+
+                if (_Ideal == 0) { // heap sort if too many divisions
+                    _Heap_sort(_First, _Count);
+                    return;
+                }
+
+                _Ideal = (_Ideal >> 1) + (_Ideal >> 2); // allow 1.5 log2(N) divisions
+
+                const _Ty _Pivot = _Guess_median(_First, _Count);
+                _Ty* const _Mid  = _Partition<_Traits, false>(_First, _Last, _Pivot);
+
+                if (_Mid == _First) {
+                    // The pivot is the minimum. Gather the elements equal to it, they are already in place.
+                    _First = _Partition<_Traits, true>(_First, _Last, _Pivot);
+                    continue;
+                }
+
+                if (_Mid - _First < _Last - _Mid) { // loop on the larger part
+                    _Introsort<_Traits>(_First, _Mid, _Ideal);
+                    _First = _Mid;
+                } else {
+                    _Introsort<_Traits>(_Mid, _Last, _Ideal);
+                    _Last = _Mid;
+                }
+            }
+        }
+
+        template <class _Traits, class _Ty>
+        void _Introselect(_Ty* _First, _Ty* const _Nth, _Ty* _Last) noexcept {
+            // _Nth must be within [_First, _Last).
+            size_t _Ideal = static_cast<size_t>(_Last - _First);
+            for (;;) {
+                const size_t _Count = static_cast<size_t>(_Last - _First);
+                if (_Count <= _Network_size) {
+                    _Sort_small(_First, _Count);
+                    return;
+                }
+
+                if (_Ideal < (_Count >> 1)) { // heap sort the rest if the pivots have been too bad
+                    _Heap_sort(_First, _Count);
+                    return;
+                }
+
+                const _Ty _Pivot = _Guess_median(_First, _Count);
+                _Ty* const _Mid  = _Partition<_Traits, false>(_First, _Last, _Pivot);
+
+                if (_Mid == _First) {
+                    // The pivot is the minimum. Gather the elements equal to it, they are already in place.
+                    _First = _Partition<_Traits, true>(_First, _Last, _Pivot);
+                    if (_Nth < _First) {
+                        return;
+                    }
+                } else if (_Nth < _Mid) {
+                    _Last = _Mid;
+                } else {
+                    _First = _Mid;
+                }
+
+                // processed range should be reduced by 25% per iteration on average
+                _Ideal = (_Ideal >> 1) + (_Ideal >> 2);
+            }
+        }
+
+        enum class _Order_op {
+            _Sort, // order [_First, _Last)
+            _Nth_element, // put the element that belongs to _Mid there, not greater ones before, not lesser ones after
+            _Partial_sort, // order [_First, _Last) up to _Mid
+        };
+
+        template <class _Traits, class _Ty>
+        void _Order_with(const _Order_op _Op, _Ty* const _First, _Ty* const _Mid, _Ty* const _Last) noexcept {
+            const size_t _Count = static_cast<size_t>(_Last - _First);
+            switch (_Op) {
+            case _Order_op::_Sort:
+                _Introsort<_Traits>(_First, _Last, _Count);
+                return;
+
+            case _Order_op::_Nth_element:
+                _Introselect<_Traits>(_First, _Mid, _Last);
+                return;
+
+            case _Order_op::_Partial_sort:
+                if (_Mid == _Last) {
+                    _Introsort<_Traits>(_First, _Last, _Count);
+                } else if (_Mid != _First) {
+                    // Select the last element of the sorted part, then sort the part before it
+                    _Introselect<_Traits>(_First, _Mid - 1, _Last);
+                    _Introsort<_Traits>(_First, _Mid - 1, static_cast<size_t>(_Mid - 1 - _First));
+                }
+                return;
+            }
+        }
+
+        template <class _Key>
+        void _Order_keys(const _Order_op _Op, _Key* const _First, _Key* const _Mid, _Key* const _Last) noexcept {
+#ifndef _M_ARM64EC
+            if (static_cast<size_t>(_Last - _First) > _Network_size) {
+#ifdef _WIN64
+                if (_Use_avx512()) {
+                    _Zeroupper_on_exit _Guard; // TRANSITION, DevCom-10331414
+                    _Order_with<std::conditional_t<sizeof(_Key) == 4, _Avx512_4, _Avx512_8>>(_Op, _First, _Mid, _Last);
+                    return;
+                }
+#endif // ^^^ defined(_WIN64) ^^^
+
+                // With four 8-byte lanes, AVX2 partitioning doesn't beat the scalar partitioning
+                if constexpr (sizeof(_Key) == 4) {
+                    if (_Use_avx2()) {
+                        _Zeroupper_on_exit _Guard; // TRANSITION, DevCom-10331414
+                        _Order_with<_Avx2_4>(_Op, _First, _Mid, _Last);
+                        return;
+                    }
+                }
+            }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+
+            _Order_with<_Scalar_traits>(_Op, _First, _Mid, _Last);
+        }
+
+        template <class _Elem>
+        void _Order_4_8(const _Order_op _Op, void* const _First, void* const _Mid, void* const _Last,
+            const bool _Greater) noexcept {
+            using _Key = std::conditional_t<sizeof(_Elem) == 4, int32_t, int64_t>;
+
+            constexpr _Key _Key_max   = _Max_value<_Key>;
+            constexpr bool _Floating  = std::is_floating_point_v<_Elem>;
+            constexpr int _Sign_shift = sizeof(_Key) * 8 - 1;
+
+            _Key _Xor = std::is_unsigned_v<_Elem> ? ~_Key_max : 0;
+            if (_Greater) {
+                _Xor = ~_Xor;
+            }
+
+            _Key* const _First_key = static_cast<_Key*>(_First);
+            _Key* const _Last_key  = static_cast<_Key*>(_Last);
+
+            const bool _Mapped = _Floating || _Xor != 0;
+            if (_Mapped) {
+                for (_Key* _Ptr = _First_key; _Ptr != _Last_key; ++_Ptr) {
+                    _Key _Val = *_Ptr;
+                    if constexpr (_Floating) {
+                        _Val ^= (_Val >> _Sign_shift) & _Key_max;
+                    }
+
+                    *_Ptr = _Val ^ _Xor;
+                }
+            }
+
+            _Order_keys(_Op, _First_key, static_cast<_Key*>(_Mid), _Last_key);
+
+            if (_Mapped) {
+                for (_Key* _Ptr = _First_key; _Ptr != _Last_key; ++_Ptr) {
+                    _Key _Val = *_Ptr ^ _Xor;
+                    if constexpr (_Floating) {
+                        _Val ^= (_Val >> _Sign_shift) & _Key_max;
+                    }
+
+                    *_Ptr = _Val;
+                }
+            }
+        }
+
+        template <class _Elem>
+        void _Sort_1(void* const _First, void* const _Last, const bool _Greater) noexcept {
+            // _Key ^ _Xor enumerates the values in the requested order as _Key goes up.
+            const uint8_t _Xor = static_cast<uint8_t>((std::is_signed_v<_Elem> ? 0x80 : 0) ^ (_Greater ? 0xFF : 0));
+
+            uint8_t* const _First_ptr = static_cast<uint8_t*>(_First);
+            uint8_t* const _Last_ptr  = static_cast<uint8_t*>(_Last);
+            const size_t _Count       = static_cast<size_t>(_Last_ptr - _First_ptr);
+
+            if (_Count <= _Network_size) {
+                for (uint8_t* _Ptr = _First_ptr; _Ptr != _Last_ptr; ++_Ptr) {
+                    *_Ptr ^= _Xor;
+                }
+
+                _Sort_small(_First_ptr, _Count);
+
+                for (uint8_t* _Ptr = _First_ptr; _Ptr != _Last_ptr; ++_Ptr) {
+                    *_Ptr ^= _Xor;
+                }
+
+                return;
+            }
+
+            size_t _Counts[256] = {};
+            for (const uint8_t* _Ptr = _First_ptr; _Ptr != _Last_ptr; ++_Ptr) {
+                ++_Counts[*_Ptr];
+            }
+
+            uint8_t* _Out = _First_ptr;
+            for (unsigned int _Key = 0; _Key != 256; ++_Key) {
+                const uint8_t _Val = static_cast<uint8_t>(_Key ^ _Xor);
+                memset(_Out, _Val, _Counts[_Val]);
+                _Out += _Counts[_Val];
+            }
+        }
+
+        template <class _Elem>
+        void _Sort_2(void* const _First, void* const _Last, const bool _Greater) noexcept {
+            const uint16_t _Xor =
+                static_cast<uint16_t>((std::is_signed_v<_Elem> ? 0x8000 : 0) ^ (_Greater ? 0xFFFF : 0));
+
+            uint16_t* const _First_ptr = static_cast<uint16_t*>(_First);
+            uint16_t* const _Last_ptr  = static_cast<uint16_t*>(_Last);
+            const size_t _Count        = static_cast<size_t>(_Last_ptr - _First_ptr);
+
+            if (_Xor != 0) {
+                for (uint16_t* _Ptr = _First_ptr; _Ptr != _Last_ptr; ++_Ptr) {
+                    *_Ptr ^= _Xor;
+                }
+            }
+
+            if (_Count <= _Network_size) {
+                _Sort_small(_First_ptr, _Count);
+            } else {
+                // In-place bucketing by the high byte (American flag sort).
+                size_t _Next[256] = {};
+                size_t _Ends[256];
+                for (const uint16_t* _Ptr = _First_ptr; _Ptr != _Last_ptr; ++_Ptr) {
+                    ++_Next[*_Ptr >> 8];
+                }
+
+                size_t _Total = 0;
+                for (size_t _Bucket = 0; _Bucket != 256; ++_Bucket) {
+                    const size_t _Bucket_count = _Next[_Bucket];
+                    _Next[_Bucket]             = _Total;
+                    _Total += _Bucket_count;
+                    _Ends[_Bucket] = _Total;
+                }
+
+                for (size_t _Bucket = 0; _Bucket != 256; ++_Bucket) {
+                    while (_Next[_Bucket] != _Ends[_Bucket]) {
+                        uint16_t _Val = _First_ptr[_Next[_Bucket]];
+                        for (size_t _Dest = _Val >> 8; _Dest != _Bucket; _Dest = _Val >> 8) {
+                            const uint16_t _Displaced     = _First_ptr[_Next[_Dest]];
+                            _First_ptr[_Next[_Dest]++] = _Val;
+                            _Val                          = _Displaced;
+                        }
+
+                        _First_ptr[_Next[_Bucket]++] = _Val;
+                    }
+                }
+
+                // Each bucket shares the high byte, so counting the low byte is enough to rewrite it in order.
+                size_t _Bucket_first = 0;
+                for (size_t _Bucket = 0; _Bucket != 256; ++_Bucket) {
+                    uint16_t* const _Bucket_ptr = _First_ptr + _Bucket_first;
+                    const size_t _Bucket_count  = _Ends[_Bucket] - _Bucket_first;
+                    _Bucket_first               = _Ends[_Bucket];
+
+                    if (_Bucket_count <= _Network_size) {
+                        _Sort_small(_Bucket_ptr, _Bucket_count);
+                        continue;
+                    }
+
+                    size_t _Counts[256] = {};
+                    for (size_t _Ix = 0; _Ix != _Bucket_count; ++_Ix) {
+                        ++_Counts[_Bucket_ptr[_Ix] & 0xFF];
+                    }
+
+                    uint16_t* _Out = _Bucket_ptr;
+                    for (size_t _Low = 0; _Low != 256; ++_Low) {
+                        const uint16_t _Val = static_cast<uint16_t>((_Bucket << 8) | _Low);
+                        for (size_t _Ix = _Counts[_Low]; _Ix != 0; --_Ix) {
+                            *_Out = _Val;
+                            ++_Out;
+                        }
+                    }
+                }
+            }
+
+            if (_Xor != 0) {
+                for (uint16_t* _Ptr = _First_ptr; _Ptr != _Last_ptr; ++_Ptr) {
+                    *_Ptr ^= _Xor;
+                }
+            }
+        }
+    } // namespace _Sorting_values
+} // unnamed namespace
+
+extern "C" {
+
+__declspec(noalias) void __stdcall __std_sort_1i(void* const _First, void* const _Last, const bool _Greater) noexcept {
+    _Sorting_values::_Sort_1<int8_t>(_First, _Last, _Greater);
+}
+
+__declspec(noalias) void __stdcall __std_sort_1u(void* const _First, void* const _Last, const bool _Greater) noexcept {
+    _Sorting_values::_Sort_1<uint8_t>(_First, _Last, _Greater);
+}
+
+__declspec(noalias) void __stdcall __std_sort_2i(void* const _First, void* const _Last, const bool _Greater) noexcept {
+    _Sorting_values::_Sort_2<int16_t>(_First, _Last, _Greater);
+}
+
+__declspec(noalias) void __stdcall __std_sort_2u(void* const _First, void* const _Last, const bool _Greater) noexcept {
+    _Sorting_values::_Sort_2<uint16_t>(_First, _Last, _Greater);
+}
+
+__declspec(noalias) void __stdcall __std_sort_4i(void* const _First, void* const _Last, const bool _Greater) noexcept {
+    _Sorting_values::_Order_4_8<int32_t>(_Sorting_values::_Order_op::_Sort, _First, _Last, _Last, _Greater);
+}
+
+__declspec(noalias) void __stdcall __std_sort_4u(void* const _First, void* const _Last, const bool _Greater) noexcept {
+    _Sorting_values::_Order_4_8<uint32_t>(_Sorting_values::_Order_op::_Sort, _First, _Last, _Last, _Greater);
+}
+
+__declspec(noalias) void __stdcall __std_sort_8i(void* const _First, void* const _Last, const bool _Greater) noexcept {
+    _Sorting_values::_Order_4_8<int64_t>(_Sorting_values::_Order_op::_Sort, _First, _Last, _Last, _Greater);
+}
+
+__declspec(noalias) void __stdcall __std_sort_8u(void* const _First, void* const _Last, const bool _Greater) noexcept {
+    _Sorting_values::_Order_4_8<uint64_t>(_Sorting_values::_Order_op::_Sort, _First, _Last, _Last, _Greater);
+}
+
+__declspec(noalias) void __stdcall __std_sort_f(void* const _First, void* const _Last, const bool _Greater) noexcept {
+    _Sorting_values::_Order_4_8<float>(_Sorting_values::_Order_op::_Sort, _First, _Last, _Last, _Greater);
+}
+
+__declspec(noalias) void __stdcall __std_sort_d(void* const _First, void* const _Last, const bool _Greater) noexcept {
+    _Sorting_values::_Order_4_8<double>(_Sorting_values::_Order_op::_Sort, _First, _Last, _Last, _Greater);
+}
+
+__declspec(noalias) void __stdcall __std_nth_element_1i(
+    void* const _First, void* /* _Nth */, void* const _Last, const bool _Greater) noexcept {
+    _Sorting_values::_Sort_1<int8_t>(_First, _Last, _Greater); // full sort in linear time
+}
+
+__declspec(noalias) void __stdcall __std_nth_element_1u(
+    void* const _First, void* /* _Nth */, void* const _Last, const bool _Greater) noexcept {
+    _Sorting_values::_Sort_1<uint8_t>(_First, _Last, _Greater); // full sort in linear time
+}
+
+__declspec(noalias) void __stdcall __std_nth_element_2i(
+    void* const _First, void* /* _Nth */, void* const _Last, const bool _Greater) noexcept {
+    _Sorting_values::_Sort_2<int16_t>(_First, _Last, _Greater); // full sort in linear time
+}
+
+__declspec(noalias) void __stdcall __std_nth_element_2u(
+    void* const _First, void* /* _Nth */, void* const _Last, const bool _Greater) noexcept {
+    _Sorting_values::_Sort_2<uint16_t>(_First, _Last, _Greater); // full sort in linear time
+}
+
+__declspec(noalias) void __stdcall __std_nth_element_4i(
+    void* const _First, void* const _Nth, void* const _Last, const bool _Greater) noexcept {
+    _Sorting_values::_Order_4_8<int32_t>(_Sorting_values::_Order_op::_Nth_element, _First, _Nth, _Last, _Greater);
+}
+
+__declspec(noalias) void __stdcall __std_nth_element_4u(
+    void* const _First, void* const _Nth, void* const _Last, const bool _Greater) noexcept {
+    _Sorting_values::_Order_4_8<uint32_t>(_Sorting_values::_Order_op::_Nth_element, _First, _Nth, _Last, _Greater);
+}
+
+__declspec(noalias) void __stdcall __std_nth_element_8i(
+    void* const _First, void* const _Nth, void* const _Last, const bool _Greater) noexcept {
+    _Sorting_values::_Order_4_8<int64_t>(_Sorting_values::_Order_op::_Nth_element, _First, _Nth, _Last, _Greater);
+}
+
+__declspec(noalias) void __stdcall __std_nth_element_8u(
+    void* const _First, void* const _Nth, void* const _Last, const bool _Greater) noexcept {
+    _Sorting_values::_Order_4_8<uint64_t>(_Sorting_values::_Order_op::_Nth_element, _First, _Nth, _Last, _Greater);
+}
+
+__declspec(noalias) void __stdcall __std_nth_element_f(
+    void* const _First, void* const _Nth, void* const _Last, const bool _Greater) noexcept {
+    _Sorting_values::_Order_4_8<float>(_Sorting_values::_Order_op::_Nth_element, _First, _Nth, _Last, _Greater);
+}
+
+__declspec(noalias) void __stdcall __std_nth_element_d(
+    void* const _First, void* const _Nth, void* const _Last, const bool _Greater) noexcept {
+    _Sorting_values::_Order_4_8<double>(_Sorting_values::_Order_op::_Nth_element, _First, _Nth, _Last, _Greater);
+}
+
+__declspec(noalias) void __stdcall __std_partial_sort_1i(
+    void* const _First, void* /* _Mid */, void* const _Last, const bool _Greater) noexcept {
+    _Sorting_values::_Sort_1<int8_t>(_First, _Last, _Greater); // full sort in linear time
+}
+
+__declspec(noalias) void __stdcall __std_partial_sort_1u(
+    void* const _First, void* /* _Mid */, void* const _Last, const bool _Greater) noexcept {
+    _Sorting_values::_Sort_1<uint8_t>(_First, _Last, _Greater); // full sort in linear time
+}
+
+__declspec(noalias) void __stdcall __std_partial_sort_2i(
+    void* const _First, void* /* _Mid */, void* const _Last, const bool _Greater) noexcept {
+    _Sorting_values::_Sort_2<int16_t>(_First, _Last, _Greater); // full sort in linear time
+}
+
+__declspec(noalias) void __stdcall __std_partial_sort_2u(
+    void* const _First, void* /* _Mid */, void* const _Last, const bool _Greater) noexcept {
+    _Sorting_values::_Sort_2<uint16_t>(_First, _Last, _Greater); // full sort in linear time
+}
+
+__declspec(noalias) void __stdcall __std_partial_sort_4i(
+    void* const _First, void* const _Mid, void* const _Last, const bool _Greater) noexcept {
+    _Sorting_values::_Order_4_8<int32_t>(_Sorting_values::_Order_op::_Partial_sort, _First, _Mid, _Last, _Greater);
+}
+
+__declspec(noalias) void __stdcall __std_partial_sort_4u(
+    void* const _First, void* const _Mid, void* const _Last, const bool _Greater) noexcept {
+    _Sorting_values::_Order_4_8<uint32_t>(_Sorting_values::_Order_op::_Partial_sort, _First, _Mid, _Last, _Greater);
+}
+
+__declspec(noalias) void __stdcall __std_partial_sort_8i(
+    void* const _First, void* const _Mid, void* const _Last, const bool _Greater) noexcept {
+    _Sorting_values::_Order_4_8<int64_t>(_Sorting_values::_Order_op::_Partial_sort, _First, _Mid, _Last, _Greater);
+}
+
+__declspec(noalias) void __stdcall __std_partial_sort_8u(
+    void* const _First, void* const _Mid, void* const _Last, const bool _Greater) noexcept {
+    _Sorting_values::_Order_4_8<uint64_t>(_Sorting_values::_Order_op::_Partial_sort, _First, _Mid, _Last, _Greater);
+}
+
+__declspec(noalias) void __stdcall __std_partial_sort_f(
+    void* const _First, void* const _Mid, void* const _Last, const bool _Greater) noexcept {
+    _Sorting_values::_Order_4_8<float>(_Sorting_values::_Order_op::_Partial_sort, _First, _Mid, _Last, _Greater);
+}
+
+__declspec(noalias) void __stdcall __std_partial_sort_d(
+    void* const _First, void* const _Mid, void* const _Last, const bool _Greater) noexcept {
+    _Sorting_values::_Order_4_8<double>(_Sorting_values::_Order_op::_Partial_sort, _First, _Mid, _Last, _Greater);
+}
+
+} // extern "C"
+#endif // ^^^ !defined(_M_ARM64) ^^^
+
+#ifndef _M_ARM64
+namespace {
+    namespace _Bisecting {
+        // Binary search over sorted arithmetic values, without branches on the comparison results.
+        //
+        // Each step moves the base forward by a mask rather than by a branch, so it never mispredicts,
+        // and the sequence of steps depends only on the element count. So searches over the same range
+        // can walk in lockstep: equal_range finds both ends at once, and the batch search interleaves
+        // several keys, to have their independent loads in flight at the same time.
+        // While the window spans several cache lines, a single search prefetches both elements
+        // that the next step may probe, as its own loads are otherwise strictly serial.
+
+        constexpr size_t _Batch_lanes = 8;
+
+        template <class _Ty>
+        constexpr size_t _Line_elems = 64 / sizeof(_Ty);
+
+        template <class _Ty>
+        void _Prefetch(const _Ty* const _Ptr) noexcept {
+#ifdef _M_ARM64EC
+            (void) _Ptr;
+#else // ^^^ defined(_M_ARM64EC) / !defined(_M_ARM64EC) vvv
+            _mm_prefetch(reinterpret_cast<const char*>(_Ptr), _MM_HINT_T0);
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+        }
+
+        template <bool _Upper, class _Ty>
+        size_t _Goes_right(const _Ty _Elem, const _Ty _Val) noexcept {
+            if constexpr (_Upper) {
+                return !(_Val < _Elem);
+            } else {
+                return _Elem < _Val;
+            }
+        }
+
+        template <bool _Upper, class _Ty>
+        void _Step(const _Ty*& _Base, const size_t _Half, const _Ty _Val) noexcept {
+            // With the answer in [_Base, _Base + _Count] and _Half == _Count / 2, it's in [_Base, _Base + _Half]
+            // if it isn't past _Base[_Half], and in [_Base + _Half + 1, _Base + _Count] if it is; either way,
+            // it's in a window of _Count - _Half elements starting at the new _Base
+            _Base += _Half & (size_t{0} - _Goes_right<_Upper>(_Base[_Half], _Val));
+        }
+
+        template <bool _Upper, class _Ty>
+        const _Ty* _Bound(const _Ty* _Base, size_t _Count, const _Ty _Val) noexcept {
+            if (_Count == 0) {
+                return _Base;
+            }
+
+            while (_Count > _Line_elems<_Ty>) {
+                const size_t _Half = _Count / 2;
+                const size_t _Next = (_Count - _Half) / 2;
+                _Prefetch(_Base + _Next);
+                _Prefetch(_Base + _Half + _Next);
+                _Step<_Upper>(_Base, _Half, _Val);
+                _Count -= _Half;
+            }
+
+            while (_Count > 1) {
+                const size_t _Half = _Count / 2;
+                _Step<_Upper>(_Base, _Half, _Val);
+                _Count -= _Half;
+            }
+
+            return _Base + _Goes_right<_Upper>(*_Base, _Val);
+        }
+
+        template <class _Ty>
+        void _Equal_range(const _Ty*& _Lower, const _Ty*& _Upper, size_t _Count, const _Ty _Val) noexcept {
+            // Both ends start from the same base and step by the same halves; they diverge at the first
+            // probed element equivalent to _Val
+            if (_Count == 0) {
+                return;
+            }
+
+            while (_Count > _Line_elems<_Ty>) {
+                const size_t _Half = _Count / 2;
+                const size_t _Next = (_Count - _Half) / 2;
+                _Prefetch(_Lower + _Next);
+                _Prefetch(_Lower + _Half + _Next);
+                _Prefetch(_Upper + _Next);
+                _Prefetch(_Upper + _Half + _Next);
+                _Step<false>(_Lower, _Half, _Val);
+                _Step<true>(_Upper, _Half, _Val);
+                _Count -= _Half;
+            }
+
+            while (_Count > 1) {
+                const size_t _Half = _Count / 2;
+                _Step<false>(_Lower, _Half, _Val);
+                _Step<true>(_Upper, _Half, _Val);
+                _Count -= _Half;
+            }
+
+            _Lower += _Goes_right<false>(*_Lower, _Val);
+            _Upper += _Goes_right<true>(*_Upper, _Val);
+        }
+
+        template <class _Ty>
+        void _Lower_bound_batch(const _Ty* const _First, const size_t _Count, const _Ty* _Vals,
+            const _Ty* const _Vals_last, size_t* _Dest) noexcept {
+            if (_Count == 0) {
+                for (; _Vals != _Vals_last; ++_Vals, ++_Dest) {
+                    *_Dest = 0;
+                }
+
+                return;
+            }
+
+            // Full groups of keys go in lockstep; the loads of one step don't depend on each other,
+            // so they overlap without prefetching
+            for (; static_cast<size_t>(_Vals_last - _Vals) >= _Batch_lanes;
+                _Vals += _Batch_lanes, _Dest += _Batch_lanes) {
+                const _Ty* _Bases[_Batch_lanes];
+                for (size_t _Ix = 0; _Ix != _Batch_lanes; ++_Ix) {
+                    _Bases[_Ix] = _First;
+                }
+
+                for (size_t _Left = _Count; _Left > 1;) {
+                    const size_t _Half = _Left / 2;
+                    for (size_t _Ix = 0; _Ix != _Batch_lanes; ++_Ix) {
+                        _Step<false>(_Bases[_Ix], _Half, _Vals[_Ix]);
+                    }
+
+                    _Left -= _Half;
+                }
+
+                for (size_t _Ix = 0; _Ix != _Batch_lanes; ++_Ix) {
+                    const _Ty* const _Result = _Bases[_Ix] + _Goes_right<false>(*_Bases[_Ix], _Vals[_Ix]);
+                    _Dest[_Ix]               = static_cast<size_t>(_Result - _First);
+                }
+            }
+
+            for (; _Vals != _Vals_last; ++_Vals, ++_Dest) {
+                *_Dest = static_cast<size_t>(_Bound<false>(_First, _Count, *_Vals) - _First);
+            }
+        }
+
+        template <bool _Upper, class _Ty>
+        const void* _Bound_disp(const void* const _First, const void* const _Last, const _Ty _Val) noexcept {
+            const size_t _Count = _Byte_length(_First, _Last) / sizeof(_Ty);
+            return _Bound<_Upper>(static_cast<const _Ty*>(_First), _Count, _Val);
+        }
+
+        template <class _Ty>
+        const void* _Equal_range_disp(
+            const void* const _First, const void* const _Last, const _Ty _Val, const void** const _Upper) noexcept {
+            const size_t _Count   = _Byte_length(_First, _Last) / sizeof(_Ty);
+            const _Ty* _Lower_ptr = static_cast<const _Ty*>(_First);
+            const _Ty* _Upper_ptr = _Lower_ptr;
+            _Equal_range(_Lower_ptr, _Upper_ptr, _Count, _Val);
+            *_Upper = _Upper_ptr;
+            return _Lower_ptr;
+        }
+
+        template <class _Ty>
+        void _Lower_bound_batch_disp(const void* const _First, const void* const _Last, const void* const _First_val,
+            const void* const _Last_val, size_t* const _Dest) noexcept {
+            const size_t _Count = _Byte_length(_First, _Last) / sizeof(_Ty);
+            _Lower_bound_batch(static_cast<const _Ty*>(_First), _Count, static_cast<const _Ty*>(_First_val),
+                static_cast<const _Ty*>(_Last_val), _Dest);
+        }
+    } // namespace _Bisecting
+} // unnamed namespace
+
+extern "C" {
+
+const void* __stdcall __std_lower_bound_1i(
+    const void* const _First, const void* const _Last, const int8_t _Val) noexcept {
+    return _Bisecting::_Bound_disp<false, int8_t>(_First, _Last, _Val);
+}
+
+const void* __stdcall __std_lower_bound_1u(
+    const void* const _First, const void* const _Last, const uint8_t _Val) noexcept {
+    return _Bisecting::_Bound_disp<false, uint8_t>(_First, _Last, _Val);
+}
+
+const void* __stdcall __std_lower_bound_2i(
+    const void* const _First, const void* const _Last, const int16_t _Val) noexcept {
+    return _Bisecting::_Bound_disp<false, int16_t>(_First, _Last, _Val);
+}
+
+const void* __stdcall __std_lower_bound_2u(
+    const void* const _First, const void* const _Last, const uint16_t _Val) noexcept {
+    return _Bisecting::_Bound_disp<false, uint16_t>(_First, _Last, _Val);
+}
+
+const void* __stdcall __std_lower_bound_4i(
+    const void* const _First, const void* const _Last, const int32_t _Val) noexcept {
+    return _Bisecting::_Bound_disp<false, int32_t>(_First, _Last, _Val);
+}
+
+const void* __stdcall __std_lower_bound_4u(
+    const void* const _First, const void* const _Last, const uint32_t _Val) noexcept {
+    return _Bisecting::_Bound_disp<false, uint32_t>(_First, _Last, _Val);
+}
+
+const void* __stdcall __std_lower_bound_8i(
+    const void* const _First, const void* const _Last, const int64_t _Val) noexcept {
+    return _Bisecting::_Bound_disp<false, int64_t>(_First, _Last, _Val);
+}
+
+const void* __stdcall __std_lower_bound_8u(
+    const void* const _First, const void* const _Last, const uint64_t _Val) noexcept {
+    return _Bisecting::_Bound_disp<false, uint64_t>(_First, _Last, _Val);
+}
+
+const void* __stdcall __std_lower_bound_f(
+    const void* const _First, const void* const _Last, const float _Val) noexcept {
+    return _Bisecting::_Bound_disp<false, float>(_First, _Last, _Val);
+}
+
+const void* __stdcall __std_lower_bound_d(
+    const void* const _First, const void* const _Last, const double _Val) noexcept {
+    return _Bisecting::_Bound_disp<false, double>(_First, _Last, _Val);
+}
+
+const void* __stdcall __std_upper_bound_1i(
+    const void* const _First, const void* const _Last, const int8_t _Val) noexcept {
+    return _Bisecting::_Bound_disp<true, int8_t>(_First, _Last, _Val);
+}
+
+const void* __stdcall __std_upper_bound_1u(
+    const void* const _First, const void* const _Last, const uint8_t _Val) noexcept {
+    return _Bisecting::_Bound_disp<true, uint8_t>(_First, _Last, _Val);
+}
+
+const void* __stdcall __std_upper_bound_2i(
+    const void* const _First, const void* const _Last, const int16_t _Val) noexcept {
+    return _Bisecting::_Bound_disp<true, int16_t>(_First, _Last, _Val);
+}
+
+const void* __stdcall __std_upper_bound_2u(
+    const void* const _First, const void* const _Last, const uint16_t _Val) noexcept {
+    return _Bisecting::_Bound_disp<true, uint16_t>(_First, _Last, _Val);
+}
+
+const void* __stdcall __std_upper_bound_4i(
+    const void* const _First, const void* const _Last, const int32_t _Val) noexcept {
+    return _Bisecting::_Bound_disp<true, int32_t>(_First, _Last, _Val);
+}
+
+const void* __stdcall __std_upper_bound_4u(
+    const void* const _First, const void* const _Last, const uint32_t _Val) noexcept {
+    return _Bisecting::_Bound_disp<true, uint32_t>(_First, _Last, _Val);
+}
+
+const void* __stdcall __std_upper_bound_8i(
+    const void* const _First, const void* const _Last, const int64_t _Val) noexcept {
+    return _Bisecting::_Bound_disp<true, int64_t>(_First, _Last, _Val);
+}
+
+const void* __stdcall __std_upper_bound_8u(
+    const void* const _First, const void* const _Last, const uint64_t _Val) noexcept {
+    return _Bisecting::_Bound_disp<true, uint64_t>(_First, _Last, _Val);
+}
+
+const void* __stdcall __std_upper_bound_f(
+    const void* const _First, const void* const _Last, const float _Val) noexcept {
+    return _Bisecting::_Bound_disp<true, float>(_First, _Last, _Val);
+}
+
+const void* __stdcall __std_upper_bound_d(
+    const void* const _First, const void* const _Last, const double _Val) noexcept {
+    return _Bisecting::_Bound_disp<true, double>(_First, _Last, _Val);
+}
+
+const void* __stdcall __std_equal_range_1i(
+    const void* const _First, const void* const _Last, const int8_t _Val, const void** const _Upper) noexcept {
+    return _Bisecting::_Equal_range_disp<int8_t>(_First, _Last, _Val, _Upper);
+}
+
+const void* __stdcall __std_equal_range_1u(
+    const void* const _First, const void* const _Last, const uint8_t _Val, const void** const _Upper) noexcept {
+    return _Bisecting::_Equal_range_disp<uint8_t>(_First, _Last, _Val, _Upper);
+}
+
+const void* __stdcall __std_equal_range_2i(
+    const void* const _First, const void* const _Last, const int16_t _Val, const void** const _Upper) noexcept {
+    return _Bisecting::_Equal_range_disp<int16_t>(_First, _Last, _Val, _Upper);
+}
+
+const void* __stdcall __std_equal_range_2u(
+    const void* const _First, const void* const _Last, const uint16_t _Val, const void** const _Upper) noexcept {
+    return _Bisecting::_Equal_range_disp<uint16_t>(_First, _Last, _Val, _Upper);
+}
+
+const void* __stdcall __std_equal_range_4i(
+    const void* const _First, const void* const _Last, const int32_t _Val, const void** const _Upper) noexcept {
+    return _Bisecting::_Equal_range_disp<int32_t>(_First, _Last, _Val, _Upper);
+}
+
+const void* __stdcall __std_equal_range_4u(
+    const void* const _First, const void* const _Last, const uint32_t _Val, const void** const _Upper) noexcept {
+    return _Bisecting::_Equal_range_disp<uint32_t>(_First, _Last, _Val, _Upper);
+}
+
+const void* __stdcall __std_equal_range_8i(
+    const void* const _First, const void* const _Last, const int64_t _Val, const void** const _Upper) noexcept {
+    return _Bisecting::_Equal_range_disp<int64_t>(_First, _Last, _Val, _Upper);
+}
+
+const void* __stdcall __std_equal_range_8u(
+    const void* const _First, const void* const _Last, const uint64_t _Val, const void** const _Upper) noexcept {
+    return _Bisecting::_Equal_range_disp<uint64_t>(_First, _Last, _Val, _Upper);
+}
+
+const void* __stdcall __std_equal_range_f(
+    const void* const _First, const void* const _Last, const float _Val, const void** const _Upper) noexcept {
+    return _Bisecting::_Equal_range_disp<float>(_First, _Last, _Val, _Upper);
+}
+
+const void* __stdcall __std_equal_range_d(
+    const void* const _First, const void* const _Last, const double _Val, const void** const _Upper) noexcept {
+    return _Bisecting::_Equal_range_disp<double>(_First, _Last, _Val, _Upper);
+}
+
+__declspec(noalias) void __stdcall __std_lower_bound_batch_1i(const void* const _First, const void* const _Last,
+    const void* const _First_val, const void* const _Last_val, size_t* const _Dest) noexcept {
+    _Bisecting::_Lower_bound_batch_disp<int8_t>(_First, _Last, _First_val, _Last_val, _Dest);
+}
+
+__declspec(noalias) void __stdcall __std_lower_bound_batch_1u(const void* const _First, const void* const _Last,
+    const void* const _First_val, const void* const _Last_val, size_t* const _Dest) noexcept {
+    _Bisecting::_Lower_bound_batch_disp<uint8_t>(_First, _Last, _First_val, _Last_val, _Dest);
+}
+
+__declspec(noalias) void __stdcall __std_lower_bound_batch_2i(const void* const _First, const void* const _Last,
+    const void* const _First_val, const void* const _Last_val, size_t* const _Dest) noexcept {
+    _Bisecting::_Lower_bound_batch_disp<int16_t>(_First, _Last, _First_val, _Last_val, _Dest);
+}
+
+__declspec(noalias) void __stdcall __std_lower_bound_batch_2u(const void* const _First, const void* const _Last,
+    const void* const _First_val, const void* const _Last_val, size_t* const _Dest) noexcept {
+    _Bisecting::_Lower_bound_batch_disp<uint16_t>(_First, _Last, _First_val, _Last_val, _Dest);
+}
+
+__declspec(noalias) void __stdcall __std_lower_bound_batch_4i(const void* const _First, const void* const _Last,
+    const void* const _First_val, const void* const _Last_val, size_t* const _Dest) noexcept {
+    _Bisecting::_Lower_bound_batch_disp<int32_t>(_First, _Last, _First_val, _Last_val, _Dest);
+}
+
+__declspec(noalias) void __stdcall __std_lower_bound_batch_4u(const void* const _First, const void* const _Last,
+    const void* const _First_val, const void* const _Last_val, size_t* const _Dest) noexcept {
+    _Bisecting::_Lower_bound_batch_disp<uint32_t>(_First, _Last, _First_val, _Last_val, _Dest);
+}
+
+__declspec(noalias) void __stdcall __std_lower_bound_batch_8i(const void* const _First, const void* const _Last,
+    const void* const _First_val, const void* const _Last_val, size_t* const _Dest) noexcept {
+    _Bisecting::_Lower_bound_batch_disp<int64_t>(_First, _Last, _First_val, _Last_val, _Dest);
+}
+
+__declspec(noalias) void __stdcall __std_lower_bound_batch_8u(const void* const _First, const void* const _Last,
+    const void* const _First_val, const void* const _Last_val, size_t* const _Dest) noexcept {
+    _Bisecting::_Lower_bound_batch_disp<uint64_t>(_First, _Last, _First_val, _Last_val, _Dest);
+}
+
+__declspec(noalias) void __stdcall __std_lower_bound_batch_f(const void* const _First, const void* const _Last,
+    const void* const _First_val, const void* const _Last_val, size_t* const _Dest) noexcept {
+    _Bisecting::_Lower_bound_batch_disp<float>(_First, _Last, _First_val, _Last_val, _Dest);
+}
+
+__declspec(noalias) void __stdcall __std_lower_bound_batch_d(const void* const _First, const void* const _Last,
+    const void* const _First_val, const void* const _Last_val, size_t* const _Dest) noexcept {
+    _Bisecting::_Lower_bound_batch_disp<double>(_First, _Last, _First_val, _Last_val, _Dest);
+}
+
+} // extern "C"
+#endif // ^^^ !defined(_M_ARM64) ^^^
+
+#ifndef _M_ARM64
+namespace {
+    namespace _Set_operations {
+        // Set operations and merge over sorted 4- and 8-byte integers.
+        //
+        // The set operations look at a window of one vector from each range. With _Bound being the smaller of the
+        // two windows' last elements, every remaining occurrence of a value below _Bound is inside the windows, so
+        // those prefixes can be settled on their own: each element is tested against all lanes of the other window
+        // with rotated compares, and the survivors are compressed to the output. A value equal to _Bound is settled
+        // too, unless a range continues with it past its window. Counts of repeated values matter, so a window
+        // that has them falls back to the scalar loop, and a run of _Bound that stalls the windows is counted out.
+        //
+        // Merge keeps a vector of the greatest elements seen so far, and merges it with the next vector from the
+        // range with the smaller head by a bitonic network; the lesser half of the result is final.
+        //
+        // When one range is much shorter, its elements are looked up in the other by galloping search instead.
+
+        enum class _Op_kind { _Intersection, _Difference, _Union, _Symmetric_difference, _Merge };
+
+        // Take the lookup path when the longer range is at least this many times longer than the shorter one.
+        constexpr size_t _Skew_ratio = 32;
+
+        template <class _Ty>
+        _Ty* _Copy_tail(const _Ty* const _First, const _Ty* const _Last, _Ty* const _Dest) noexcept {
+            const size_t _Count = static_cast<size_t>(_Last - _First);
+            if (_Count != 0) {
+                memcpy(_Dest, _First, _Count * sizeof(_Ty));
+            }
+
+            return _Dest + _Count;
+        }
+
+        template <_Op_kind _Op, class _Ty>
+        _Ty* _Scalar(const _Ty* _First1, const _Ty* const _Last1, const _Ty* _First2, const _Ty* const _Last2,
+            _Ty* _Dest) noexcept {
+            while (_First1 != _Last1 && _First2 != _Last2) {
+                const _Ty _Val1 = *_First1;
+                const _Ty _Val2 = *_First2;
+                if constexpr (_Op == _Op_kind::_Merge) {
+                    if (_Val2 < _Val1) {
+                        *_Dest = _Val2;
+                        ++_First2;
+                    } else {
+                        *_Dest = _Val1;
+                        ++_First1;
+                    }
+
+                    ++_Dest;
+                } else if (_Val1 < _Val2) {
+                    if constexpr (_Op != _Op_kind::_Intersection) {
+                        *_Dest = _Val1;
+                        ++_Dest;
+                    }
+
+                    ++_First1;
+                } else if (_Val2 < _Val1) {
+                    if constexpr (_Op == _Op_kind::_Union || _Op == _Op_kind::_Symmetric_difference) {
+                        *_Dest = _Val2;
+                        ++_Dest;
+                    }
+
+                    ++_First2;
+                } else {
+                    if constexpr (_Op == _Op_kind::_Intersection || _Op == _Op_kind::_Union) {
+                        *_Dest = _Val1;
+                        ++_Dest;
+                    }
+
+                    ++_First1;
+                    ++_First2;
+                }
+            }
+
+            if constexpr (_Op != _Op_kind::_Intersection) {
+                _Dest = _Copy_tail(_First1, _Last1, _Dest);
+            }
+
+            if constexpr (_Op == _Op_kind::_Union || _Op == _Op_kind::_Symmetric_difference
+                          || _Op == _Op_kind::_Merge) {
+                _Dest = _Copy_tail(_First2, _Last2, _Dest);
+            }
+
+            return _Dest;
+        }
+
+        template <_Op_kind _Op, class _Ty>
+        _Ty* _Equal_run(const _Ty*& _First1, const _Ty* const _Last1, const _Ty*& _First2, const _Ty* const _Last2,
+            const _Ty _Val, _Ty* _Dest) noexcept {
+            // Neither range has anything less than _Val left; consume the runs of _Val from both
+            size_t _Run1 = 0;
+            for (; _First1 != _Last1 && *_First1 == _Val; ++_First1) {
+                ++_Run1;
+            }
+
+            size_t _Run2 = 0;
+            for (; _First2 != _Last2 && *_First2 == _Val; ++_First2) {
+                ++_Run2;
+            }
+
+            size_t _Count;
+            if constexpr (_Op == _Op_kind::_Intersection) {
+                _Count = _Run1 < _Run2 ? _Run1 : _Run2;
+            } else if constexpr (_Op == _Op_kind::_Difference) {
+                _Count = _Run1 > _Run2 ? _Run1 - _Run2 : 0;
+            } else if constexpr (_Op == _Op_kind::_Union) {
+                _Count = _Run1 > _Run2 ? _Run1 : _Run2;
+            } else {
+                static_assert(_Op == _Op_kind::_Symmetric_difference, "unexpected operation");
+                _Count = _Run1 > _Run2 ? _Run1 - _Run2 : _Run2 - _Run1;
+            }
+
+            for (; _Count != 0; --_Count) {
+                *_Dest = _Val;
+                ++_Dest;
+            }
+
+            return _Dest;
+        }
+
+        template <class _Ty>
+        const _Ty* _Gallop(const _Ty* _First, const _Ty* const _Last, const _Ty _Key) noexcept {
+            // Lower bound of _Key in [_First, _Last), searching first for a window doubling away from _First
+            if (_First == _Last || !(*_First < _Key)) {
+                return _First;
+            }
+
+            size_t _Count = static_cast<size_t>(_Last - _First);
+            size_t _Step  = 1;
+            while (_Step < _Count && _First[_Step] < _Key) {
+                _First += _Step;
+                _Count -= _Step;
+                _Step *= 2;
+            }
+
+            // *_First is less than _Key, and the bound is at most _Step elements past it
+            const size_t _Window = _Step < _Count ? _Step : _Count;
+            return _Bisecting::_Bound<false>(_First + 1, _Window - 1, _Key);
+        }
+
+        template <_Op_kind _Op, bool _Keys_first, class _Ty>
+        _Ty* _Lookup(const _Ty* _Keys, const _Ty* const _Keys_last, const _Ty* _Other, const _Ty* const _Other_last,
+            _Ty* _Dest) noexcept {
+            // The range [_Keys, _Keys_last) is the short one, it comes first if _Keys_first.
+            // Each key is found in what's left of the other range; every key consumes at most one equal element,
+            // which keeps the counts of repeated values right.
+            constexpr bool _Emit_other = _Op == _Op_kind::_Union || _Op == _Op_kind::_Symmetric_difference
+                                      || _Op == _Op_kind::_Merge
+                                      || (_Op == _Op_kind::_Difference && !_Keys_first);
+
+            for (; _Keys != _Keys_last; ++_Keys) {
+                const _Ty _Key          = *_Keys;
+                const _Ty* const _Found = _Gallop(_Other, _Other_last, _Key);
+                const bool _Match       = _Found != _Other_last && *_Found == _Key;
+
+                if constexpr (_Emit_other) {
+                    _Dest = _Copy_tail(_Other, _Found, _Dest);
+                }
+
+                bool _Emit_key;
+                if constexpr (_Op == _Op_kind::_Intersection) {
+                    _Emit_key = _Match;
+                } else if constexpr (_Op == _Op_kind::_Difference) {
+                    _Emit_key = _Keys_first && !_Match;
+                } else if constexpr (_Op == _Op_kind::_Symmetric_difference) {
+                    _Emit_key = !_Match;
+                } else {
+                    _Emit_key = true;
+                }
+
+                if (_Emit_key) {
+                    *_Dest = _Key;
+                    ++_Dest;
+                }
+
+                if constexpr (_Op == _Op_kind::_Merge) {
+                    _Other = _Found;
+                } else {
+                    _Other = _Found + _Match;
+                }
+            }
+
+            if constexpr (_Emit_other) {
+                _Dest = _Copy_tail(_Other, _Other_last, _Dest);
+            }
+
+            return _Dest;
+        }
+
+#ifndef _M_ARM64EC
+        constexpr auto _Partition_tables_8_avx = _Sorting_values::_Make_partition_tables<16, 4>();
+
+        template <bool _Signed>
+        struct _Avx2_4 {
+            using _Ty = std::conditional_t<_Signed, int32_t, uint32_t>;
+
+            static constexpr size_t _Lanes = 8;
+
+            static __m256i _Load(const _Ty* const _Src) noexcept {
+                return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Src));
+            }
+
+            static __m256i _Set(const _Ty _Val) noexcept {
+                return _mm256_set1_epi32(static_cast<int32_t>(_Val));
+            }
+
+            static void _Store(_Ty* const _Dest, const __m256i _Val) noexcept {
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Dest), _Val);
+            }
+
+            static void _Store_n(_Ty* const _Dest, const __m256i _Val, const size_t _Count) noexcept {
+                _mm256_maskstore_epi32(reinterpret_cast<int*>(_Dest), _Avx2_tail_mask_32(_Count * 4), _Val);
+            }
+
+            static unsigned long _Mask(const __m256i _Val) noexcept {
+                return static_cast<unsigned long>(_mm256_movemask_ps(_mm256_castsi256_ps(_Val)));
+            }
+
+            static unsigned long _Mask_gt(const __m256i _Left, const __m256i _Right) noexcept {
+                if constexpr (_Signed) {
+                    return _Mask(_mm256_cmpgt_epi32(_Left, _Right));
+                } else {
+                    const __m256i _Bias = _mm256_set1_epi32(static_cast<int32_t>(0x8000'0000));
+                    return _Mask(_mm256_cmpgt_epi32(_mm256_xor_si256(_Left, _Bias), _mm256_xor_si256(_Right, _Bias)));
+                }
+            }
+
+            static unsigned long _Mask_eq(const __m256i _Left, const __m256i _Right) noexcept {
+                return _Mask(_mm256_cmpeq_epi32(_Left, _Right));
+            }
+
+            static unsigned long _Mask_adjacent_eq(const __m256i _Val) noexcept {
+                // Lane _Ix is set if it's equal to lane _Ix + 1
+                const __m256i _Next = _mm256_permutevar8x32_epi32(_Val, _mm256_setr_epi32(1, 2, 3, 4, 5, 6, 7, 7));
+                return _Mask_eq(_Val, _Next) & 0x7F;
+            }
+
+            static unsigned long _Matches(const __m256i _Left, const __m256i _Right) noexcept {
+                // Lane _Ix is set if it's equal to any lane of _Right; rotations within 128-bit halves, then the
+                // same with the halves swapped, line up every pair of lanes
+                const __m256i _Swapped = _mm256_permute2x128_si256(_Right, _Right, 1);
+                __m256i _Eq            = _mm256_cmpeq_epi32(_Left, _Right);
+                _Eq = _mm256_or_si256(_Eq, _mm256_cmpeq_epi32(_Left, _mm256_shuffle_epi32(_Right, 0x39)));
+                _Eq = _mm256_or_si256(_Eq, _mm256_cmpeq_epi32(_Left, _mm256_shuffle_epi32(_Right, 0x4E)));
+                _Eq = _mm256_or_si256(_Eq, _mm256_cmpeq_epi32(_Left, _mm256_shuffle_epi32(_Right, 0x93)));
+                _Eq = _mm256_or_si256(_Eq, _mm256_cmpeq_epi32(_Left, _Swapped));
+                _Eq = _mm256_or_si256(_Eq, _mm256_cmpeq_epi32(_Left, _mm256_shuffle_epi32(_Swapped, 0x39)));
+                _Eq = _mm256_or_si256(_Eq, _mm256_cmpeq_epi32(_Left, _mm256_shuffle_epi32(_Swapped, 0x4E)));
+                _Eq = _mm256_or_si256(_Eq, _mm256_cmpeq_epi32(_Left, _mm256_shuffle_epi32(_Swapped, 0x93)));
+                return _Mask(_Eq);
+            }
+
+            static __m256i _Compress(const __m256i _Val, const unsigned long _Mask) noexcept {
+                const auto& _Table   = _Sorting_values::_Partition_tables_4_avx;
+                const __m128i _Shuf8 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(_Table._Shuf[_Mask]));
+                return _mm256_permutevar8x32_epi32(_Val, _mm256_cvtepu8_epi32(_Shuf8));
+            }
+
+            static __m256i _Fill_max(const __m256i _Val, const size_t _Count) noexcept {
+                // Lanes from _Count on become the maximum value, so they sort last
+                const __m256i _Max = _Set(_Sorting_values::_Max_value<_Ty>);
+                return _mm256_blendv_epi8(_Max, _Val, _Avx2_tail_mask_32(_Count * 4));
+            }
+
+            static __m256i _Min(const __m256i _Left, const __m256i _Right) noexcept {
+                if constexpr (_Signed) {
+                    return _mm256_min_epi32(_Left, _Right);
+                } else {
+                    return _mm256_min_epu32(_Left, _Right);
+                }
+            }
+
+            static __m256i _Max(const __m256i _Left, const __m256i _Right) noexcept {
+                if constexpr (_Signed) {
+                    return _mm256_max_epi32(_Left, _Right);
+                } else {
+                    return _mm256_max_epu32(_Left, _Right);
+                }
+            }
+
+            static __m256i _Sort_bitonic(__m256i _Val) noexcept {
+                __m256i _Other = _mm256_permute2x128_si256(_Val, _Val, 1);
+                _Val           = _mm256_blend_epi32(_Min(_Val, _Other), _Max(_Val, _Other), 0xF0);
+                _Other         = _mm256_shuffle_epi32(_Val, 0x4E);
+                _Val           = _mm256_blend_epi32(_Min(_Val, _Other), _Max(_Val, _Other), 0xCC);
+                _Other         = _mm256_shuffle_epi32(_Val, 0xB1);
+                return _mm256_blend_epi32(_Min(_Val, _Other), _Max(_Val, _Other), 0xAA);
+            }
+
+            static void _Merge_sorted(__m256i& _Low, __m256i& _High) noexcept {
+                // Both are sorted; afterwards _Low has the lesser half of their lanes and _High the greater, sorted
+                const __m256i _Reversed =
+                    _mm256_permutevar8x32_epi32(_High, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+                const __m256i _Min_val = _Min(_Low, _Reversed);
+                const __m256i _Max_val = _Max(_Low, _Reversed);
+                _Low                   = _Sort_bitonic(_Min_val);
+                _High                  = _Sort_bitonic(_Max_val);
+            }
+        };
+
+        template <bool _Signed>
+        struct _Avx2_8 {
+            using _Ty = std::conditional_t<_Signed, int64_t, uint64_t>;
+
+            static constexpr size_t _Lanes = 4;
+
+            static __m256i _Load(const _Ty* const _Src) noexcept {
+                return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Src));
+            }
+
+            static __m256i _Set(const _Ty _Val) noexcept {
+                return _mm256_set1_epi64x(static_cast<int64_t>(_Val));
+            }
+
+            static void _Store(_Ty* const _Dest, const __m256i _Val) noexcept {
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Dest), _Val);
+            }
+
+            static void _Store_n(_Ty* const _Dest, const __m256i _Val, const size_t _Count) noexcept {
+                _mm256_maskstore_epi64(reinterpret_cast<long long*>(_Dest), _Avx2_tail_mask_32(_Count * 8), _Val);
+            }
+
+            static unsigned long _Mask(const __m256i _Val) noexcept {
+                return static_cast<unsigned long>(_mm256_movemask_pd(_mm256_castsi256_pd(_Val)));
+            }
+
+            static __m256i _Cmp_gt(const __m256i _Left, const __m256i _Right) noexcept {
+                if constexpr (_Signed) {
+                    return _mm256_cmpgt_epi64(_Left, _Right);
+                } else {
+                    const __m256i _Bias = _mm256_set1_epi64x(static_cast<int64_t>(0x8000'0000'0000'0000));
+                    return _mm256_cmpgt_epi64(_mm256_xor_si256(_Left, _Bias), _mm256_xor_si256(_Right, _Bias));
+                }
+            }
+
+            static unsigned long _Mask_gt(const __m256i _Left, const __m256i _Right) noexcept {
+                return _Mask(_Cmp_gt(_Left, _Right));
+            }
+
+            static unsigned long _Mask_eq(const __m256i _Left, const __m256i _Right) noexcept {
+                return _Mask(_mm256_cmpeq_epi64(_Left, _Right));
+            }
+
+            static unsigned long _Mask_adjacent_eq(const __m256i _Val) noexcept {
+                // Lane _Ix is set if it's equal to lane _Ix + 1
+                return _Mask_eq(_Val, _mm256_permute4x64_epi64(_Val, _MM_SHUFFLE(3, 3, 2, 1))) & 0x7;
+            }
+
+            static unsigned long _Matches(const __m256i _Left, const __m256i _Right) noexcept {
+                // Lane _Ix is set if it's equal to any lane of _Right
+                const __m256i _Swapped = _mm256_permute2x128_si256(_Right, _Right, 1);
+                __m256i _Eq            = _mm256_cmpeq_epi64(_Left, _Right);
+                _Eq = _mm256_or_si256(_Eq, _mm256_cmpeq_epi64(_Left, _mm256_shuffle_epi32(_Right, 0x4E)));
+                _Eq = _mm256_or_si256(_Eq, _mm256_cmpeq_epi64(_Left, _Swapped));
+                _Eq = _mm256_or_si256(_Eq, _mm256_cmpeq_epi64(_Left, _mm256_shuffle_epi32(_Swapped, 0x4E)));
+                return _Mask(_Eq);
+            }
+
+            static __m256i _Compress(const __m256i _Val, const unsigned long _Mask) noexcept {
+                // Expand the lane indices from the table to pairs of 32-bit indices for vpermd
+                uint32_t _Shuf4;
+                memcpy(&_Shuf4, _Partition_tables_8_avx._Shuf[_Mask], 4);
+                const __m256i _Lane  = _mm256_slli_epi64(_mm256_cvtepu8_epi64(_mm_cvtsi32_si128(_Shuf4)), 1);
+                const __m256i _Upper = _mm256_slli_epi64(_mm256_add_epi64(_Lane, _mm256_set1_epi64x(1)), 32);
+                return _mm256_permutevar8x32_epi32(_Val, _mm256_or_si256(_Lane, _Upper));
+            }
+
+            static __m256i _Fill_max(const __m256i _Val, const size_t _Count) noexcept {
+                // Lanes from _Count on become the maximum value, so they sort last
+                const __m256i _Max = _Set(_Sorting_values::_Max_value<_Ty>);
+                return _mm256_blendv_epi8(_Max, _Val, _Avx2_tail_mask_32(_Count * 8));
+            }
+
+            static void _Min_max(__m256i& _Low, __m256i& _High) noexcept {
+                const __m256i _Gt = _Cmp_gt(_Low, _High);
+                const __m256i _Lo = _mm256_blendv_epi8(_Low, _High, _Gt);
+                _High             = _mm256_blendv_epi8(_High, _Low, _Gt);
+                _Low              = _Lo;
+            }
+
+            static __m256i _Sort_bitonic(__m256i _Val) noexcept {
+                __m256i _Other = _mm256_permute2x128_si256(_Val, _Val, 1);
+                __m256i _Low   = _Val;
+                _Min_max(_Low, _Other);
+                _Val   = _mm256_blend_epi32(_Low, _Other, 0xF0);
+                _Other = _mm256_shuffle_epi32(_Val, 0x4E);
+                _Low   = _Val;
+                _Min_max(_Low, _Other);
+                return _mm256_blend_epi32(_Low, _Other, 0xCC);
+            }
+
+            static void _Merge_sorted(__m256i& _Low, __m256i& _High) noexcept {
+                // Both are sorted; afterwards _Low has the lesser half of their lanes and _High the greater, sorted
+                __m256i _Reversed = _mm256_permute4x64_epi64(_High, _MM_SHUFFLE(0, 1, 2, 3));
+                _Min_max(_Low, _Reversed);
+                _High = _Sort_bitonic(_Reversed);
+                _Low  = _Sort_bitonic(_Low);
+            }
+        };
+
+        template <class _Traits, _Op_kind _Op, class _Ty>
+        _Ty* _Set_op_avx2(const _Ty*& _First1, const _Ty* const _Last1, const _Ty*& _First2, const _Ty* const _Last2,
+            _Ty* _Dest) noexcept {
+            constexpr size_t _Lanes = _Traits::_Lanes;
+
+            _Zeroupper_on_exit _Guard; // TRANSITION, DevCom-10331414
+
+            while (static_cast<size_t>(_Last1 - _First1) >= _Lanes && static_cast<size_t>(_Last2 - _First2) >= _Lanes) {
+                const _Ty _Max1  = _First1[_Lanes - 1];
+                const _Ty _Max2  = _First2[_Lanes - 1];
+                const _Ty _Bound = _Max2 < _Max1 ? _Max2 : _Max1;
+
+                const __m256i _Val1      = _Traits::_Load(_First1);
+                const __m256i _Val2      = _Traits::_Load(_First2);
+                const __m256i _Bound_vec = _Traits::_Set(_Bound);
+
+                size_t _Count1 = _Lanes - __popcnt(_Traits::_Mask_gt(_Val1, _Bound_vec));
+                size_t _Count2 = _Lanes - __popcnt(_Traits::_Mask_gt(_Val2, _Bound_vec));
+
+                if ((_Max1 == _Bound && _First1 + _Lanes != _Last1 && _First1[_Lanes] == _Bound)
+                    || (_Max2 == _Bound && _First2 + _Lanes != _Last2 && _First2[_Lanes] == _Bound)) {
+                    // There's more of _Bound past a window, leave it for later
+                    _Count1 -= __popcnt(_Traits::_Mask_eq(_Val1, _Bound_vec));
+                    _Count2 -= __popcnt(_Traits::_Mask_eq(_Val2, _Bound_vec));
+
+                    if (_Count1 == 0 && _Count2 == 0) {
+                        _Dest = _Equal_run<_Op>(_First1, _Last1, _First2, _Last2, _Bound, _Dest);
+                        continue;
+                    }
+                }
+
+                const unsigned long _Active1 = (1ul << _Count1) - 1;
+                const unsigned long _Active2 = (1ul << _Count2) - 1;
+
+                if (((_Traits::_Mask_adjacent_eq(_Val1) & (_Active1 >> 1))
+                        | (_Traits::_Mask_adjacent_eq(_Val2) & (_Active2 >> 1)))
+                    != 0) {
+                    _Dest = _Scalar<_Op>(_First1, _First1 + _Count1, _First2, _First2 + _Count2, _Dest);
+                } else if constexpr (_Op == _Op_kind::_Intersection || _Op == _Op_kind::_Difference) {
+                    unsigned long _Keep = _Traits::_Matches(_Val1, _Val2);
+                    if constexpr (_Op == _Op_kind::_Difference) {
+                        _Keep = ~_Keep;
+                    }
+
+                    _Keep &= _Active1;
+                    const size_t _Count = __popcnt(_Keep);
+                    _Traits::_Store_n(_Dest, _Traits::_Compress(_Val1, _Keep), _Count);
+                    _Dest += _Count;
+                } else {
+                    // The parts kept from each window are merged; lanes past them are filled with the maximum value
+                    unsigned long _Keep1 = _Active1;
+                    if constexpr (_Op == _Op_kind::_Symmetric_difference) {
+                        _Keep1 &= ~_Traits::_Matches(_Val1, _Val2);
+                    }
+
+                    const unsigned long _Keep2 = _Active2 & ~_Traits::_Matches(_Val2, _Val1);
+                    const size_t _Kept1        = __popcnt(_Keep1);
+                    const size_t _Kept2        = __popcnt(_Keep2);
+
+                    __m256i _Low  = _Traits::_Fill_max(_Traits::_Compress(_Val1, _Keep1), _Kept1);
+                    __m256i _High = _Traits::_Fill_max(_Traits::_Compress(_Val2, _Keep2), _Kept2);
+                    _Traits::_Merge_sorted(_Low, _High);
+
+                    const size_t _Count = _Kept1 + _Kept2;
+                    if (_Count > _Lanes) {
+                        _Traits::_Store(_Dest, _Low);
+                        _Traits::_Store_n(_Dest + _Lanes, _High, _Count - _Lanes);
+                    } else {
+                        _Traits::_Store_n(_Dest, _Low, _Count);
+                    }
+
+                    _Dest += _Count;
+                }
+
+                _First1 += _Count1;
+                _First2 += _Count2;
+            }
+
+            return _Dest;
+        }
+
+        template <class _Traits, class _Ty>
+        _Ty* _Merge_avx2(const _Ty*& _First1, const _Ty* const _Last1, const _Ty*& _First2, const _Ty* const _Last2,
+            _Ty* _Dest) noexcept {
+            constexpr size_t _Lanes = _Traits::_Lanes;
+
+            if (static_cast<size_t>(_Last1 - _First1) < _Lanes || static_cast<size_t>(_Last2 - _First2) < _Lanes) {
+                return _Dest;
+            }
+
+            _Zeroupper_on_exit _Guard; // TRANSITION, DevCom-10331414
+
+            __m256i _Low  = _Traits::_Load(_First1);
+            __m256i _High = _Traits::_Load(_First2);
+            _First1 += _Lanes;
+            _First2 += _Lanes;
+
+            for (;;) {
+                _Traits::_Merge_sorted(_Low, _High);
+                _Traits::_Store(_Dest, _Low);
+                _Dest += _Lanes;
+
+                // The next vector comes from the range with the smaller head, so that _Low is never greater
+                // than anything left behind
+                const _Ty** _Next;
+                const _Ty* _Next_last;
+                if (_First1 == _Last1) {
+                    _Next      = &_First2;
+                    _Next_last = _Last2;
+                } else if (_First2 == _Last2 || !(*_First2 < *_First1)) {
+                    _Next      = &_First1;
+                    _Next_last = _Last1;
+                } else {
+                    _Next      = &_First2;
+                    _Next_last = _Last2;
+                }
+
+                if (static_cast<size_t>(_Next_last - *_Next) < _Lanes) {
+                    break;
+                }
+
+                _Low = _Traits::_Load(*_Next);
+                *_Next += _Lanes;
+            }
+
+            // Merge what's left of _High, which is sorted, into the rest of the ranges
+            _Ty _Carry[_Lanes];
+            _Traits::_Store(_Carry, _High);
+
+            const _Ty* _Carry_first      = _Carry;
+            const _Ty* const _Carry_last = _Carry + _Lanes;
+            while (_Carry_first != _Carry_last) {
+                const _Ty** _Least = &_Carry_first;
+                if (_First1 != _Last1 && *_First1 < **_Least) {
+                    _Least = &_First1;
+                }
+
+                if (_First2 != _Last2 && *_First2 < **_Least) {
+                    _Least = &_First2;
+                }
+
+                *_Dest = **_Least;
+                ++_Dest;
+                ++*_Least;
+            }
+
+            return _Dest;
+        }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+
+        template <_Op_kind _Op, class _Ty>
+        void* _Set_op_disp(const void* const _First1_raw, const void* const _Last1_raw, const void* const _First2_raw,
+            const void* const _Last2_raw, void* const _Dest_raw) noexcept {
+            const _Ty* _First1      = static_cast<const _Ty*>(_First1_raw);
+            const _Ty* const _Last1 = static_cast<const _Ty*>(_Last1_raw);
+            const _Ty* _First2      = static_cast<const _Ty*>(_First2_raw);
+            const _Ty* const _Last2 = static_cast<const _Ty*>(_Last2_raw);
+            _Ty* _Dest              = static_cast<_Ty*>(_Dest_raw);
+
+            const size_t _Count1 = static_cast<size_t>(_Last1 - _First1);
+            const size_t _Count2 = static_cast<size_t>(_Last2 - _First2);
+
+            if (_Count1 != 0 && _Count2 != 0) {
+                if (_Count2 / _Skew_ratio >= _Count1) {
+                    return _Lookup<_Op, true>(_First1, _Last1, _First2, _Last2, _Dest);
+                } else if (_Count1 / _Skew_ratio >= _Count2) {
+                    return _Lookup<_Op, false>(_First2, _Last2, _First1, _Last1, _Dest);
+                }
+            }
+
+#ifndef _M_ARM64EC
+            if (_Use_avx2()) {
+                using _Traits = std::conditional_t<sizeof(_Ty) == 4, _Avx2_4<std::is_signed_v<_Ty>>,
+                    _Avx2_8<std::is_signed_v<_Ty>>>;
+
+                if constexpr (_Op == _Op_kind::_Merge) {
+                    _Dest = _Merge_avx2<_Traits>(_First1, _Last1, _First2, _Last2, _Dest);
+                } else {
+                    _Dest = _Set_op_avx2<_Traits, _Op>(_First1, _Last1, _First2, _Last2, _Dest);
+                }
+            }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+
+            return _Scalar<_Op>(_First1, _Last1, _First2, _Last2, _Dest);
+        }
+    } // namespace _Set_operations
+} // unnamed namespace
+
+extern "C" {
+
+void* __stdcall __std_set_intersection_4i(const void* const _First1, const void* const _Last1,
+    const void* const _First2, const void* const _Last2, void* const _Dest) noexcept {
+    return _Set_operations::_Set_op_disp<_Set_operations::_Op_kind::_Intersection, int32_t>(
+        _First1, _Last1, _First2, _Last2, _Dest);
+}
+
+void* __stdcall __std_set_intersection_4u(const void* const _First1, const void* const _Last1,
+    const void* const _First2, const void* const _Last2, void* const _Dest) noexcept {
+    return _Set_operations::_Set_op_disp<_Set_operations::_Op_kind::_Intersection, uint32_t>(
+        _First1, _Last1, _First2, _Last2, _Dest);
+}
+
+void* __stdcall __std_set_intersection_8i(const void* const _First1, const void* const _Last1,
+    const void* const _First2, const void* const _Last2, void* const _Dest) noexcept {
+    return _Set_operations::_Set_op_disp<_Set_operations::_Op_kind::_Intersection, int64_t>(
+        _First1, _Last1, _First2, _Last2, _Dest);
+}
+
+void* __stdcall __std_set_intersection_8u(const void* const _First1, const void* const _Last1,
+    const void* const _First2, const void* const _Last2, void* const _Dest) noexcept {
+    return _Set_operations::_Set_op_disp<_Set_operations::_Op_kind::_Intersection, uint64_t>(
+        _First1, _Last1, _First2, _Last2, _Dest);
+}
+
+void* __stdcall __std_set_difference_4i(const void* const _First1, const void* const _Last1,
+    const void* const _First2, const void* const _Last2, void* const _Dest) noexcept {
+    return _Set_operations::_Set_op_disp<_Set_operations::_Op_kind::_Difference, int32_t>(
+        _First1, _Last1, _First2, _Last2, _Dest);
+}
+
+void* __stdcall __std_set_difference_4u(const void* const _First1, const void* const _Last1,
+    const void* const _First2, const void* const _Last2, void* const _Dest) noexcept {
+    return _Set_operations::_Set_op_disp<_Set_operations::_Op_kind::_Difference, uint32_t>(
+        _First1, _Last1, _First2, _Last2, _Dest);
+}
+
+void* __stdcall __std_set_difference_8i(const void* const _First1, const void* const _Last1,
+    const void* const _First2, const void* const _Last2, void* const _Dest) noexcept {
+    return _Set_operations::_Set_op_disp<_Set_operations::_Op_kind::_Difference, int64_t>(
+        _First1, _Last1, _First2, _Last2, _Dest);
+}
+
+void* __stdcall __std_set_difference_8u(const void* const _First1, const void* const _Last1,
+    const void* const _First2, const void* const _Last2, void* const _Dest) noexcept {
+    return _Set_operations::_Set_op_disp<_Set_operations::_Op_kind::_Difference, uint64_t>(
+        _First1, _Last1, _First2, _Last2, _Dest);
+}
+
+void* __stdcall __std_set_union_4i(const void* const _First1, const void* const _Last1,
+    const void* const _First2, const void* const _Last2, void* const _Dest) noexcept {
+    return _Set_operations::_Set_op_disp<_Set_operations::_Op_kind::_Union, int32_t>(
+        _First1, _Last1, _First2, _Last2, _Dest);
+}
+
+void* __stdcall __std_set_union_4u(const void* const _First1, const void* const _Last1,
+    const void* const _First2, const void* const _Last2, void* const _Dest) noexcept {
+    return _Set_operations::_Set_op_disp<_Set_operations::_Op_kind::_Union, uint32_t>(
+        _First1, _Last1, _First2, _Last2, _Dest);
+}
+
+void* __stdcall __std_set_union_8i(const void* const _First1, const void* const _Last1,
+    const void* const _First2, const void* const _Last2, void* const _Dest) noexcept {
+    return _Set_operations::_Set_op_disp<_Set_operations::_Op_kind::_Union, int64_t>(
+        _First1, _Last1, _First2, _Last2, _Dest);
+}
+
+void* __stdcall __std_set_union_8u(const void* const _First1, const void* const _Last1,
+    const void* const _First2, const void* const _Last2, void* const _Dest) noexcept {
+    return _Set_operations::_Set_op_disp<_Set_operations::_Op_kind::_Union, uint64_t>(
+        _First1, _Last1, _First2, _Last2, _Dest);
+}
+
+void* __stdcall __std_set_symmetric_difference_4i(const void* const _First1, const void* const _Last1,
+    const void* const _First2, const void* const _Last2, void* const _Dest) noexcept {
+    return _Set_operations::_Set_op_disp<_Set_operations::_Op_kind::_Symmetric_difference, int32_t>(
+        _First1, _Last1, _First2, _Last2, _Dest);
+}
+
+void* __stdcall __std_set_symmetric_difference_4u(const void* const _First1, const void* const _Last1,
+    const void* const _First2, const void* const _Last2, void* const _Dest) noexcept {
+    return _Set_operations::_Set_op_disp<_Set_operations::_Op_kind::_Symmetric_difference, uint32_t>(
+        _First1, _Last1, _First2, _Last2, _Dest);
+}
+
+void* __stdcall __std_set_symmetric_difference_8i(const void* const _First1, const void* const _Last1,
+    const void* const _First2, const void* const _Last2, void* const _Dest) noexcept {
+    return _Set_operations::_Set_op_disp<_Set_operations::_Op_kind::_Symmetric_difference, int64_t>(
+        _First1, _Last1, _First2, _Last2, _Dest);
+}
+
+void* __stdcall __std_set_symmetric_difference_8u(const void* const _First1, const void* const _Last1,
+    const void* const _First2, const void* const _Last2, void* const _Dest) noexcept {
+    return _Set_operations::_Set_op_disp<_Set_operations::_Op_kind::_Symmetric_difference, uint64_t>(
+        _First1, _Last1, _First2, _Last2, _Dest);
+}
+
+void* __stdcall __std_merge_4i(const void* const _First1, const void* const _Last1,
+    const void* const _First2, const void* const _Last2, void* const _Dest) noexcept {
+    return _Set_operations::_Set_op_disp<_Set_operations::_Op_kind::_Merge, int32_t>(
+        _First1, _Last1, _First2, _Last2, _Dest);
+}
+
+void* __stdcall __std_merge_4u(const void* const _First1, const void* const _Last1,
+    const void* const _First2, const void* const _Last2, void* const _Dest) noexcept {
+    return _Set_operations::_Set_op_disp<_Set_operations::_Op_kind::_Merge, uint32_t>(
+        _First1, _Last1, _First2, _Last2, _Dest);
+}
+
+void* __stdcall __std_merge_8i(const void* const _First1, const void* const _Last1,
+    const void* const _First2, const void* const _Last2, void* const _Dest) noexcept {
+    return _Set_operations::_Set_op_disp<_Set_operations::_Op_kind::_Merge, int64_t>(
+        _First1, _Last1, _First2, _Last2, _Dest);
+}
+
+void* __stdcall __std_merge_8u(const void* const _First1, const void* const _Last1,
+    const void* const _First2, const void* const _Last2, void* const _Dest) noexcept {
+    return _Set_operations::_Set_op_disp<_Set_operations::_Op_kind::_Merge, uint64_t>(
+        _First1, _Last1, _First2, _Last2, _Dest);
+}
+
+} // extern "C"
+#endif // ^^^ !defined(_M_ARM64) ^^^
+
+#ifndef _M_ARM64
+namespace {
+    namespace _Reducing {
+        // reduce() and transform_reduce() permit reassociation, so these kernels keep several independent
+        // accumulators to hide the latency of vector additions. Integers are summed in unsigned types, where the
+        // wraparound result is the same no matter the order. Floating-point accumulators start at -0.0, which is
+        // the additive identity (+0.0 isn't: +0.0 + -0.0 == +0.0).
+
+        template <class _Ty>
+        _Ty _Scalar(const _Ty* _First, const _Ty* const _Last) noexcept {
+            _Ty _Val = static_cast<_Ty>(-0.0);
+            for (; _First != _Last; ++_First) {
+                _Val += *_First;
+            }
+
+            return _Val;
+        }
+
+        template <class _Ty>
+        _Ty _Scalar_dot(const _Ty* _First1, const _Ty* const _Last1, const _Ty* _First2) noexcept {
+            _Ty _Val = static_cast<_Ty>(-0.0);
+            for (; _First1 != _Last1; ++_First1, ++_First2) {
+                _Val += static_cast<_Ty>(*_First1 * *_First2);
+            }
+
+            return _Val;
+        }
+
+#ifndef _M_ARM64EC
+        template <class _Ty, class _Vec>
+        _Ty _Horizontal_sum(const _Vec _Acc) noexcept {
+            _Ty _Lanes[sizeof(_Vec) / sizeof(_Ty)];
+            memcpy(_Lanes, &_Acc, sizeof(_Vec));
+            return _Scalar(_Lanes, _Lanes + sizeof(_Vec) / sizeof(_Ty));
+        }
+
+        struct _Traits_sse {
+            using _Vec_t = __m128i;
+
+            static __m128i _Load(const void* const _Src) noexcept {
+                return _mm_loadu_si128(static_cast<const __m128i*>(_Src));
+            }
+
+            template <class _Ty>
+            static __m128i _Identity() noexcept {
+                if constexpr (std::is_same_v<_Ty, float>) {
+                    return _mm_castps_si128(_mm_set1_ps(-0.0f));
+                } else if constexpr (std::is_same_v<_Ty, double>) {
+                    return _mm_castpd_si128(_mm_set1_pd(-0.0));
+                } else {
+                    return _mm_setzero_si128();
+                }
+            }
+
+            template <class _Ty>
+            static __m128i _Add(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+                if constexpr (std::is_same_v<_Ty, float>) {
+                    return _mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(_Lhs), _mm_castsi128_ps(_Rhs)));
+                } else if constexpr (std::is_same_v<_Ty, double>) {
+                    return _mm_castpd_si128(_mm_add_pd(_mm_castsi128_pd(_Lhs), _mm_castsi128_pd(_Rhs)));
+                } else if constexpr (sizeof(_Ty) == 1) {
+                    return _mm_add_epi8(_Lhs, _Rhs);
+                } else if constexpr (sizeof(_Ty) == 2) {
+                    return _mm_add_epi16(_Lhs, _Rhs);
+                } else if constexpr (sizeof(_Ty) == 4) {
+                    return _mm_add_epi32(_Lhs, _Rhs);
+                } else {
+                    return _mm_add_epi64(_Lhs, _Rhs);
+                }
+            }
+
+            template <class _Ty>
+            static __m128i _Mul(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+                if constexpr (std::is_same_v<_Ty, float>) {
+                    return _mm_castps_si128(_mm_mul_ps(_mm_castsi128_ps(_Lhs), _mm_castsi128_ps(_Rhs)));
+                } else if constexpr (std::is_same_v<_Ty, double>) {
+                    return _mm_castpd_si128(_mm_mul_pd(_mm_castsi128_pd(_Lhs), _mm_castsi128_pd(_Rhs)));
+                } else if constexpr (sizeof(_Ty) == 4) {
+                    return _mm_mullo_epi32(_Lhs, _Rhs);
+                } else {
+                    // low 64 bits of the product: lo * lo + ((hi * lo + lo * hi) << 32)
+                    const __m128i _Cross = _mm_add_epi64(_mm_mul_epu32(_mm_srli_epi64(_Lhs, 32), _Rhs),
+                        _mm_mul_epu32(_Lhs, _mm_srli_epi64(_Rhs, 32)));
+                    return _mm_add_epi64(_mm_mul_epu32(_Lhs, _Rhs), _mm_slli_epi64(_Cross, 32));
+                }
+            }
+        };
+
+        struct _Traits_avx {
+            using _Vec_t = __m256i;
+
+            static __m256i _Load(const void* const _Src) noexcept {
+                return _mm256_loadu_si256(static_cast<const __m256i*>(_Src));
+            }
+
+            template <class _Ty>
+            static __m256i _Identity() noexcept {
+                if constexpr (std::is_same_v<_Ty, float>) {
+                    return _mm256_castps_si256(_mm256_set1_ps(-0.0f));
+                } else if constexpr (std::is_same_v<_Ty, double>) {
+                    return _mm256_castpd_si256(_mm256_set1_pd(-0.0));
+                } else {
+                    return _mm256_setzero_si256();
+                }
+            }
+
+            template <class _Ty>
+            static __m256i _Add(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+                if constexpr (std::is_same_v<_Ty, float>) {
+                    return _mm256_castps_si256(_mm256_add_ps(_mm256_castsi256_ps(_Lhs), _mm256_castsi256_ps(_Rhs)));
+                } else if constexpr (std::is_same_v<_Ty, double>) {
+                    return _mm256_castpd_si256(_mm256_add_pd(_mm256_castsi256_pd(_Lhs), _mm256_castsi256_pd(_Rhs)));
+                } else if constexpr (sizeof(_Ty) == 1) {
+                    return _mm256_add_epi8(_Lhs, _Rhs);
+                } else if constexpr (sizeof(_Ty) == 2) {
+                    return _mm256_add_epi16(_Lhs, _Rhs);
+                } else if constexpr (sizeof(_Ty) == 4) {
+                    return _mm256_add_epi32(_Lhs, _Rhs);
+                } else {
+                    return _mm256_add_epi64(_Lhs, _Rhs);
+                }
+            }
+
+            template <class _Ty>
+            static __m256i _Mul(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+                if constexpr (std::is_same_v<_Ty, float>) {
+                    return _mm256_castps_si256(_mm256_mul_ps(_mm256_castsi256_ps(_Lhs), _mm256_castsi256_ps(_Rhs)));
+                } else if constexpr (std::is_same_v<_Ty, double>) {
+                    return _mm256_castpd_si256(_mm256_mul_pd(_mm256_castsi256_pd(_Lhs), _mm256_castsi256_pd(_Rhs)));
+                } else if constexpr (sizeof(_Ty) == 4) {
+                    return _mm256_mullo_epi32(_Lhs, _Rhs);
+                } else {
+                    // low 64 bits of the product: lo * lo + ((hi * lo + lo * hi) << 32)
+                    const __m256i _Cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(_Lhs, 32), _Rhs),
+                        _mm256_mul_epu32(_Lhs, _mm256_srli_epi64(_Rhs, 32)));
+                    return _mm256_add_epi64(_mm256_mul_epu32(_Lhs, _Rhs), _mm256_slli_epi64(_Cross, 32));
+                }
+            }
+        };
+
+#ifdef _WIN64
+        struct _Traits_avx512 {
+            using _Vec_t = __m512i;
+
+            static __m512i _Load(const void* const _Src) noexcept {
+                return _mm512_loadu_si512(_Src);
+            }
+
+            template <class _Ty>
+            static __m512i _Identity() noexcept {
+                if constexpr (std::is_same_v<_Ty, float>) {
+                    return _mm512_castps_si512(_mm512_set1_ps(-0.0f));
+                } else if constexpr (std::is_same_v<_Ty, double>) {
+                    return _mm512_castpd_si512(_mm512_set1_pd(-0.0));
+                } else {
+                    return _mm512_setzero_si512();
+                }
+            }
+
+            template <class _Ty>
+            static __m512i _Add(const __m512i _Lhs, const __m512i _Rhs) noexcept {
+                if constexpr (std::is_same_v<_Ty, float>) {
+                    return _mm512_castps_si512(_mm512_add_ps(_mm512_castsi512_ps(_Lhs), _mm512_castsi512_ps(_Rhs)));
+                } else if constexpr (std::is_same_v<_Ty, double>) {
+                    return _mm512_castpd_si512(_mm512_add_pd(_mm512_castsi512_pd(_Lhs), _mm512_castsi512_pd(_Rhs)));
+                } else if constexpr (sizeof(_Ty) == 1) {
+                    return _mm512_add_epi8(_Lhs, _Rhs);
+                } else if constexpr (sizeof(_Ty) == 2) {
+                    return _mm512_add_epi16(_Lhs, _Rhs);
+                } else if constexpr (sizeof(_Ty) == 4) {
+                    return _mm512_add_epi32(_Lhs, _Rhs);
+                } else {
+                    return _mm512_add_epi64(_Lhs, _Rhs);
+                }
+            }
+
+            template <class _Ty>
+            static __m512i _Mul(const __m512i _Lhs, const __m512i _Rhs) noexcept {
+                if constexpr (std::is_same_v<_Ty, float>) {
+                    return _mm512_castps_si512(_mm512_mul_ps(_mm512_castsi512_ps(_Lhs), _mm512_castsi512_ps(_Rhs)));
+                } else if constexpr (std::is_same_v<_Ty, double>) {
+                    return _mm512_castpd_si512(_mm512_mul_pd(_mm512_castsi512_pd(_Lhs), _mm512_castsi512_pd(_Rhs)));
+                } else if constexpr (sizeof(_Ty) == 4) {
+                    return _mm512_mullo_epi32(_Lhs, _Rhs);
+                } else {
+                    return _mm512_mullo_epi64(_Lhs, _Rhs);
+                }
+            }
+        };
+#endif // ^^^ defined(_WIN64) ^^^
+
+        // Sums [_First, _Last), or the products of [_First, _Last) and [_First2, ...) when _Dot is true.
+        // Four accumulators are fed in a round-robin fashion; the remaining whole vectors go to the first one,
+        // and the elements that don't fill a vector are summed by the scalar tail.
+        template <class _Traits, bool _Dot, class _Ty>
+        _Ty _Reduce_impl(const void* _First, const void* const _Last, const void* _First2) noexcept {
+            using _Vec_t                = typename _Traits::_Vec_t;
+            constexpr size_t _Vec_bytes = sizeof(_Vec_t);
+
+            const auto _Next = [&_First, &_First2](const size_t _Offset) noexcept {
+                const void* _Src = _First;
+                _Advance_bytes(_Src, _Offset);
+                _Vec_t _Data = _Traits::_Load(_Src);
+                if constexpr (_Dot) {
+                    const void* _Src2 = _First2;
+                    _Advance_bytes(_Src2, _Offset);
+                    _Data = _Traits::template _Mul<_Ty>(_Data, _Traits::_Load(_Src2));
+                }
+
+                return _Data;
+            };
+
+            const size_t _Size_bytes = _Byte_length(_First, _Last);
+
+            _Vec_t _Acc0 = _Traits::template _Identity<_Ty>();
+            _Vec_t _Acc1 = _Acc0;
+            _Vec_t _Acc2 = _Acc0;
+            _Vec_t _Acc3 = _Acc0;
+
+            const void* _Stop_at = _First;
+            _Advance_bytes(_Stop_at, _Size_bytes & ~(4 * _Vec_bytes - 1));
+            while (_First != _Stop_at) {
+                _Acc0 = _Traits::template _Add<_Ty>(_Acc0, _Next(0));
+                _Acc1 = _Traits::template _Add<_Ty>(_Acc1, _Next(_Vec_bytes));
+                _Acc2 = _Traits::template _Add<_Ty>(_Acc2, _Next(2 * _Vec_bytes));
+                _Acc3 = _Traits::template _Add<_Ty>(_Acc3, _Next(3 * _Vec_bytes));
+                _Advance_bytes(_First, 4 * _Vec_bytes);
+                if constexpr (_Dot) {
+                    _Advance_bytes(_First2, 4 * _Vec_bytes);
+                }
+            }
+
+            _Advance_bytes(_Stop_at, _Size_bytes & (3 * _Vec_bytes));
+            while (_First != _Stop_at) {
+                _Acc0 = _Traits::template _Add<_Ty>(_Acc0, _Next(0));
+                _Advance_bytes(_First, _Vec_bytes);
+                if constexpr (_Dot) {
+                    _Advance_bytes(_First2, _Vec_bytes);
+                }
+            }
+
+            _Acc0 = _Traits::template _Add<_Ty>(
+                _Traits::template _Add<_Ty>(_Acc0, _Acc1), _Traits::template _Add<_Ty>(_Acc2, _Acc3));
+
+            _Ty _Tail;
+            if constexpr (_Dot) {
+                _Tail = _Scalar_dot(static_cast<const _Ty*>(_First), static_cast<const _Ty*>(_Last),
+                    static_cast<const _Ty*>(_First2));
+            } else {
+                _Tail = _Scalar(static_cast<const _Ty*>(_First), static_cast<const _Ty*>(_Last));
+            }
+
+            return static_cast<_Ty>(_Horizontal_sum<_Ty>(_Acc0) + _Tail);
+        }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+
+        template <bool _Dot, class _Ty>
+        _Ty _Reduce_disp(const void* const _First, const void* const _Last, const void* const _First2) noexcept {
+#ifndef _M_ARM64EC
+            const size_t _Size_bytes = _Byte_length(_First, _Last);
+#ifdef _WIN64
+            if (_Size_bytes >= 64 && _Use_avx512()) {
+                _Zeroupper_on_exit _Guard; // TRANSITION, DevCom-10331414
+                return _Reduce_impl<_Traits_avx512, _Dot, _Ty>(_First, _Last, _First2);
+            }
+#endif // ^^^ defined(_WIN64) ^^^
+
+            if (_Size_bytes >= 32 && _Use_avx2()) {
+                _Zeroupper_on_exit _Guard; // TRANSITION, DevCom-10331414
+                return _Reduce_impl<_Traits_avx, _Dot, _Ty>(_First, _Last, _First2);
+            }
+
+            if (_Size_bytes >= 16 && _Use_sse42()) {
+                return _Reduce_impl<_Traits_sse, _Dot, _Ty>(_First, _Last, _First2);
+            }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+
+            if constexpr (_Dot) {
+                return _Scalar_dot(static_cast<const _Ty*>(_First), static_cast<const _Ty*>(_Last),
+                    static_cast<const _Ty*>(_First2));
+            } else {
+                (void) _First2;
+                return _Scalar(static_cast<const _Ty*>(_First), static_cast<const _Ty*>(_Last));
+            }
+        }
+    } // namespace _Reducing
+} // unnamed namespace
+
+extern "C" {
+
+__declspec(noalias) uint8_t __stdcall __std_reduce_plus_1(const void* const _First, const void* const _Last) noexcept {
+    return _Reducing::_Reduce_disp<false, uint8_t>(_First, _Last, nullptr);
+}
+
+__declspec(noalias) uint16_t __stdcall __std_reduce_plus_2(const void* const _First, const void* const _Last) noexcept {
+    return _Reducing::_Reduce_disp<false, uint16_t>(_First, _Last, nullptr);
+}
+
+__declspec(noalias) uint32_t __stdcall __std_reduce_plus_4(const void* const _First, const void* const _Last) noexcept {
+    return _Reducing::_Reduce_disp<false, uint32_t>(_First, _Last, nullptr);
+}
+
+__declspec(noalias) uint64_t __stdcall __std_reduce_plus_8(const void* const _First, const void* const _Last) noexcept {
+    return _Reducing::_Reduce_disp<false, uint64_t>(_First, _Last, nullptr);
+}
+
+__declspec(noalias) float __stdcall __std_reduce_plus_f(const void* const _First, const void* const _Last) noexcept {
+    return _Reducing::_Reduce_disp<false, float>(_First, _Last, nullptr);
+}
+
+__declspec(noalias) double __stdcall __std_reduce_plus_d(const void* const _First, const void* const _Last) noexcept {
+    return _Reducing::_Reduce_disp<false, double>(_First, _Last, nullptr);
+}
+
+__declspec(noalias) uint32_t __stdcall __std_transform_reduce_plus_multiplies_4(
+    const void* const _First1, const void* const _Last1, const void* const _First2) noexcept {
+    return _Reducing::_Reduce_disp<true, uint32_t>(_First1, _Last1, _First2);
+}
+
+__declspec(noalias) uint64_t __stdcall __std_transform_reduce_plus_multiplies_8(
+    const void* const _First1, const void* const _Last1, const void* const _First2) noexcept {
+    return _Reducing::_Reduce_disp<true, uint64_t>(_First1, _Last1, _First2);
+}
+
+__declspec(noalias) float __stdcall __std_transform_reduce_plus_multiplies_f(
+    const void* const _First1, const void* const _Last1, const void* const _First2) noexcept {
+    return _Reducing::_Reduce_disp<true, float>(_First1, _Last1, _First2);
+}
+
+__declspec(noalias) double __stdcall __std_transform_reduce_plus_multiplies_d(
+    const void* const _First1, const void* const _Last1, const void* const _First2) noexcept {
+    return _Reducing::_Reduce_disp<true, double>(_First1, _Last1, _First2);
+}
+
+} // extern "C"
+#endif // ^^^ !defined(_M_ARM64) ^^^
+
+#ifndef _M_ARM64
+namespace {
+    namespace _Scanning {
+        // The inclusive and exclusive scans compute the prefix sums of a vector in log2(lanes) shift-and-add steps,
+        // add the running total (carried broadcast in every lane), and broadcast the last lane as the next carry.
+        // Shifts insert the additive identity (-0.0 for floating-point types), so that -0.0 elements and initial
+        // values produce -0.0 like the sequential algorithms do.
+        // Every vector is loaded before the corresponding output is stored, and the carries are kept in registers,
+        // so the output may be the input itself, or may start before it.
+
+        template <class _Ty>
+        _Ty _Inclusive_scalar(const _Ty* _First, const _Ty* const _Last, _Ty* _Dest, _Ty _Val) noexcept {
+            for (; _First != _Last; ++_First, ++_Dest) {
+                _Val += *_First;
+                *_Dest = _Val;
+            }
+
+            return _Val;
+        }
+
+        template <class _Ty>
+        _Ty _Exclusive_scalar(const _Ty* _First, const _Ty* const _Last, _Ty* _Dest, _Ty _Val) noexcept {
+            for (; _First != _Last; ++_First, ++_Dest) {
+                const _Ty _Tmp = static_cast<_Ty>(_Val + *_First);
+                *_Dest         = _Val;
+                _Val           = _Tmp;
+            }
+
+            return _Val;
+        }
+
+        template <class _Ty>
+        void _Adjacent_difference_scalar(const _Ty* _First, const _Ty* const _Last, _Ty* _Dest, _Ty _Prev) noexcept {
+            for (; _First != _Last; ++_First, ++_Dest) {
+                const _Ty _Tmp = *_First;
+                *_Dest         = static_cast<_Ty>(_Tmp - _Prev);
+                _Prev          = _Tmp;
+            }
+        }
+
+#ifndef _M_ARM64EC
+        template <class _Ty, class _Vec>
+        _Ty _Last_lane(const _Vec _Val) noexcept {
+            _Ty _Lanes[sizeof(_Vec) / sizeof(_Ty)];
+            memcpy(_Lanes, &_Val, sizeof(_Vec));
+            return _Lanes[sizeof(_Vec) / sizeof(_Ty) - 1];
+        }
+
+        struct _Traits_sse : _Reducing::_Traits_sse {
+            static void _Store(void* const _Dest, const __m128i _Val) noexcept {
+                _mm_storeu_si128(static_cast<__m128i*>(_Dest), _Val);
+            }
+
+            template <class _Ty>
+            static __m128i _Set(const _Ty _Val) noexcept {
+                if constexpr (std::is_same_v<_Ty, float>) {
+                    return _mm_castps_si128(_mm_set1_ps(_Val));
+                } else if constexpr (std::is_same_v<_Ty, double>) {
+                    return _mm_castpd_si128(_mm_set1_pd(_Val));
+                } else if constexpr (sizeof(_Ty) == 4) {
+                    return _mm_set1_epi32(static_cast<int>(_Val));
+                } else {
+                    return _mm_set1_epi64x(static_cast<long long>(_Val));
+                }
+            }
+
+            template <class _Ty>
+            static __m128i _Sub(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+                if constexpr (std::is_same_v<_Ty, float>) {
+                    return _mm_castps_si128(_mm_sub_ps(_mm_castsi128_ps(_Lhs), _mm_castsi128_ps(_Rhs)));
+                } else if constexpr (std::is_same_v<_Ty, double>) {
+                    return _mm_castpd_si128(_mm_sub_pd(_mm_castsi128_pd(_Lhs), _mm_castsi128_pd(_Rhs)));
+                } else if constexpr (sizeof(_Ty) == 4) {
+                    return _mm_sub_epi32(_Lhs, _Rhs);
+                } else {
+                    return _mm_sub_epi64(_Lhs, _Rhs);
+                }
+            }
+
+            template <class _Ty>
+            static __m128i _Prefix(__m128i _Val) noexcept {
+                const __m128i _Id = _Identity<_Ty>();
+                if constexpr (sizeof(_Ty) == 4) {
+                    _Val = _Add<_Ty>(_Val, _mm_alignr_epi8(_Val, _Id, 12));
+                }
+
+                return _Add<_Ty>(_Val, _mm_alignr_epi8(_Val, _Id, 8));
+            }
+
+            template <class _Ty>
+            static __m128i _Shift_one(const __m128i _Val) noexcept {
+                return _mm_alignr_epi8(_Val, _Identity<_Ty>(), 16 - sizeof(_Ty));
+            }
+
+            template <class _Ty>
+            static __m128i _Previous(const __m128i _Val, const __m128i _Prev_val) noexcept {
+                return _mm_alignr_epi8(_Val, _Prev_val, 16 - sizeof(_Ty));
+            }
+
+            template <class _Ty>
+            static __m128i _Broadcast_last(const __m128i _Val) noexcept {
+                if constexpr (sizeof(_Ty) == 4) {
+                    return _mm_shuffle_epi32(_Val, _MM_SHUFFLE(3, 3, 3, 3));
+                } else {
+                    return _mm_shuffle_epi32(_Val, _MM_SHUFFLE(3, 2, 3, 2));
+                }
+            }
+        };
+
+        struct _Traits_avx : _Reducing::_Traits_avx {
+            static void _Store(void* const _Dest, const __m256i _Val) noexcept {
+                _mm256_storeu_si256(static_cast<__m256i*>(_Dest), _Val);
+            }
+
+            template <class _Ty>
+            static __m256i _Set(const _Ty _Val) noexcept {
+                if constexpr (std::is_same_v<_Ty, float>) {
+                    return _mm256_castps_si256(_mm256_set1_ps(_Val));
+                } else if constexpr (std::is_same_v<_Ty, double>) {
+                    return _mm256_castpd_si256(_mm256_set1_pd(_Val));
+                } else if constexpr (sizeof(_Ty) == 4) {
+                    return _mm256_set1_epi32(static_cast<int>(_Val));
+                } else {
+                    return _mm256_set1_epi64x(static_cast<long long>(_Val));
+                }
+            }
+
+            template <class _Ty>
+            static __m256i _Sub(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+                if constexpr (std::is_same_v<_Ty, float>) {
+                    return _mm256_castps_si256(_mm256_sub_ps(_mm256_castsi256_ps(_Lhs), _mm256_castsi256_ps(_Rhs)));
+                } else if constexpr (std::is_same_v<_Ty, double>) {
+                    return _mm256_castpd_si256(_mm256_sub_pd(_mm256_castsi256_pd(_Lhs), _mm256_castsi256_pd(_Rhs)));
+                } else if constexpr (sizeof(_Ty) == 4) {
+                    return _mm256_sub_epi32(_Lhs, _Rhs);
+                } else {
+                    return _mm256_sub_epi64(_Lhs, _Rhs);
+                }
+            }
+
+            template <class _Ty>
+            static __m256i _Prefix(__m256i _Val) noexcept {
+                // prefix sums within each 128-bit lane, then the low lane's total is added to the high lane
+                const __m256i _Id = _Identity<_Ty>();
+                if constexpr (sizeof(_Ty) == 4) {
+                    _Val = _Add<_Ty>(_Val, _mm256_alignr_epi8(_Val, _Id, 12));
+                }
+
+                _Val = _Add<_Ty>(_Val, _mm256_alignr_epi8(_Val, _Id, 8));
+
+                const __m256i _Low_total = _mm256_permute2x128_si256(_Val, _Id, 0x02);
+                if constexpr (sizeof(_Ty) == 4) {
+                    return _Add<_Ty>(_Val, _mm256_shuffle_epi32(_Low_total, _MM_SHUFFLE(3, 3, 3, 3)));
+                } else {
+                    return _Add<_Ty>(_Val, _mm256_shuffle_epi32(_Low_total, _MM_SHUFFLE(3, 2, 3, 2)));
+                }
+            }
+
+            template <class _Ty>
+            static __m256i _Shift_one(const __m256i _Val) noexcept {
+                const __m256i _Id = _Identity<_Ty>();
+                return _mm256_alignr_epi8(_Val, _mm256_permute2x128_si256(_Val, _Id, 0x02), 16 - sizeof(_Ty));
+            }
+
+            template <class _Ty>
+            static __m256i _Previous(const __m256i _Val, const __m256i _Prev_val) noexcept {
+                return _mm256_alignr_epi8(_Val, _mm256_permute2x128_si256(_Prev_val, _Val, 0x21), 16 - sizeof(_Ty));
+            }
+
+            template <class _Ty>
+            static __m256i _Broadcast_last(const __m256i _Val) noexcept {
+                if constexpr (sizeof(_Ty) == 4) {
+                    return _mm256_permutevar8x32_epi32(_Val, _mm256_set1_epi32(7));
+                } else {
+                    return _mm256_permute4x64_epi64(_Val, _MM_SHUFFLE(3, 3, 3, 3));
+                }
+            }
+        };
+
+        template <class _Traits, bool _Inclusive, class _Ty>
+        _Ty _Scan_impl(const _Ty*& _First, const _Ty* const _Stop_at, _Ty*& _Dest, const _Ty _Init) noexcept {
+            constexpr size_t _Lanes = sizeof(typename _Traits::_Vec_t) / sizeof(_Ty);
+
+            auto _Carry = _Traits::template _Set<_Ty>(_Init);
+            for (; _First != _Stop_at; _First += _Lanes, _Dest += _Lanes) {
+                const auto _Data = _Traits::_Load(_First);
+                if constexpr (_Inclusive) {
+                    const auto _Result = _Traits::template _Add<_Ty>(_Carry, _Traits::template _Prefix<_Ty>(_Data));
+                    _Traits::_Store(_Dest, _Result);
+                    _Carry = _Traits::template _Broadcast_last<_Ty>(_Result);
+                } else {
+                    const auto _Result = _Traits::template _Add<_Ty>(
+                        _Carry, _Traits::template _Prefix<_Ty>(_Traits::template _Shift_one<_Ty>(_Data)));
+                    _Traits::_Store(_Dest, _Result);
+                    _Carry = _Traits::template _Broadcast_last<_Ty>(_Traits::template _Add<_Ty>(_Result, _Data));
+                }
+            }
+
+            return _Last_lane<_Ty>(_Carry);
+        }
+
+        template <class _Traits, class _Ty>
+        _Ty _Adjacent_difference_impl(
+            const _Ty*& _First, const _Ty* const _Stop_at, _Ty*& _Dest, const _Ty _Prev) noexcept {
+            constexpr size_t _Lanes = sizeof(typename _Traits::_Vec_t) / sizeof(_Ty);
+
+            auto _Prev_data = _Traits::template _Set<_Ty>(_Prev);
+            for (; _First != _Stop_at; _First += _Lanes, _Dest += _Lanes) {
+                const auto _Data = _Traits::_Load(_First);
+                _Traits::_Store(_Dest,
+                    _Traits::template _Sub<_Ty>(_Data, _Traits::template _Previous<_Ty>(_Data, _Prev_data)));
+                _Prev_data = _Data;
+            }
+
+            return _Last_lane<_Ty>(_Prev_data);
+        }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+
+        template <bool _Inclusive, class _Ty>
+        _Ty _Scan_disp(const void* const _First_raw, const void* const _Last_raw, void* const _Dest_raw,
+            _Ty _Val) noexcept {
+            auto _First      = static_cast<const _Ty*>(_First_raw);
+            const auto _Last = static_cast<const _Ty*>(_Last_raw);
+            auto _Dest       = static_cast<_Ty*>(_Dest_raw);
+#ifndef _M_ARM64EC
+            const size_t _Size_bytes = _Byte_length(_First, _Last);
+            if (const size_t _Avx_size = _Size_bytes & ~size_t{0x1F}; _Avx_size != 0 && _Use_avx2()) {
+                _Zeroupper_on_exit _Guard; // TRANSITION, DevCom-10331414
+
+                const void* _Stop_at = _First;
+                _Advance_bytes(_Stop_at, _Avx_size);
+                _Val = _Scan_impl<_Traits_avx, _Inclusive>(_First, static_cast<const _Ty*>(_Stop_at), _Dest, _Val);
+            } else if (const size_t _Sse_size = _Size_bytes & ~size_t{0xF}; _Sse_size != 0 && _Use_sse42()) {
+                const void* _Stop_at = _First;
+                _Advance_bytes(_Stop_at, _Sse_size);
+                _Val = _Scan_impl<_Traits_sse, _Inclusive>(_First, static_cast<const _Ty*>(_Stop_at), _Dest, _Val);
+            }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+
+            if constexpr (_Inclusive) {
+                return _Inclusive_scalar(_First, _Last, _Dest, _Val);
+            } else {
+                return _Exclusive_scalar(_First, _Last, _Dest, _Val);
+            }
+        }
+
+        template <class _Ty>
+        void _Adjacent_difference_disp(
+            const void* const _First_raw, const void* const _Last_raw, void* const _Dest_raw) noexcept {
+            auto _First      = static_cast<const _Ty*>(_First_raw);
+            const auto _Last = static_cast<const _Ty*>(_Last_raw);
+            auto _Dest       = static_cast<_Ty*>(_Dest_raw);
+            if (_First == _Last) {
+                return;
+            }
+
+            _Ty _Prev = *_First;
+            *_Dest    = _Prev;
+            ++_First;
+            ++_Dest;
+#ifndef _M_ARM64EC
+            const size_t _Size_bytes = _Byte_length(_First, _Last);
+            if (const size_t _Avx_size = _Size_bytes & ~size_t{0x1F}; _Avx_size != 0 && _Use_avx2()) {
+                _Zeroupper_on_exit _Guard; // TRANSITION, DevCom-10331414
+
+                const void* _Stop_at = _First;
+                _Advance_bytes(_Stop_at, _Avx_size);
+                _Prev = _Adjacent_difference_impl<_Traits_avx>(_First, static_cast<const _Ty*>(_Stop_at), _Dest, _Prev);
+            } else if (const size_t _Sse_size = _Size_bytes & ~size_t{0xF}; _Sse_size != 0 && _Use_sse42()) {
+                const void* _Stop_at = _First;
+                _Advance_bytes(_Stop_at, _Sse_size);
+                _Prev = _Adjacent_difference_impl<_Traits_sse>(_First, static_cast<const _Ty*>(_Stop_at), _Dest, _Prev);
+            }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+
+            _Adjacent_difference_scalar(_First, _Last, _Dest, _Prev);
+        }
+    } // namespace _Scanning
+} // unnamed namespace
+
+extern "C" {
+
+__declspec(noalias) uint32_t __stdcall __std_inclusive_scan_plus_4(
+    const void* const _First, const void* const _Last, void* const _Dest, const uint32_t _Init) noexcept {
+    return _Scanning::_Scan_disp<true>(_First, _Last, _Dest, _Init);
+}
+
+__declspec(noalias) uint64_t __stdcall __std_inclusive_scan_plus_8(
+    const void* const _First, const void* const _Last, void* const _Dest, const uint64_t _Init) noexcept {
+    return _Scanning::_Scan_disp<true>(_First, _Last, _Dest, _Init);
+}
+
+__declspec(noalias) float __stdcall __std_inclusive_scan_plus_f(
+    const void* const _First, const void* const _Last, void* const _Dest, const float _Init) noexcept {
+    return _Scanning::_Scan_disp<true>(_First, _Last, _Dest, _Init);
+}
+
+__declspec(noalias) double __stdcall __std_inclusive_scan_plus_d(
+    const void* const _First, const void* const _Last, void* const _Dest, const double _Init) noexcept {
+    return _Scanning::_Scan_disp<true>(_First, _Last, _Dest, _Init);
+}
+
+__declspec(noalias) uint32_t __stdcall __std_exclusive_scan_plus_4(
+    const void* const _First, const void* const _Last, void* const _Dest, const uint32_t _Init) noexcept {
+    return _Scanning::_Scan_disp<false>(_First, _Last, _Dest, _Init);
+}
+
+__declspec(noalias) uint64_t __stdcall __std_exclusive_scan_plus_8(
+    const void* const _First, const void* const _Last, void* const _Dest, const uint64_t _Init) noexcept {
+    return _Scanning::_Scan_disp<false>(_First, _Last, _Dest, _Init);
+}
+
+__declspec(noalias) float __stdcall __std_exclusive_scan_plus_f(
+    const void* const _First, const void* const _Last, void* const _Dest, const float _Init) noexcept {
+    return _Scanning::_Scan_disp<false>(_First, _Last, _Dest, _Init);
+}
+
+__declspec(noalias) double __stdcall __std_exclusive_scan_plus_d(
+    const void* const _First, const void* const _Last, void* const _Dest, const double _Init) noexcept {
+    return _Scanning::_Scan_disp<false>(_First, _Last, _Dest, _Init);
+}
+
+__declspec(noalias) void __stdcall __std_adjacent_difference_minus_4(
+    const void* const _First, const void* const _Last, void* const _Dest) noexcept {
+    _Scanning::_Adjacent_difference_disp<uint32_t>(_First, _Last, _Dest);
+}
+
+__declspec(noalias) void __stdcall __std_adjacent_difference_minus_8(
+    const void* const _First, const void* const _Last, void* const _Dest) noexcept {
+    _Scanning::_Adjacent_difference_disp<uint64_t>(_First, _Last, _Dest);
+}
+
+__declspec(noalias) void __stdcall __std_adjacent_difference_minus_f(
+    const void* const _First, const void* const _Last, void* const _Dest) noexcept {
+    _Scanning::_Adjacent_difference_disp<float>(_First, _Last, _Dest);
+}
+
+__declspec(noalias) void __stdcall __std_adjacent_difference_minus_d(
+    const void* const _First, const void* const _Last, void* const _Dest) noexcept {
+    _Scanning::_Adjacent_difference_disp<double>(_First, _Last, _Dest);
+}
+
+} // extern "C"
+#endif // ^^^ !defined(_M_ARM64) ^^^
+
+#ifndef _M_ARM64
+namespace {
+    namespace _Heap {
+        // Binary max-heaps of arithmetic values ordered by less<>, and min-heaps ordered by greater<>.
+        //
+        // is_heap_until checks a vector of consecutive parents against their left and right children at once:
+        // the children of consecutive parents are consecutive too, so two loads cover them, and a shuffle splits
+        // them into the left and the right ones. The scalar loop takes over at the first vector with a violation.
+        // Sifting down is a chain of dependent steps, so there are no lanes to fill there. Instead, each step
+        // picks the child to follow without a branch (which would mispredict half of the time on random data).
+        // Without speculation running ahead, large heaps wait on every load, so each step prefetches the
+        // 16 descendants four levels down, one of which the sift will reach; they span at most three cache lines.
+
+        template <bool _Greater, class _Ty>
+        bool _Pred(const _Ty _Left, const _Ty _Right) noexcept {
+            if constexpr (_Greater) {
+                return _Right < _Left;
+            } else {
+                return _Left < _Right;
+            }
+        }
+
+        template <class _Ty>
+        void _Prefetch(const _Ty* const _Ptr) noexcept {
+#ifdef _M_ARM64EC
+            (void) _Ptr;
+#else // ^^^ defined(_M_ARM64EC) / !defined(_M_ARM64EC) vvv
+            _mm_prefetch(reinterpret_cast<const char*>(_Ptr), _MM_HINT_T0);
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+        }
+
+        template <bool _Greater, class _Ty>
+        void _Push_heap_by_index(_Ty* const _First, size_t _Hole, const size_t _Top, const _Ty _Val) noexcept {
+            // percolate _Hole to _Top or where _Val belongs
+            while (_Top < _Hole) {
+                const size_t _Idx = (_Hole - 1) >> 1;
+                if (!_Pred<_Greater>(_First[_Idx], _Val)) {
+                    break;
+                }
+
+                _First[_Hole] = _First[_Idx];
+                _Hole         = _Idx;
+            }
+
+            _First[_Hole] = _Val;
+        }
+
+        template <bool _Greater, class _Ty>
+        void _Pop_heap_hole_by_index(_Ty* const _First, size_t _Hole, const size_t _Bottom, const _Ty _Val) noexcept {
+            // percolate _Hole to _Bottom, then push _Val; takes the same steps as the header's _Pop_heap_hole_by_index
+            const size_t _Top                   = _Hole;
+            size_t _Idx                         = _Hole;
+            const size_t _Max_sequence_non_leaf = (_Bottom - 1) >> 1;
+            const size_t _Max_prefetch_parent   = _Bottom > 15 ? (_Bottom - 15) >> 4 : 0;
+            while (_Idx < _Max_sequence_non_leaf) { // move _Hole down to larger child
+                if (_Idx < _Max_prefetch_parent) { // the descendants [16 * _Idx + 15, 16 * _Idx + 31) are in range
+                    const _Ty* const _Descendants = _First + (16 * _Idx + 15);
+                    _Prefetch(_Descendants);
+                    if constexpr (sizeof(_Ty) == 8) {
+                        _Prefetch(_Descendants + 8);
+                    }
+
+                    _Prefetch(_Descendants + 15);
+                }
+
+                _Idx = 2 * _Idx + 2;
+                _Idx -= static_cast<size_t>(_Pred<_Greater>(_First[_Idx], _First[_Idx - 1]));
+                _First[_Hole] = _First[_Idx];
+                _Hole         = _Idx;
+            }
+
+            if (_Idx == _Max_sequence_non_leaf && _Bottom % 2 == 0) { // only child at bottom, move _Hole down to it
+                _First[_Hole] = _First[_Bottom - 1];
+                _Hole         = _Bottom - 1;
+            }
+
+            _Push_heap_by_index<_Greater>(_First, _Hole, _Top, _Val);
+        }
+
+        template <bool _Greater, class _Ty>
+        void _Make_heap(_Ty* const _First, const size_t _Bottom) noexcept {
+            for (size_t _Hole = _Bottom >> 1; _Hole > 0;) { // reheap top half, bottom to top
+                --_Hole;
+                _Pop_heap_hole_by_index<_Greater>(_First, _Hole, _Bottom, _First[_Hole]);
+            }
+        }
+
+        template <bool _Greater, class _Ty>
+        void _Pop_heap(_Ty* const _First, const size_t _Size) noexcept {
+            if (_Size < 2) {
+                return;
+            }
+
+            const size_t _Bottom = _Size - 1;
+            const _Ty _Val       = _First[_Bottom];
+            _First[_Bottom]      = _First[0];
+            _Pop_heap_hole_by_index<_Greater>(_First, 0, _Bottom, _Val);
+        }
+
+#ifndef _M_ARM64EC
+        template <class _Ty>
+        __m128i _Split_shuffle_mask() noexcept {
+            // Shuffles the even elements of each 16-byte lane into its low half, and the odd ones into its high half
+            if constexpr (sizeof(_Ty) == 1) {
+                return _mm_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15);
+            } else if constexpr (sizeof(_Ty) == 2) {
+                return _mm_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, 2, 3, 6, 7, 10, 11, 14, 15);
+            } else {
+                static_assert(sizeof(_Ty) == 4);
+                return _mm_setr_epi8(0, 1, 2, 3, 8, 9, 10, 11, 4, 5, 6, 7, 12, 13, 14, 15);
+            }
+        }
+
+        template <class _Ty>
+        __m128i _Sign_bit_sse() noexcept {
+            if constexpr (sizeof(_Ty) == 1) {
+                return _mm_set1_epi8(static_cast<char>(0x80));
+            } else if constexpr (sizeof(_Ty) == 2) {
+                return _mm_set1_epi16(static_cast<short>(0x8000));
+            } else if constexpr (sizeof(_Ty) == 4) {
+                return _mm_set1_epi32(static_cast<int>(0x8000'0000));
+            } else {
+                return _mm_set1_epi64x(static_cast<long long>(0x8000'0000'0000'0000));
+            }
+        }
+
+        struct _Traits_sse {
+            using _Vec_t = __m128i;
+
+            static constexpr size_t _Vec_size = 16;
+
+            static __m128i _Load(const void* const _Src) noexcept {
+                return _mm_loadu_si128(static_cast<const __m128i*>(_Src));
+            }
+
+            template <class _Ty>
+            static void _Split(const __m128i _Lo, const __m128i _Hi, __m128i& _Even, __m128i& _Odd) noexcept {
+                __m128i _Lo_split = _Lo;
+                __m128i _Hi_split = _Hi;
+                if constexpr (sizeof(_Ty) != 8) {
+                    const __m128i _Shuf = _Split_shuffle_mask<_Ty>();
+
+                    _Lo_split = _mm_shuffle_epi8(_Lo, _Shuf);
+                    _Hi_split = _mm_shuffle_epi8(_Hi, _Shuf);
+                }
+
+                _Even = _mm_unpacklo_epi64(_Lo_split, _Hi_split);
+                _Odd  = _mm_unpackhi_epi64(_Lo_split, _Hi_split);
+            }
+
+            template <class _Ty>
+            static __m128i _Cmp_gt(__m128i _Lhs, __m128i _Rhs) noexcept {
+                if constexpr (std::is_same_v<_Ty, float>) {
+                    return _mm_castps_si128(_mm_cmpgt_ps(_mm_castsi128_ps(_Lhs), _mm_castsi128_ps(_Rhs)));
+                } else if constexpr (std::is_same_v<_Ty, double>) {
+                    return _mm_castpd_si128(_mm_cmpgt_pd(_mm_castsi128_pd(_Lhs), _mm_castsi128_pd(_Rhs)));
+                } else {
+                    if constexpr (std::is_unsigned_v<_Ty>) {
+                        const __m128i _Sign = _Sign_bit_sse<_Ty>();
+
+                        _Lhs = _mm_xor_si128(_Lhs, _Sign);
+                        _Rhs = _mm_xor_si128(_Rhs, _Sign);
+                    }
+
+                    if constexpr (sizeof(_Ty) == 1) {
+                        return _mm_cmpgt_epi8(_Lhs, _Rhs);
+                    } else if constexpr (sizeof(_Ty) == 2) {
+                        return _mm_cmpgt_epi16(_Lhs, _Rhs);
+                    } else if constexpr (sizeof(_Ty) == 4) {
+                        return _mm_cmpgt_epi32(_Lhs, _Rhs);
+                    } else {
+                        return _mm_cmpgt_epi64(_Lhs, _Rhs);
+                    }
+                }
+            }
+
+            static bool _Any(const __m128i _Left, const __m128i _Right) noexcept {
+                const __m128i _Either = _mm_or_si128(_Left, _Right);
+                return !_mm_testz_si128(_Either, _Either);
+            }
+        };
+
+        struct _Traits_avx {
+            using _Vec_t = __m256i;
+
+            static constexpr size_t _Vec_size = 32;
+
+            static __m256i _Load(const void* const _Src) noexcept {
+                return _mm256_loadu_si256(static_cast<const __m256i*>(_Src));
+            }
+
+            template <class _Ty>
+            static void _Split(const __m256i _Lo, const __m256i _Hi, __m256i& _Even, __m256i& _Odd) noexcept {
+                __m256i _Lo_split = _Lo;
+                __m256i _Hi_split = _Hi;
+                if constexpr (sizeof(_Ty) != 8) {
+                    const __m256i _Shuf = _mm256_broadcastsi128_si256(_Split_shuffle_mask<_Ty>());
+
+                    _Lo_split = _mm256_shuffle_epi8(_Lo, _Shuf);
+                    _Hi_split = _mm256_shuffle_epi8(_Hi, _Shuf);
+                }
+
+                // The unpacks work within lanes, leaving the 64-bit quarters in the order 0, 2, 1, 3
+                _Even = _mm256_permute4x64_epi64(_mm256_unpacklo_epi64(_Lo_split, _Hi_split), _MM_SHUFFLE(3, 1, 2, 0));
+                _Odd  = _mm256_permute4x64_epi64(_mm256_unpackhi_epi64(_Lo_split, _Hi_split), _MM_SHUFFLE(3, 1, 2, 0));
+            }
+
+            template <class _Ty>
+            static __m256i _Cmp_gt(__m256i _Lhs, __m256i _Rhs) noexcept {
+                if constexpr (std::is_same_v<_Ty, float>) {
+                    return _mm256_castps_si256(
+                        _mm256_cmp_ps(_mm256_castsi256_ps(_Lhs), _mm256_castsi256_ps(_Rhs), _CMP_GT_OQ));
+                } else if constexpr (std::is_same_v<_Ty, double>) {
+                    return _mm256_castpd_si256(
+                        _mm256_cmp_pd(_mm256_castsi256_pd(_Lhs), _mm256_castsi256_pd(_Rhs), _CMP_GT_OQ));
+                } else {
+                    if constexpr (std::is_unsigned_v<_Ty>) {
+                        const __m256i _Sign = _mm256_broadcastsi128_si256(_Sign_bit_sse<_Ty>());
+
+                        _Lhs = _mm256_xor_si256(_Lhs, _Sign);
+                        _Rhs = _mm256_xor_si256(_Rhs, _Sign);
+                    }
+
+                    if constexpr (sizeof(_Ty) == 1) {
+                        return _mm256_cmpgt_epi8(_Lhs, _Rhs);
+                    } else if constexpr (sizeof(_Ty) == 2) {
+                        return _mm256_cmpgt_epi16(_Lhs, _Rhs);
+                    } else if constexpr (sizeof(_Ty) == 4) {
+                        return _mm256_cmpgt_epi32(_Lhs, _Rhs);
+                    } else {
+                        return _mm256_cmpgt_epi64(_Lhs, _Rhs);
+                    }
+                }
+            }
+
+            static bool _Any(const __m256i _Left, const __m256i _Right) noexcept {
+                const __m256i _Either = _mm256_or_si256(_Left, _Right);
+                return !_mm256_testz_si256(_Either, _Either);
+            }
+        };
+
+        template <class _Traits, bool _Greater, class _Ty>
+        size_t _Is_heap_until_impl(const _Ty* const _First, const size_t _Size, size_t _Parent) noexcept {
+            // Checks the parents from _Parent on, a vector at a time, while all their children are in range.
+            // Returns the first parent not known to be in order with its children.
+            constexpr size_t _Lanes = _Traits::_Vec_size / sizeof(_Ty);
+
+            for (; 2 * _Parent + 2 * _Lanes < _Size; _Parent += _Lanes) {
+                const auto _Parents = _Traits::_Load(_First + _Parent);
+                typename _Traits::_Vec_t _Left;
+                typename _Traits::_Vec_t _Right;
+                _Traits::template _Split<_Ty>(_Traits::_Load(_First + (2 * _Parent + 1)),
+                    _Traits::_Load(_First + (2 * _Parent + 1 + _Lanes)), _Left, _Right);
+
+                bool _Violated;
+                if constexpr (_Greater) {
+                    _Violated = _Traits::_Any(_Traits::template _Cmp_gt<_Ty>(_Parents, _Left),
+                        _Traits::template _Cmp_gt<_Ty>(_Parents, _Right));
+                } else {
+                    _Violated = _Traits::_Any(_Traits::template _Cmp_gt<_Ty>(_Left, _Parents),
+                        _Traits::template _Cmp_gt<_Ty>(_Right, _Parents));
+                }
+
+                if (_Violated) {
+                    break;
+                }
+            }
+
+            return _Parent;
+        }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+
+        template <bool _Greater, class _Ty>
+        const _Ty* _Is_heap_until(const _Ty* const _First, const _Ty* const _Last) noexcept {
+            const size_t _Size = static_cast<size_t>(_Last - _First);
+            size_t _Parent     = 0;
+#ifndef _M_ARM64EC
+            const size_t _Size_bytes = _Byte_length(_First, _Last);
+            if (_Size_bytes > 64 && _Use_avx2()) {
+                _Zeroupper_on_exit _Guard; // TRANSITION, DevCom-10331414
+
+                _Parent = _Is_heap_until_impl<_Traits_avx, _Greater>(_First, _Size, _Parent);
+            }
+
+            if (_Size_bytes > 32 && _Use_sse42()) {
+                _Parent = _Is_heap_until_impl<_Traits_sse, _Greater>(_First, _Size, _Parent);
+            }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+
+            // The children of the parents before _Parent are in order
+            for (size_t _Child = 2 * _Parent + 1; _Child < _Size; ++_Child) {
+                if (_Pred<_Greater>(_First[(_Child - 1) >> 1], _First[_Child])) {
+                    return _First + _Child;
+                }
+            }
+
+            return _Last;
+        }
+
+        template <class _Ty>
+        const void* _Is_heap_until_disp(
+            const void* const _First, const void* const _Last, const bool _Greater) noexcept {
+            const auto _First_ptr = static_cast<const _Ty*>(_First);
+            const auto _Last_ptr  = static_cast<const _Ty*>(_Last);
+            if (_Greater) {
+                return _Is_heap_until<true>(_First_ptr, _Last_ptr);
+            } else {
+                return _Is_heap_until<false>(_First_ptr, _Last_ptr);
+            }
+        }
+
+        template <class _Ty>
+        void _Make_heap_disp(void* const _First, void* const _Last, const bool _Greater) noexcept {
+            const size_t _Size = _Byte_length(_First, _Last) / sizeof(_Ty);
+            if (_Greater) {
+                _Make_heap<true>(static_cast<_Ty*>(_First), _Size);
+            } else {
+                _Make_heap<false>(static_cast<_Ty*>(_First), _Size);
+            }
+        }
+
+        template <class _Ty>
+        void _Pop_heap_disp(void* const _First, void* const _Last, const bool _Greater) noexcept {
+            const size_t _Size = _Byte_length(_First, _Last) / sizeof(_Ty);
+            if (_Greater) {
+                _Pop_heap<true>(static_cast<_Ty*>(_First), _Size);
+            } else {
+                _Pop_heap<false>(static_cast<_Ty*>(_First), _Size);
+            }
+        }
+    } // namespace _Heap
+} // unnamed namespace
+
+extern "C" {
+
+const void* __stdcall __std_is_heap_until_1i(
+    const void* const _First, const void* const _Last, const bool _Greater) noexcept {
+    return _Heap::_Is_heap_until_disp<int8_t>(_First, _Last, _Greater);
+}
+
+const void* __stdcall __std_is_heap_until_1u(
+    const void* const _First, const void* const _Last, const bool _Greater) noexcept {
+    return _Heap::_Is_heap_until_disp<uint8_t>(_First, _Last, _Greater);
+}
+
+const void* __stdcall __std_is_heap_until_2i(
+    const void* const _First, const void* const _Last, const bool _Greater) noexcept {
+    return _Heap::_Is_heap_until_disp<int16_t>(_First, _Last, _Greater);
+}
+
+const void* __stdcall __std_is_heap_until_2u(
+    const void* const _First, const void* const _Last, const bool _Greater) noexcept {
+    return _Heap::_Is_heap_until_disp<uint16_t>(_First, _Last, _Greater);
+}
+
+const void* __stdcall __std_is_heap_until_4i(
+    const void* const _First, const void* const _Last, const bool _Greater) noexcept {
+    return _Heap::_Is_heap_until_disp<int32_t>(_First, _Last, _Greater);
+}
+
+const void* __stdcall __std_is_heap_until_4u(
+    const void* const _First, const void* const _Last, const bool _Greater) noexcept {
+    return _Heap::_Is_heap_until_disp<uint32_t>(_First, _Last, _Greater);
+}
+
+const void* __stdcall __std_is_heap_until_8i(
+    const void* const _First, const void* const _Last, const bool _Greater) noexcept {
+    return _Heap::_Is_heap_until_disp<int64_t>(_First, _Last, _Greater);
+}
+
+const void* __stdcall __std_is_heap_until_8u(
+    const void* const _First, const void* const _Last, const bool _Greater) noexcept {
+    return _Heap::_Is_heap_until_disp<uint64_t>(_First, _Last, _Greater);
+}
+
+const void* __stdcall __std_is_heap_until_f(
+    const void* const _First, const void* const _Last, const bool _Greater) noexcept {
+    return _Heap::_Is_heap_until_disp<float>(_First, _Last, _Greater);
+}
+
+const void* __stdcall __std_is_heap_until_d(
+    const void* const _First, const void* const _Last, const bool _Greater) noexcept {
+    return _Heap::_Is_heap_until_disp<double>(_First, _Last, _Greater);
+}
+
+__declspec(noalias) void __stdcall __std_make_heap_1i(
+    void* const _First, void* const _Last, const bool _Greater) noexcept {
+    _Heap::_Make_heap_disp<int8_t>(_First, _Last, _Greater);
+}
+
+__declspec(noalias) void __stdcall __std_make_heap_1u(
+    void* const _First, void* const _Last, const bool _Greater) noexcept {
+    _Heap::_Make_heap_disp<uint8_t>(_First, _Last, _Greater);
+}
+
+__declspec(noalias) void __stdcall __std_make_heap_2i(
+    void* const _First, void* const _Last, const bool _Greater) noexcept {
+    _Heap::_Make_heap_disp<int16_t>(_First, _Last, _Greater);
+}
+
+__declspec(noalias) void __stdcall __std_make_heap_2u(
+    void* const _First, void* const _Last, const bool _Greater) noexcept {
+    _Heap::_Make_heap_disp<uint16_t>(_First, _Last, _Greater);
+}
+
+__declspec(noalias) void __stdcall __std_make_heap_4i(
+    void* const _First, void* const _Last, const bool _Greater) noexcept {
+    _Heap::_Make_heap_disp<int32_t>(_First, _Last, _Greater);
+}
+
+__declspec(noalias) void __stdcall __std_make_heap_4u(
+    void* const _First, void* const _Last, const bool _Greater) noexcept {
+    _Heap::_Make_heap_disp<uint32_t>(_First, _Last, _Greater);
+}
+
+__declspec(noalias) void __stdcall __std_make_heap_8i(
+    void* const _First, void* const _Last, const bool _Greater) noexcept {
+    _Heap::_Make_heap_disp<int64_t>(_First, _Last, _Greater);
+}
+
+__declspec(noalias) void __stdcall __std_make_heap_8u(
+    void* const _First, void* const _Last, const bool _Greater) noexcept {
+    _Heap::_Make_heap_disp<uint64_t>(_First, _Last, _Greater);
+}
+
+__declspec(noalias) void __stdcall __std_make_heap_f(
+    void* const _First, void* const _Last, const bool _Greater) noexcept {
+    _Heap::_Make_heap_disp<float>(_First, _Last, _Greater);
+}
+
+__declspec(noalias) void __stdcall __std_make_heap_d(
+    void* const _First, void* const _Last, const bool _Greater) noexcept {
+    _Heap::_Make_heap_disp<double>(_First, _Last, _Greater);
+}
+
+__declspec(noalias) void __stdcall __std_pop_heap_1i(
+    void* const _First, void* const _Last, const bool _Greater) noexcept {
+    _Heap::_Pop_heap_disp<int8_t>(_First, _Last, _Greater);
+}
+
+__declspec(noalias) void __stdcall __std_pop_heap_1u(
+    void* const _First, void* const _Last, const bool _Greater) noexcept {
+    _Heap::_Pop_heap_disp<uint8_t>(_First, _Last, _Greater);
+}
+
+__declspec(noalias) void __stdcall __std_pop_heap_2i(
+    void* const _First, void* const _Last, const bool _Greater) noexcept {
+    _Heap::_Pop_heap_disp<int16_t>(_First, _Last, _Greater);
+}
+
+__declspec(noalias) void __stdcall __std_pop_heap_2u(
+    void* const _First, void* const _Last, const bool _Greater) noexcept {
+    _Heap::_Pop_heap_disp<uint16_t>(_First, _Last, _Greater);
+}
+
+__declspec(noalias) void __stdcall __std_pop_heap_4i(
+    void* const _First, void* const _Last, const bool _Greater) noexcept {
+    _Heap::_Pop_heap_disp<int32_t>(_First, _Last, _Greater);
+}
+
+__declspec(noalias) void __stdcall __std_pop_heap_4u(
+    void* const _First, void* const _Last, const bool _Greater) noexcept {
+    _Heap::_Pop_heap_disp<uint32_t>(_First, _Last, _Greater);
+}
+
+__declspec(noalias) void __stdcall __std_pop_heap_8i(
+    void* const _First, void* const _Last, const bool _Greater) noexcept {
+    _Heap::_Pop_heap_disp<int64_t>(_First, _Last, _Greater);
+}
+
+__declspec(noalias) void __stdcall __std_pop_heap_8u(
+    void* const _First, void* const _Last, const bool _Greater) noexcept {
+    _Heap::_Pop_heap_disp<uint64_t>(_First, _Last, _Greater);
+}
+
+__declspec(noalias) void __stdcall __std_pop_heap_f(
+    void* const _First, void* const _Last, const bool _Greater) noexcept {
+    _Heap::_Pop_heap_disp<float>(_First, _Last, _Greater);
+}
+
+__declspec(noalias) void __stdcall __std_pop_heap_d(
+    void* const _First, void* const _Last, const bool _Greater) noexcept {
+    _Heap::_Pop_heap_disp<double>(_First, _Last, _Greater);
+}
+
+} // extern "C"
+#endif // ^^^ !defined(_M_ARM64) ^^^
+
+namespace {
+    namespace _Finding {
+#if defined(_M_ARM64) || defined(_M_ARM64EC)
+        struct _Find_traits_1 {
+            static uint8x16_t _Load_q(const void* const _Ptr) noexcept {
+                return vld1q_u8(static_cast<const uint8_t*>(_Ptr));
+            }
 
             static uint8x8_t _Load(const void* const _Ptr) noexcept {
                 return vld1_u8(static_cast<const uint8_t*>(_Ptr));
@@ -4461,17 +7968,34 @@ namespace {
                 return _mm256_set1_epi8(_Val);
             }
 
-            static __m128i _Set_sse(const uint8_t _Val) noexcept {
-                return _mm_shuffle_epi8(_mm_cvtsi32_si128(_Val), _mm_setzero_si128());
+            static __m128i _Set_sse(const uint8_t _Val) noexcept {
+                return _mm_shuffle_epi8(_mm_cvtsi32_si128(_Val), _mm_setzero_si128());
+            }
+
+            static __m256i _Cmp_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+                return _mm256_cmpeq_epi8(_Lhs, _Rhs);
+            }
+
+            static __m128i _Cmp_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+                return _mm_cmpeq_epi8(_Lhs, _Rhs);
+            }
+
+#ifdef _WIN64
+            // AVX-512 masks have one bit per element, not one bit per byte.
+            static constexpr uint64_t _Full_mask_avx512 = ~0ULL;
+
+            static __m512i _Set_avx512(const uint8_t _Val) noexcept {
+                return _mm512_set1_epi8(static_cast<char>(_Val));
             }
 
-            static __m256i _Cmp_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
-                return _mm256_cmpeq_epi8(_Lhs, _Rhs);
+            static __m512i _Load_mask_avx512(const void* const _Src, const uint64_t _Mask) noexcept {
+                return _mm512_maskz_loadu_epi8(static_cast<__mmask64>(_Mask), _Src);
             }
 
-            static __m128i _Cmp_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
-                return _mm_cmpeq_epi8(_Lhs, _Rhs);
+            static uint64_t _Cmp_avx512(const __m512i _Lhs, const __m512i _Rhs) noexcept {
+                return _mm512_cmpeq_epi8_mask(_Lhs, _Rhs);
             }
+#endif // ^^^ defined(_WIN64) ^^^
         };
 
         struct _Find_traits_2 {
@@ -4490,6 +8014,23 @@ namespace {
             static __m128i _Cmp_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
                 return _mm_cmpeq_epi16(_Lhs, _Rhs);
             }
+
+#ifdef _WIN64
+            // AVX-512 masks have one bit per element, not one bit per byte.
+            static constexpr uint64_t _Full_mask_avx512 = 0xFFFF'FFFFULL;
+
+            static __m512i _Set_avx512(const uint16_t _Val) noexcept {
+                return _mm512_set1_epi16(static_cast<short>(_Val));
+            }
+
+            static __m512i _Load_mask_avx512(const void* const _Src, const uint64_t _Mask) noexcept {
+                return _mm512_maskz_loadu_epi16(static_cast<__mmask32>(_Mask), _Src);
+            }
+
+            static uint64_t _Cmp_avx512(const __m512i _Lhs, const __m512i _Rhs) noexcept {
+                return _mm512_cmpeq_epi16_mask(_Lhs, _Rhs);
+            }
+#endif // ^^^ defined(_WIN64) ^^^
         };
 
         struct _Find_traits_4 {
@@ -4508,6 +8049,23 @@ namespace {
             static __m128i _Cmp_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
                 return _mm_cmpeq_epi32(_Lhs, _Rhs);
             }
+
+#ifdef _WIN64
+            // AVX-512 masks have one bit per element, not one bit per byte.
+            static constexpr uint64_t _Full_mask_avx512 = 0xFFFFULL;
+
+            static __m512i _Set_avx512(const uint32_t _Val) noexcept {
+                return _mm512_set1_epi32(static_cast<int>(_Val));
+            }
+
+            static __m512i _Load_mask_avx512(const void* const _Src, const uint64_t _Mask) noexcept {
+                return _mm512_maskz_loadu_epi32(static_cast<__mmask16>(_Mask), _Src);
+            }
+
+            static uint64_t _Cmp_avx512(const __m512i _Lhs, const __m512i _Rhs) noexcept {
+                return _mm512_cmpeq_epi32_mask(_Lhs, _Rhs);
+            }
+#endif // ^^^ defined(_WIN64) ^^^
         };
 
         struct _Find_traits_8 {
@@ -4526,6 +8084,23 @@ namespace {
             static __m128i _Cmp_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
                 return _mm_cmpeq_epi64(_Lhs, _Rhs);
             }
+
+#ifdef _WIN64
+            // AVX-512 masks have one bit per element, not one bit per byte.
+            static constexpr uint64_t _Full_mask_avx512 = 0xFFULL;
+
+            static __m512i _Set_avx512(const uint64_t _Val) noexcept {
+                return _mm512_set1_epi64(static_cast<long long>(_Val));
+            }
+
+            static __m512i _Load_mask_avx512(const void* const _Src, const uint64_t _Mask) noexcept {
+                return _mm512_maskz_loadu_epi64(static_cast<__mmask8>(_Mask), _Src);
+            }
+
+            static uint64_t _Cmp_avx512(const __m512i _Lhs, const __m512i _Rhs) noexcept {
+                return _mm512_cmpeq_epi64_mask(_Lhs, _Rhs);
+            }
+#endif // ^^^ defined(_WIN64) ^^^
         };
 #endif // ^^^ !defined(_M_ARM64) && !defined(_M_ARM64EC) ^^^
 
@@ -4873,6 +8448,52 @@ namespace {
         const void* __stdcall _Find_impl(const void* _First, const void* const _Last, const _Ty _Val) noexcept {
             const size_t _Size_bytes = _Byte_length(_First, _Last);
 
+#ifdef _WIN64
+            if (const size_t _Avx512_size = _Size_bytes & ~size_t{0x3F}; _Avx512_size != 0 && _Use_avx512()) {
+                _Zeroupper_on_exit _Guard; // TRANSITION, DevCom-10331414
+
+                const __m512i _Comparand = _Traits::_Set_avx512(_Val);
+                const void* _Stop_at     = _First;
+                _Advance_bytes(_Stop_at, _Avx512_size);
+
+                do {
+                    const __m512i _Data = _mm512_loadu_si512(_First);
+                    uint64_t _Bingo     = _Traits::_Cmp_avx512(_Data, _Comparand);
+
+                    if constexpr (_Pred == _Predicate::_Not_equal) {
+                        _Bingo ^= _Traits::_Full_mask_avx512;
+                    }
+
+                    if (_Bingo != 0) {
+                        _Advance_bytes(_First, _tzcnt_u64(_Bingo) * sizeof(_Ty));
+                        return _First;
+                    }
+
+                    _Advance_bytes(_First, 64);
+                } while (_First != _Stop_at);
+
+                // The tail is handled with a masked load, so there's no scalar epilogue.
+                if (const size_t _Tail_count = (_Size_bytes & 0x3F) / sizeof(_Ty); _Tail_count != 0) {
+                    const uint64_t _Tail_mask = _Avx512_tail_mask(_Tail_count);
+                    const __m512i _Data       = _Traits::_Load_mask_avx512(_First, _Tail_mask);
+                    uint64_t _Bingo           = _Traits::_Cmp_avx512(_Data, _Comparand);
+
+                    if constexpr (_Pred == _Predicate::_Not_equal) {
+                        _Bingo = ~_Bingo & _Tail_mask;
+                    } else {
+                        _Bingo &= _Tail_mask;
+                    }
+
+                    if (_Bingo != 0) {
+                        _Advance_bytes(_First, _tzcnt_u64(_Bingo) * sizeof(_Ty));
+                        return _First;
+                    }
+                }
+
+                return _Last;
+            }
+#endif // ^^^ defined(_WIN64) ^^^
+
             if (const size_t _Avx_size = _Size_bytes & ~size_t{0x1F}; _Avx_size != 0 && _Use_avx2()) {
                 _Zeroupper_on_exit _Guard; // TRANSITION, DevCom-10331414
 
@@ -5840,6 +9461,31 @@ namespace {
 
             const size_t _Size_bytes = _Byte_length(_First, _Last);
 
+#ifdef _WIN64
+            if (const size_t _Avx512_size = _Size_bytes & ~size_t{0x3F}; _Avx512_size != 0 && _Use_avx512()) {
+                // Mask registers hold one bit per element, so counting is a popcount; no counter overflow to manage.
+                const __m512i _Comparand = _Traits::_Set_avx512(_Val);
+                const void* _Stop_at     = _First;
+                _Advance_bytes(_Stop_at, _Avx512_size);
+
+                do {
+                    const __m512i _Data = _mm512_loadu_si512(_First);
+                    _Result += __popcnt64(_Traits::_Cmp_avx512(_Data, _Comparand));
+                    _Advance_bytes(_First, 64);
+                } while (_First != _Stop_at);
+
+                if (const size_t _Tail_count = (_Size_bytes & 0x3F) / sizeof(_Ty); _Tail_count != 0) {
+                    const uint64_t _Tail_mask = _Avx512_tail_mask(_Tail_count);
+                    const __m512i _Data       = _Traits::_Load_mask_avx512(_First, _Tail_mask);
+                    _Result += __popcnt64(_Traits::_Cmp_avx512(_Data, _Comparand) & _Tail_mask);
+                }
+
+                _mm256_zeroupper(); // TRANSITION, DevCom-10331414
+
+                return _Result;
+            }
+#endif // ^^^ defined(_WIN64) ^^^
+
             if (size_t _Avx_size = _Size_bytes & ~size_t{0x1F}; _Avx_size != 0 && _Use_avx2()) {
                 const __m256i _Comparand = _Traits::_Set_avx(_Val);
                 const void* _Stop_at     = _First;
@@ -9398,29 +13044,470 @@ const void* __stdcall __std_find_end_2(
 #endif // ^^^ !defined(_M_ARM64) && !defined(_M_ARM64EC) ^^^
 }
 
-const void* __stdcall __std_find_end_4(
-    const void* const _First1, const void* const _Last1, const void* const _First2, const size_t _Count2) noexcept {
-#if defined(_M_ARM64) || defined(_M_ARM64EC)
-    return _Find_seq::_Find_end_impl<_Finding::_Find_traits_4, _Find_seq::_Find_seq_traits_neon_4, uint32_t>(
-        _First1, _Last1, _First2, _Count2);
-#else // ^^^ defined(_M_ARM64) || defined(_M_ARM64EC) / !defined(_M_ARM64) && !defined(_M_ARM64EC) vvv
-    return _Find_seq::_Find_end_impl<_Finding::_Find_traits_4, _Find_seq::_Find_seq_traits_avx_4,
-        _Find_seq::_Find_seq_traits_sse_4, uint32_t>(_First1, _Last1, _First2, _Count2);
-#endif // ^^^ !defined(_M_ARM64) && !defined(_M_ARM64EC) ^^^
+const void* __stdcall __std_find_end_4(
+    const void* const _First1, const void* const _Last1, const void* const _First2, const size_t _Count2) noexcept {
+#if defined(_M_ARM64) || defined(_M_ARM64EC)
+    return _Find_seq::_Find_end_impl<_Finding::_Find_traits_4, _Find_seq::_Find_seq_traits_neon_4, uint32_t>(
+        _First1, _Last1, _First2, _Count2);
+#else // ^^^ defined(_M_ARM64) || defined(_M_ARM64EC) / !defined(_M_ARM64) && !defined(_M_ARM64EC) vvv
+    return _Find_seq::_Find_end_impl<_Finding::_Find_traits_4, _Find_seq::_Find_seq_traits_avx_4,
+        _Find_seq::_Find_seq_traits_sse_4, uint32_t>(_First1, _Last1, _First2, _Count2);
+#endif // ^^^ !defined(_M_ARM64) && !defined(_M_ARM64EC) ^^^
+}
+
+const void* __stdcall __std_find_end_8(
+    const void* const _First1, const void* const _Last1, const void* const _First2, const size_t _Count2) noexcept {
+#if defined(_M_ARM64) || defined(_M_ARM64EC)
+    return _Find_seq::_Find_end_impl<_Finding::_Find_traits_8, _Find_seq::_Find_seq_traits_neon_8, uint64_t>(
+        _First1, _Last1, _First2, _Count2);
+#else // ^^^ defined(_M_ARM64) || defined(_M_ARM64EC) / !defined(_M_ARM64) && !defined(_M_ARM64EC) vvv
+    return _Find_seq::_Find_end_impl<_Finding::_Find_traits_8, _Find_seq::_Find_seq_traits_avx_8,
+        _Find_seq::_Find_seq_traits_sse_8, uint64_t>(_First1, _Last1, _First2, _Count2);
+#endif // ^^^ !defined(_M_ARM64) && !defined(_M_ARM64EC) ^^^
+}
+
+} // extern "C"
+
+#ifndef _M_ARM64
+namespace {
+    namespace _Fixed_stride {
+        // find, count, and search for elements of 3, 6, 12, 16, 24, 32, 48, or 64 bytes, compared lane by lane.
+        //
+        // Each of these sizes evenly divides a block of 64 bytes (48 bytes for 3, 6, 12, 24, and 48), so a block holds
+        // whole elements, and the value repeated over a block lines up with them. Comparing a block with that pattern
+        // in lanes of 8, 4, or 1 bytes (the widest that divide the size) gives a mask of equal lanes; AND-ing it
+        // with itself shifted by 1, 2, 4, ... lanes leaves the lowest bit of an element set only if all of its
+        // lanes are equal. A range that isn't a whole number of blocks ends with one more block that overlaps
+        // the previous one.
+
+        template <size_t _Size>
+        constexpr size_t _Block_size = 64 % _Size == 0 ? 64 : 48;
+
+        template <size_t _Size>
+        constexpr size_t _Lane_size = _Size % 8 == 0 ? 8 : _Size % 4 == 0 ? 4 : 1;
+
+        template <size_t _Size>
+        constexpr size_t _Element_lanes = _Size / _Lane_size<_Size>;
+
+        template <size_t _Size>
+        constexpr uint64_t _Element_starts() noexcept {
+            uint64_t _Result = 0;
+            for (size_t _Ix = 0; _Ix != _Block_size<_Size> / _Lane_size<_Size>; _Ix += _Element_lanes<_Size>) {
+                _Result |= uint64_t{1} << _Ix;
+            }
+
+            return _Result;
+        }
+
+        // Each bit of _Mask stands for _Width equal lanes starting there
+        template <size_t _Size, size_t _Width = 1>
+        uint64_t _Whole_elements(const uint64_t _Mask) noexcept {
+            constexpr size_t _Lanes = _Element_lanes<_Size>;
+            if constexpr (_Width * 2 <= _Lanes) {
+                return _Whole_elements<_Size, _Width * 2>(_Mask & (_Mask >> _Width));
+            } else if constexpr (_Width != _Lanes) { // this step overlaps the previous ones
+                return _Whole_elements<_Size, _Lanes>(_Mask & (_Mask >> (_Lanes - _Width)));
+            } else {
+                return _Mask & _Element_starts<_Size>();
+            }
+        }
+
+#ifndef _M_ARM64EC
+        unsigned long _Lowest_bit(const uint64_t _Mask) noexcept {
+#ifdef _WIN64
+            return static_cast<unsigned long>(_tzcnt_u64(_Mask));
+#else // ^^^ defined(_WIN64) / !defined(_WIN64) vvv
+            const auto _Low = static_cast<uint32_t>(_Mask);
+            return _Low != 0 ? _tzcnt_u32(_Low) : 32 + _tzcnt_u32(static_cast<uint32_t>(_Mask >> 32));
+#endif // ^^^ !defined(_WIN64) ^^^
+        }
+
+        size_t _Bit_count(const uint64_t _Mask) noexcept { // Assume POPCNT is available with SSE4.2
+#ifdef _WIN64
+            return __popcnt64(_Mask);
+#else // ^^^ defined(_WIN64) / !defined(_WIN64) vvv
+            return __popcnt(static_cast<uint32_t>(_Mask)) + __popcnt(static_cast<uint32_t>(_Mask >> 32));
+#endif // ^^^ !defined(_WIN64) ^^^
+        }
+
+        struct _Traits_sse {
+            using _Vec_t                      = __m128i;
+            static constexpr size_t _Vec_size = 16;
+
+            static __m128i _Load(const void* const _Src) noexcept {
+                return _mm_loadu_si128(static_cast<const __m128i*>(_Src));
+            }
+
+            template <size_t _Lane>
+            static uint64_t _Mask_eq(const __m128i _Left, const __m128i _Right) noexcept {
+                if constexpr (_Lane == 8) {
+                    return static_cast<uint32_t>(_mm_movemask_pd(_mm_castsi128_pd(_mm_cmpeq_epi64(_Left, _Right))));
+                } else if constexpr (_Lane == 4) {
+                    return static_cast<uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(_Left, _Right))));
+                } else {
+                    return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_Left, _Right)));
+                }
+            }
+        };
+
+        struct _Traits_avx {
+            using _Vec_t                      = __m256i;
+            static constexpr size_t _Vec_size = 32;
+
+            static __m256i _Load(const void* const _Src) noexcept {
+                return _mm256_loadu_si256(static_cast<const __m256i*>(_Src));
+            }
+
+            template <size_t _Lane>
+            static uint64_t _Mask_eq(const __m256i _Left, const __m256i _Right) noexcept {
+                if constexpr (_Lane == 8) {
+                    const __m256d _Eq = _mm256_castsi256_pd(_mm256_cmpeq_epi64(_Left, _Right));
+                    return static_cast<uint32_t>(_mm256_movemask_pd(_Eq));
+                } else if constexpr (_Lane == 4) {
+                    const __m256 _Eq = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_Left, _Right));
+                    return static_cast<uint32_t>(_mm256_movemask_ps(_Eq));
+                } else {
+                    return static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_Left, _Right)));
+                }
+            }
+        };
+
+        // Compares a block with the pattern using the vectors of _Traits;
+        // a 48-byte block compared with 32-byte vectors ends with a 16-byte one.
+        template <class _Traits, size_t _Size>
+        struct _Block_matcher {
+            static constexpr size_t _Lane       = _Lane_size<_Size>;
+            static constexpr size_t _Wide_count = _Block_size<_Size> / _Traits::_Vec_size;
+            static constexpr bool _Has_narrow   = _Block_size<_Size> % _Traits::_Vec_size != 0;
+
+            typename _Traits::_Vec_t _Wide[_Wide_count];
+            __m128i _Narrow{};
+
+            explicit _Block_matcher(const unsigned char* const _Pattern) noexcept {
+                for (size_t _Ix = 0; _Ix != _Wide_count; ++_Ix) {
+                    _Wide[_Ix] = _Traits::_Load(_Pattern + _Ix * _Traits::_Vec_size);
+                }
+
+                if constexpr (_Has_narrow) {
+                    _Narrow = _Traits_sse::_Load(_Pattern + _Wide_count * _Traits::_Vec_size);
+                }
+            }
+
+            // Returns the mask of the first lanes of the elements that are equal to the value
+            uint64_t _Match(const void* const _Src) const noexcept {
+                return _Whole_elements<_Size>(_Lanes_eq<0>(static_cast<const unsigned char*>(_Src)));
+            }
+
+            // Unrolled at compile time, so that the pattern stays in registers
+            template <size_t _Ix>
+            uint64_t _Lanes_eq(const unsigned char* const _Src) const noexcept {
+                constexpr size_t _Offset = _Ix * _Traits::_Vec_size;
+                if constexpr (_Ix != _Wide_count) {
+                    const auto _Data   = _Traits::_Load(_Src + _Offset);
+                    const uint64_t _Eq = _Traits::template _Mask_eq<_Lane>(_Data, _Wide[_Ix]);
+                    return (_Eq << (_Offset / _Lane)) | _Lanes_eq<_Ix + 1>(_Src);
+                } else if constexpr (_Has_narrow) {
+                    const auto _Data = _Traits_sse::_Load(_Src + _Offset);
+                    return _Traits_sse::_Mask_eq<_Lane>(_Data, _Narrow) << (_Offset / _Lane);
+                } else {
+                    return 0;
+                }
+            }
+        };
+
+        template <size_t _Size>
+        void _Fill_pattern(unsigned char* const _Pattern, const void* const _Val) noexcept {
+            for (size_t _Ix = 0; _Ix != _Block_size<_Size>; _Ix += _Size) {
+                memcpy(_Pattern + _Ix, _Val, _Size);
+            }
+        }
+
+        // [_First, _Last) spans at least one block
+        template <class _Traits, size_t _Size>
+        const void* _Find_blocks(const void* _First, const void* const _Last, const void* const _Val) noexcept {
+            constexpr size_t _Block = _Block_size<_Size>;
+
+            unsigned char _Pattern[_Block];
+            _Fill_pattern<_Size>(_Pattern, _Val);
+            const _Block_matcher<_Traits, _Size> _Matcher(_Pattern);
+
+            const size_t _Tail   = _Byte_length(_First, _Last) % _Block;
+            const void* _Stop_at = _Last;
+            _Rewind_bytes(_Stop_at, _Tail);
+
+            for (; _First != _Stop_at; _Advance_bytes(_First, _Block)) {
+                if (const uint64_t _Bingo = _Matcher._Match(_First); _Bingo != 0) {
+                    _Advance_bytes(_First, _Lowest_bit(_Bingo) * _Lane_size<_Size>);
+                    return _First;
+                }
+            }
+
+            if (_Tail != 0) {
+                // The elements shared with the previous block aren't equal, so there's nothing to mask out
+                _Rewind_bytes(_First, _Block - _Tail);
+                if (const uint64_t _Bingo = _Matcher._Match(_First); _Bingo != 0) {
+                    _Advance_bytes(_First, _Lowest_bit(_Bingo) * _Lane_size<_Size>);
+                    return _First;
+                }
+            }
+
+            return _Last;
+        }
+
+        // [_First, _Last) spans at least one block
+        template <class _Traits, size_t _Size>
+        size_t _Count_blocks(const void* _First, const void* const _Last, const void* const _Val) noexcept {
+            constexpr size_t _Block = _Block_size<_Size>;
+
+            unsigned char _Pattern[_Block];
+            _Fill_pattern<_Size>(_Pattern, _Val);
+            const _Block_matcher<_Traits, _Size> _Matcher(_Pattern);
+
+            const size_t _Tail   = _Byte_length(_First, _Last) % _Block;
+            const void* _Stop_at = _Last;
+            _Rewind_bytes(_Stop_at, _Tail);
+
+            size_t _Result = 0;
+            for (; _First != _Stop_at; _Advance_bytes(_First, _Block)) {
+                _Result += _Bit_count(_Matcher._Match(_First));
+            }
+
+            if (_Tail != 0) {
+                // Drop the elements already counted with the previous block
+                _Rewind_bytes(_First, _Block - _Tail);
+                _Result += _Bit_count(_Matcher._Match(_First) >> (_Block - _Tail) / _Lane_size<_Size>);
+            }
+
+            return _Result;
+        }
+
+        // The candidates for the start of a match, [_First1, _Last1 - (_Length2 - _Size)), span at least one block
+        template <class _Traits, size_t _Size>
+        const void* _Search_blocks(const void* _First1, const void* const _Last1, const void* const _First2,
+            const size_t _Length2) noexcept {
+            constexpr size_t _Block = _Block_size<_Size>;
+
+            unsigned char _Pattern[_Block];
+            _Fill_pattern<_Size>(_Pattern, _First2);
+            const _Block_matcher<_Traits, _Size> _Matcher(_Pattern);
+
+            const auto _Rest2 = static_cast<const unsigned char*>(_First2) + _Size;
+
+            // Checks the candidates in _Bingo against the rest of the needle
+            const auto _Verify = [&](const void* const _Block_first, uint64_t _Bingo) noexcept -> const void* {
+                for (; _Bingo != 0; _Bingo &= _Bingo - 1) {
+                    const auto _Candidate =
+                        static_cast<const unsigned char*>(_Block_first) + _Lowest_bit(_Bingo) * _Lane_size<_Size>;
+                    if (memcmp(_Candidate + _Size, _Rest2, _Length2 - _Size) == 0) {
+                        return _Candidate;
+                    }
+                }
+
+                return nullptr;
+            };
+
+            const void* _Stop1 = _Last1;
+            _Rewind_bytes(_Stop1, _Length2 - _Size);
+
+            const size_t _Tail   = _Byte_length(_First1, _Stop1) % _Block;
+            const void* _Stop_at = _Stop1;
+            _Rewind_bytes(_Stop_at, _Tail);
+
+            for (; _First1 != _Stop_at; _Advance_bytes(_First1, _Block)) {
+                if (const auto _Found = _Verify(_First1, _Matcher._Match(_First1))) {
+                    return _Found;
+                }
+            }
+
+            if (_Tail != 0) {
+                // Drop the candidates already rejected with the previous block
+                _Rewind_bytes(_First1, _Block - _Tail);
+                const size_t _Seen    = (_Block - _Tail) / _Lane_size<_Size>;
+                const uint64_t _Bingo = _Matcher._Match(_First1) & (~uint64_t{0} << _Seen);
+                if (const auto _Found = _Verify(_First1, _Bingo)) {
+                    return _Found;
+                }
+            }
+
+            return _Last1;
+        }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+
+        template <size_t _Size>
+        const void* _Find_impl(const void* _First, const void* const _Last, const void* const _Val) noexcept {
+#ifndef _M_ARM64EC
+            if (_Byte_length(_First, _Last) >= _Block_size<_Size>) {
+                if (_Use_avx2()) {
+                    _Zeroupper_on_exit _Guard; // TRANSITION, DevCom-10331414
+
+                    return _Find_blocks<_Traits_avx, _Size>(_First, _Last, _Val);
+                } else if (_Use_sse42()) {
+                    return _Find_blocks<_Traits_sse, _Size>(_First, _Last, _Val);
+                }
+            }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+
+            for (; _First != _Last; _Advance_bytes(_First, _Size)) {
+                if (memcmp(_First, _Val, _Size) == 0) {
+                    break;
+                }
+            }
+
+            return _First;
+        }
+
+        template <size_t _Size>
+        size_t _Count_impl(const void* _First, const void* const _Last, const void* const _Val) noexcept {
+#ifndef _M_ARM64EC
+            if (_Byte_length(_First, _Last) >= _Block_size<_Size>) {
+                if (_Use_avx2()) {
+                    _Zeroupper_on_exit _Guard; // TRANSITION, DevCom-10331414
+
+                    return _Count_blocks<_Traits_avx, _Size>(_First, _Last, _Val);
+                } else if (_Use_sse42()) {
+                    return _Count_blocks<_Traits_sse, _Size>(_First, _Last, _Val);
+                }
+            }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+
+            size_t _Result = 0;
+            for (; _First != _Last; _Advance_bytes(_First, _Size)) {
+                _Result += memcmp(_First, _Val, _Size) == 0;
+            }
+
+            return _Result;
+        }
+
+        template <size_t _Size>
+        const void* _Search_impl(
+            const void* _First1, const void* const _Last1, const void* const _First2, const size_t _Count2) noexcept {
+            if (_Count2 == 0) {
+                return _First1;
+            }
+
+            const size_t _Length1 = _Byte_length(_First1, _Last1);
+            const size_t _Length2 = _Count2 * _Size;
+            if (_Length2 > _Length1) {
+                return _Last1;
+            }
+
+            const void* _Stop1 = _Last1;
+            _Rewind_bytes(_Stop1, _Length2 - _Size);
+
+#ifndef _M_ARM64EC
+            if (_Byte_length(_First1, _Stop1) >= _Block_size<_Size>) {
+                if (_Use_avx2()) {
+                    _Zeroupper_on_exit _Guard; // TRANSITION, DevCom-10331414
+
+                    return _Search_blocks<_Traits_avx, _Size>(_First1, _Last1, _First2, _Length2);
+                } else if (_Use_sse42()) {
+                    return _Search_blocks<_Traits_sse, _Size>(_First1, _Last1, _First2, _Length2);
+                }
+            }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+
+            for (; _First1 != _Stop1; _Advance_bytes(_First1, _Size)) {
+                if (memcmp(_First1, _First2, _Length2) == 0) {
+                    return _First1;
+                }
+            }
+
+            return _Last1;
+        }
+    } // namespace _Fixed_stride
+} // unnamed namespace
+
+extern "C" {
+
+__declspec(noalias) size_t __stdcall __std_count_trivial_16(
+    const void* const _First, const void* const _Last, const void* const _Val) noexcept {
+    return _Fixed_stride::_Count_impl<16>(_First, _Last, _Val);
+}
+
+const void* __stdcall __std_find_trivial_16(
+    const void* const _First, const void* const _Last, const void* const _Val) noexcept {
+    return _Fixed_stride::_Find_impl<16>(_First, _Last, _Val);
+}
+
+const void* __stdcall __std_search_16(
+    const void* const _First1, const void* const _Last1, const void* const _First2, const size_t _Count2) noexcept {
+    return _Fixed_stride::_Search_impl<16>(_First1, _Last1, _First2, _Count2);
+}
+
+__declspec(noalias) size_t __stdcall __std_count_trivial_fixed_stride(
+    const void* const _First, const void* const _Last, const void* const _Val, const size_t _Size) noexcept {
+    switch (_Size) {
+    case 3:
+        return _Fixed_stride::_Count_impl<3>(_First, _Last, _Val);
+    case 6:
+        return _Fixed_stride::_Count_impl<6>(_First, _Last, _Val);
+    case 12:
+        return _Fixed_stride::_Count_impl<12>(_First, _Last, _Val);
+    case 16:
+        return _Fixed_stride::_Count_impl<16>(_First, _Last, _Val);
+    case 24:
+        return _Fixed_stride::_Count_impl<24>(_First, _Last, _Val);
+    case 32:
+        return _Fixed_stride::_Count_impl<32>(_First, _Last, _Val);
+    case 48:
+        return _Fixed_stride::_Count_impl<48>(_First, _Last, _Val);
+    case 64:
+        return _Fixed_stride::_Count_impl<64>(_First, _Last, _Val);
+    }
+
+    _STL_UNREACHABLE;
+}
+
+const void* __stdcall __std_find_trivial_fixed_stride(
+    const void* const _First, const void* const _Last, const void* const _Val, const size_t _Size) noexcept {
+    switch (_Size) {
+    case 3:
+        return _Fixed_stride::_Find_impl<3>(_First, _Last, _Val);
+    case 6:
+        return _Fixed_stride::_Find_impl<6>(_First, _Last, _Val);
+    case 12:
+        return _Fixed_stride::_Find_impl<12>(_First, _Last, _Val);
+    case 16:
+        return _Fixed_stride::_Find_impl<16>(_First, _Last, _Val);
+    case 24:
+        return _Fixed_stride::_Find_impl<24>(_First, _Last, _Val);
+    case 32:
+        return _Fixed_stride::_Find_impl<32>(_First, _Last, _Val);
+    case 48:
+        return _Fixed_stride::_Find_impl<48>(_First, _Last, _Val);
+    case 64:
+        return _Fixed_stride::_Find_impl<64>(_First, _Last, _Val);
+    }
+
+    _STL_UNREACHABLE;
 }
 
-const void* __stdcall __std_find_end_8(
-    const void* const _First1, const void* const _Last1, const void* const _First2, const size_t _Count2) noexcept {
-#if defined(_M_ARM64) || defined(_M_ARM64EC)
-    return _Find_seq::_Find_end_impl<_Finding::_Find_traits_8, _Find_seq::_Find_seq_traits_neon_8, uint64_t>(
-        _First1, _Last1, _First2, _Count2);
-#else // ^^^ defined(_M_ARM64) || defined(_M_ARM64EC) / !defined(_M_ARM64) && !defined(_M_ARM64EC) vvv
-    return _Find_seq::_Find_end_impl<_Finding::_Find_traits_8, _Find_seq::_Find_seq_traits_avx_8,
-        _Find_seq::_Find_seq_traits_sse_8, uint64_t>(_First1, _Last1, _First2, _Count2);
-#endif // ^^^ !defined(_M_ARM64) && !defined(_M_ARM64EC) ^^^
+const void* __stdcall __std_search_fixed_stride(const void* const _First1, const void* const _Last1,
+    const void* const _First2, const size_t _Count2, const size_t _Size) noexcept {
+    switch (_Size) {
+    case 3:
+        return _Fixed_stride::_Search_impl<3>(_First1, _Last1, _First2, _Count2);
+    case 6:
+        return _Fixed_stride::_Search_impl<6>(_First1, _Last1, _First2, _Count2);
+    case 12:
+        return _Fixed_stride::_Search_impl<12>(_First1, _Last1, _First2, _Count2);
+    case 16:
+        return _Fixed_stride::_Search_impl<16>(_First1, _Last1, _First2, _Count2);
+    case 24:
+        return _Fixed_stride::_Search_impl<24>(_First1, _Last1, _First2, _Count2);
+    case 32:
+        return _Fixed_stride::_Search_impl<32>(_First1, _Last1, _First2, _Count2);
+    case 48:
+        return _Fixed_stride::_Search_impl<48>(_First1, _Last1, _First2, _Count2);
+    case 64:
+        return _Fixed_stride::_Search_impl<64>(_First1, _Last1, _First2, _Count2);
+    }
+
+    _STL_UNREACHABLE;
 }
 
 } // extern "C"
+#endif // ^^^ !defined(_M_ARM64) ^^^
 
 namespace {
     namespace _Mismatching {
@@ -9510,6 +13597,37 @@ namespace {
             const auto _First1_ch = static_cast<const char*>(_First1);
             const auto _First2_ch = static_cast<const char*>(_First2);
 
+#ifdef _WIN64
+            if (_Use_avx512()) {
+                _Zeroupper_on_exit _Guard; // TRANSITION, DevCom-10331414
+
+                const size_t _Count_bytes             = _Count * sizeof(_Ty);
+                const size_t _Count_bytes_avx512_full = _Count_bytes & ~size_t{0x3F};
+
+                for (; _Result != _Count_bytes_avx512_full; _Result += 0x40) {
+                    const __m512i _Elem1  = _mm512_loadu_si512(_First1_ch + _Result);
+                    const __m512i _Elem2  = _mm512_loadu_si512(_First2_ch + _Result);
+                    const uint64_t _Bingo = _mm512_cmpneq_epi8_mask(_Elem1, _Elem2);
+                    if (_Bingo != 0) {
+                        return (_Result + _tzcnt_u64(_Bingo)) / sizeof(_Ty);
+                    }
+                }
+
+                // Compare the tail bytewise under a mask; the result is always within the range.
+                if (const size_t _Count_tail = _Count_bytes & size_t{0x3F}; _Count_tail != 0) {
+                    const __mmask64 _Tail_mask = _Avx512_tail_mask(_Count_tail);
+                    const __m512i _Elem1       = _mm512_maskz_loadu_epi8(_Tail_mask, _First1_ch + _Result);
+                    const __m512i _Elem2       = _mm512_maskz_loadu_epi8(_Tail_mask, _First2_ch + _Result);
+                    const uint64_t _Bingo      = _mm512_mask_cmpneq_epi8_mask(_Tail_mask, _Elem1, _Elem2);
+                    if (_Bingo != 0) {
+                        return (_Result + _tzcnt_u64(_Bingo)) / sizeof(_Ty);
+                    }
+                }
+
+                return _Count;
+            }
+#endif // ^^^ defined(_WIN64) ^^^
+
             if (_Use_avx2()) {
                 _Zeroupper_on_exit _Guard; // TRANSITION, DevCom-10331414
 
@@ -10207,6 +14325,83 @@ namespace {
                 return _Out;
             }
         };
+
+#ifdef _WIN64
+        // AVX-512 compresses with vpcompressd/vpcompressq instead of table-driven shuffles.
+        // (Compressing 8-bit and 16-bit elements would need AVX512_VBMI2, which isn't part of this tier.)
+        //
+        // _Store_masked compresses into a register and stores the whole vector: a compressing store to memory is
+        // microcoded on some implementations. Lanes past the kept elements take the source lanes at the same
+        // positions, like the lookup tables above, which 'unique' relies on for its overlapping loads.
+        // _Store_masked_tail is used once per call, so it stores exactly the kept elements.
+        struct _Avx512_4 {
+            static constexpr size_t _Elem_size = 4;
+            static constexpr size_t _Step      = 64;
+
+            static __m512i _Set(const uint32_t _Val) noexcept {
+                return _mm512_set1_epi32(static_cast<int>(_Val));
+            }
+
+            static __m512i _Load(const void* const _Ptr) noexcept {
+                return _mm512_loadu_si512(_Ptr);
+            }
+
+            static __m512i _Load_tail(const void* const _Ptr, const uint32_t _Tail) noexcept {
+                return _mm512_maskz_loadu_epi32(static_cast<__mmask16>(_Tail), _Ptr);
+            }
+
+            static uint32_t _Mask(const __m512i _First, const __m512i _Second) noexcept {
+                return _mm512_cmpeq_epi32_mask(_First, _Second);
+            }
+
+            static void* _Store_masked(void* _Out, const __m512i _Src, const uint32_t _Bingo) noexcept {
+                const auto _Keep = static_cast<__mmask16>(~_Bingo);
+                _mm512_storeu_si512(_Out, _mm512_mask_compress_epi32(_Src, _Keep, _Src));
+                _Advance_bytes(_Out, __popcnt(_Keep) * _Elem_size);
+                return _Out;
+            }
+
+            static void* _Store_masked_tail(void* _Out, const __m512i _Src, const uint32_t _Keep) noexcept {
+                _mm512_mask_compressstoreu_epi32(_Out, static_cast<__mmask16>(_Keep), _Src);
+                _Advance_bytes(_Out, __popcnt(_Keep) * _Elem_size);
+                return _Out;
+            }
+        };
+
+        struct _Avx512_8 {
+            static constexpr size_t _Elem_size = 8;
+            static constexpr size_t _Step      = 64;
+
+            static __m512i _Set(const uint64_t _Val) noexcept {
+                return _mm512_set1_epi64(static_cast<long long>(_Val));
+            }
+
+            static __m512i _Load(const void* const _Ptr) noexcept {
+                return _mm512_loadu_si512(_Ptr);
+            }
+
+            static __m512i _Load_tail(const void* const _Ptr, const uint32_t _Tail) noexcept {
+                return _mm512_maskz_loadu_epi64(static_cast<__mmask8>(_Tail), _Ptr);
+            }
+
+            static uint32_t _Mask(const __m512i _First, const __m512i _Second) noexcept {
+                return _mm512_cmpeq_epi64_mask(_First, _Second);
+            }
+
+            static void* _Store_masked(void* _Out, const __m512i _Src, const uint32_t _Bingo) noexcept {
+                const auto _Keep = static_cast<__mmask8>(~_Bingo);
+                _mm512_storeu_si512(_Out, _mm512_mask_compress_epi64(_Src, _Keep, _Src));
+                _Advance_bytes(_Out, __popcnt(_Keep) * _Elem_size);
+                return _Out;
+            }
+
+            static void* _Store_masked_tail(void* _Out, const __m512i _Src, const uint32_t _Keep) noexcept {
+                _mm512_mask_compressstoreu_epi64(_Out, static_cast<__mmask8>(_Keep), _Src);
+                _Advance_bytes(_Out, __popcnt(_Keep) * _Elem_size);
+                return _Out;
+            }
+        };
+#endif // ^^^ defined(_WIN64) ^^^
 #endif // ^^^ !defined(_M_ARM64) && !defined(_M_ARM64EC) ^^^
 
         constexpr size_t _Copy_buffer_size = 512;
@@ -10300,6 +14495,42 @@ namespace {
             _Advance_bytes(_Out, _Fill);
             return _Out;
         }
+
+#if !defined(_M_ARM64) && !defined(_M_ARM64EC) && defined(_WIN64)
+        // Masked replacements for _Remove_fallback and _Unique_fallback; _First to _Last must be less than a vector.
+        template <class _Traits, class _Ty>
+        void* _Remove_tail_avx512(
+            const void* const _First, const void* const _Last, void* _Out, const _Ty _Val) noexcept {
+            const size_t _Tail_count = _Byte_length(_First, _Last) / sizeof(_Ty);
+            if (_Tail_count != 0) {
+                const auto _Tail      = static_cast<uint32_t>(_Avx512_tail_mask(_Tail_count));
+                const auto _Src       = _Traits::_Load_tail(_First, _Tail);
+                const uint32_t _Bingo = _Traits::_Mask(_Src, _Traits::_Set(_Val));
+                _Out                  = _Traits::_Store_masked_tail(_Out, _Src, ~_Bingo & _Tail);
+            }
+
+            return _Out;
+        }
+
+        template <class _Traits>
+        void* _Unique_tail_avx512(const void* const _First, const void* const _Last, void* _Dest) noexcept {
+            // _Dest points to the last element kept so far, as in _Unique_fallback.
+            _Advance_bytes(_Dest, _Traits::_Elem_size);
+
+            const size_t _Tail_count = _Byte_length(_First, _Last) / _Traits::_Elem_size;
+            if (_Tail_count != 0) {
+                const auto _Tail     = static_cast<uint32_t>(_Avx512_tail_mask(_Tail_count));
+                const void* _First_d = _First;
+                _Rewind_bytes(_First_d, _Traits::_Elem_size);
+                const auto _Src       = _Traits::_Load_tail(_First, _Tail);
+                const auto _Match     = _Traits::_Load_tail(_First_d, _Tail);
+                const uint32_t _Bingo = _Traits::_Mask(_Src, _Match);
+                _Dest                 = _Traits::_Store_masked_tail(_Dest, _Src, ~_Bingo & _Tail);
+            }
+
+            return _Dest;
+        }
+#endif // ^^^ !defined(_M_ARM64) && !defined(_M_ARM64EC) && defined(_WIN64) ^^^
     } // namespace _Removing
 } // unnamed namespace
 
@@ -10360,6 +14591,18 @@ void* __stdcall __std_remove_4(void* _First, void* const _Last, const uint32_t _
         _First = _Stop;
     }
 #else // ^^^ defined(_M_ARM64) || defined(_M_ARM64EC) / !defined(_M_ARM64) && !defined(_M_ARM64EC) vvv
+#ifdef _WIN64
+    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_avx512() && _Size_bytes >= 64) {
+        void* _Stop = _First;
+        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0x3F});
+        _Out = _Removing::_Remove_impl<_Removing::_Avx512_4>(_First, _Stop, _Val);
+        _Out = _Removing::_Remove_tail_avx512<_Removing::_Avx512_4>(_Stop, _Last, _Out, _Val);
+
+        _mm256_zeroupper(); // TRANSITION, DevCom-10331414
+        return _Out;
+    }
+#endif // ^^^ defined(_WIN64) ^^^
+
     if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_avx2() && _Size_bytes >= 32) {
         void* _Stop = _First;
         _Advance_bytes(_Stop, _Size_bytes & ~size_t{0x1F});
@@ -10382,6 +14625,18 @@ void* __stdcall __std_remove_8(void* _First, void* const _Last, const uint64_t _
     void* _Out = _First;
 
 #if !defined(_M_ARM64) && !defined(_M_ARM64EC)
+#ifdef _WIN64
+    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_avx512() && _Size_bytes >= 64) {
+        void* _Stop = _First;
+        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0x3F});
+        _Out = _Removing::_Remove_impl<_Removing::_Avx512_8>(_First, _Stop, _Val);
+        _Out = _Removing::_Remove_tail_avx512<_Removing::_Avx512_8>(_Stop, _Last, _Out, _Val);
+
+        _mm256_zeroupper(); // TRANSITION, DevCom-10331414
+        return _Out;
+    }
+#endif // ^^^ defined(_WIN64) ^^^
+
     if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_avx2() && _Size_bytes >= 32) {
         void* _Stop = _First;
         _Advance_bytes(_Stop, _Size_bytes & ~size_t{0x1F});
@@ -10447,6 +14702,18 @@ void* __stdcall __std_remove_copy_4(
 // We choose not to vectorize remove_copy for 32-bit elements on ARM64/ARM64EC
 // as this does not improve performance over the scalar code.
 #if !defined(_M_ARM64) && !defined(_M_ARM64EC)
+#ifdef _WIN64
+    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_avx512() && _Size_bytes >= 64) {
+        const void* _Stop = _First;
+        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0x3F});
+        _Out = _Removing::_Remove_copy_impl<_Removing::_Avx512_4>(_First, _Stop, _Out, _Val);
+        _Out = _Removing::_Remove_tail_avx512<_Removing::_Avx512_4>(_Stop, _Last, _Out, _Val);
+
+        _mm256_zeroupper(); // TRANSITION, DevCom-10331414
+        return _Out;
+    }
+#endif // ^^^ defined(_WIN64) ^^^
+
     if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_avx2() && _Size_bytes >= 32) {
         const void* _Stop = _First;
         _Advance_bytes(_Stop, _Size_bytes & ~size_t{0x1F});
@@ -10468,6 +14735,18 @@ void* __stdcall __std_remove_copy_4(
 void* __stdcall __std_remove_copy_8(
     const void* _First, const void* const _Last, void* _Out, const uint64_t _Val) noexcept {
 #if !defined(_M_ARM64) && !defined(_M_ARM64EC)
+#ifdef _WIN64
+    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_avx512() && _Size_bytes >= 64) {
+        const void* _Stop = _First;
+        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0x3F});
+        _Out = _Removing::_Remove_copy_impl<_Removing::_Avx512_8>(_First, _Stop, _Out, _Val);
+        _Out = _Removing::_Remove_tail_avx512<_Removing::_Avx512_8>(_Stop, _Last, _Out, _Val);
+
+        _mm256_zeroupper(); // TRANSITION, DevCom-10331414
+        return _Out;
+    }
+#endif // ^^^ defined(_WIN64) ^^^
+
     if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_avx2() && _Size_bytes >= 32) {
         const void* _Stop = _First;
         _Advance_bytes(_Stop, _Size_bytes & ~size_t{0x1F});
@@ -10562,6 +14841,18 @@ void* __stdcall __std_unique_4(void* _First, void* const _Last) noexcept {
         _First = _Stop;
     }
 #else // ^^^ defined(_M_ARM64) || defined(_M_ARM64EC) / !defined(_M_ARM64) && !defined(_M_ARM64EC) vvv
+#ifdef _WIN64
+    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_avx512() && _Size_bytes >= 64) {
+        void* _Stop = _First;
+        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0x3F});
+        _Dest = _Removing::_Unique_impl<_Removing::_Avx512_4>(_First, _Stop);
+        _Dest = _Removing::_Unique_tail_avx512<_Removing::_Avx512_4>(_Stop, _Last, _Dest);
+
+        _mm256_zeroupper(); // TRANSITION, DevCom-10331414
+        return _Dest;
+    }
+#endif // ^^^ defined(_WIN64) ^^^
+
     if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_avx2() && _Size_bytes >= 32) {
         void* _Stop = _First;
         _Advance_bytes(_Stop, _Size_bytes & ~size_t{0x1F});
@@ -10591,6 +14882,18 @@ void* __stdcall __std_unique_8(void* _First, void* const _Last) noexcept {
     _Advance_bytes(_First, 8);
 
 #if !defined(_M_ARM64) && !defined(_M_ARM64EC)
+#ifdef _WIN64
+    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_avx512() && _Size_bytes >= 64) {
+        void* _Stop = _First;
+        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0x3F});
+        _Dest = _Removing::_Unique_impl<_Removing::_Avx512_8>(_First, _Stop);
+        _Dest = _Removing::_Unique_tail_avx512<_Removing::_Avx512_8>(_Stop, _Last, _Dest);
+
+        _mm256_zeroupper(); // TRANSITION, DevCom-10331414
+        return _Dest;
+    }
+#endif // ^^^ defined(_WIN64) ^^^
+
     if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_avx2() && _Size_bytes >= 32) {
         void* _Stop = _First;
         _Advance_bytes(_Stop, _Size_bytes & ~size_t{0x1F});
@@ -10679,6 +14982,18 @@ void* __stdcall __std_unique_copy_4(const void* _First, const void* const _Last,
         _First = _Stop;
     }
 #else // ^^^ defined(_M_ARM64) || defined(_M_ARM64EC) / !defined(_M_ARM64) && !defined(_M_ARM64EC) vvv
+#ifdef _WIN64
+    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_avx512() && _Size_bytes >= 64) {
+        const void* _Stop = _First;
+        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0x3F});
+        _Dest = _Removing::_Unique_copy_impl<_Removing::_Avx512_4>(_First, _Stop, _Dest);
+        _Dest = _Removing::_Unique_tail_avx512<_Removing::_Avx512_4>(_Stop, _Last, _Dest);
+
+        _mm256_zeroupper(); // TRANSITION, DevCom-10331414
+        return _Dest;
+    }
+#endif // ^^^ defined(_WIN64) ^^^
+
     if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_avx2() && _Size_bytes >= 32) {
         const void* _Stop = _First;
         _Advance_bytes(_Stop, _Size_bytes & ~size_t{0x1F});
@@ -10706,6 +15021,18 @@ void* __stdcall __std_unique_copy_8(const void* _First, const void* const _Last,
     _Advance_bytes(_First, 8);
 
 #if !defined(_M_ARM64) && !defined(_M_ARM64EC)
+#ifdef _WIN64
+    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_avx512() && _Size_bytes >= 64) {
+        const void* _Stop = _First;
+        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0x3F});
+        _Dest = _Removing::_Unique_copy_impl<_Removing::_Avx512_8>(_First, _Stop, _Dest);
+        _Dest = _Removing::_Unique_tail_avx512<_Removing::_Avx512_8>(_Stop, _Last, _Dest);
+
+        _mm256_zeroupper(); // TRANSITION, DevCom-10331414
+        return _Dest;
+    }
+#endif // ^^^ defined(_WIN64) ^^^
+
     if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_avx2() && _Size_bytes >= 32) {
         const void* _Stop = _First;
         _Advance_bytes(_Stop, _Size_bytes & ~size_t{0x1F});
@@ -11844,3 +16171,314 @@ __declspec(noalias) bool __stdcall __std_bitset_from_string_2(void* const _Dest,
 }
 
 } // extern "C"
+
+namespace {
+    namespace _String_hash {
+        // The layout follows XXH3. Keys up to 128 bytes are mixed with a few 64x64->128-bit multiplications.
+        // Longer keys are accumulated 64 bytes at a time into eight 64-bit lanes: each lane adds the product of
+        // the 32-bit halves of a data word XOR a key word, and its neighbor adds the data word itself.
+        // That only needs 32x32->64-bit multiplications, so every instruction set computes the same value.
+
+        constexpr size_t _Stripe_size       = 64;
+        constexpr size_t _Stripes_per_block = 8;
+        constexpr size_t _Block_size        = _Stripe_size * _Stripes_per_block;
+
+        // Byte offsets into _Secret of the keys used by the long hash
+        constexpr size_t _Scramble_key_offset    = 128;
+        constexpr size_t _Last_stripe_key_offset = 71;
+
+        constexpr uint64_t _Prime32_1 = 0x9E37'79B1U;
+        constexpr uint64_t _Prime32_2 = 0x85EB'CA77U;
+        constexpr uint64_t _Prime32_3 = 0xC2B2'AE3DU;
+        constexpr uint64_t _Prime64_1 = 0x9E37'79B1'85EB'CA87ULL;
+        constexpr uint64_t _Prime64_2 = 0xC2B2'AE3D'27D4'EB4FULL;
+        constexpr uint64_t _Prime64_3 = 0x1656'67B1'9E37'79F9ULL;
+        constexpr uint64_t _Prime64_4 = 0x85EB'CA77'C2B2'AE63ULL;
+        constexpr uint64_t _Prime64_5 = 0x27D4'EB2F'1656'67C5ULL;
+
+        alignas(64) constexpr uint64_t _Secret[24] = {
+            0xBA8894FA3BE59747ULL, 0x069945DEA82460DAULL, 0xF2B5717DB02809EAULL, 0x4604208F575A097AULL,
+            0x9B2AF0A33458F9D3ULL, 0x0036C74E48FED613ULL, 0x250924992B7B8FB9ULL, 0x11C2DD5402147E8BULL,
+            0xA150217AA00CE50FULL, 0x1B08078CDCA13467ULL, 0x0BA8D4827C1AC113ULL, 0x10F3FF5B71BB3208ULL,
+            0x378AE3C511F071F3ULL, 0x2EDC5BBC191F9C16ULL, 0x8F4870D0D2FFEACAULL, 0x0BDFE62B0DAD52F6ULL,
+            0x81B330EB8EB7F693ULL, 0xDE7C4E8EB1D4EC36ULL, 0x5A3A88DD3D4CE484ULL, 0xAC4EE57BBF8F82B3ULL,
+            0x8AA01872AAA66025ULL, 0xF994DEDE4FF35E16ULL, 0xE9E99704ACC43221ULL, 0xF77540E67C5CE006ULL,
+        };
+
+        const unsigned char* _Secret_bytes() noexcept {
+            return reinterpret_cast<const unsigned char*>(_Secret);
+        }
+
+        uint64_t _Read64(const unsigned char* const _Ptr) noexcept {
+            uint64_t _Val;
+            memcpy(&_Val, _Ptr, sizeof(_Val));
+            return _Val;
+        }
+
+        uint32_t _Read32(const unsigned char* const _Ptr) noexcept {
+            uint32_t _Val;
+            memcpy(&_Val, _Ptr, sizeof(_Val));
+            return _Val;
+        }
+
+        uint64_t _Mul_fold(const uint64_t _Left, const uint64_t _Right) noexcept {
+            uint64_t _High;
+            const uint64_t _Low = _STD _Base128::_UMul128(_Left, _Right, _High);
+            return _Low ^ _High;
+        }
+
+        uint64_t _Avalanche(uint64_t _Val) noexcept {
+            _Val ^= _Val >> 37;
+            _Val *= _Prime64_3;
+            _Val ^= _Val >> 32;
+            return _Val;
+        }
+
+        uint64_t _Hash_short(const unsigned char* const _First, const size_t _Count) noexcept {
+            if (_Count > 8) {
+                const uint64_t _Low  = _Read64(_First) ^ _Secret[0];
+                const uint64_t _High = _Read64(_First + _Count - 8) ^ _Secret[1];
+                const uint64_t _Swap = (_Low << 32) | (_Low >> 32);
+                return _Avalanche(_Count + _Swap + _High + _Mul_fold(_Low, _High));
+            }
+
+            if (_Count >= 4) {
+                const uint64_t _Low  = _Read32(_First);
+                const uint64_t _High = _Read32(_First + _Count - 4);
+                return _Avalanche(_Mul_fold(((_Low << 32) | _High) ^ _Secret[2], _Count ^ _Secret[3]));
+            }
+
+            if (_Count != 0) {
+                const uint64_t _Combined = (uint64_t{_First[0]} << 16) | (uint64_t{_First[_Count >> 1]} << 24)
+                                         | uint64_t{_First[_Count - 1]} | (uint64_t{_Count} << 8);
+                return _Avalanche(_Mul_fold(_Combined ^ _Secret[4], _Secret[5]));
+            }
+
+            return _Avalanche(_Secret[6] ^ _Secret[7]);
+        }
+
+        uint64_t _Mix_16(const unsigned char* const _Ptr, const size_t _Key_index) noexcept {
+            return _Mul_fold(_Read64(_Ptr) ^ _Secret[_Key_index], _Read64(_Ptr + 8) ^ _Secret[_Key_index + 1]);
+        }
+
+        uint64_t _Hash_medium(const unsigned char* const _First, const size_t _Count) noexcept {
+            // 17 to 128 bytes: 16-byte chunks taken in pairs from both ends, overlapping in the middle
+            uint64_t _Acc       = _Count * _Prime64_1;
+            const size_t _Pairs = (_Count + 31) / 32;
+            for (size_t _Ix = 0; _Ix != _Pairs; ++_Ix) {
+                _Acc += _Mix_16(_First + 16 * _Ix, 4 * _Ix);
+                _Acc += _Mix_16(_First + _Count - 16 * (_Ix + 1), 4 * _Ix + 2);
+            }
+
+            return _Avalanche(_Acc);
+        }
+
+        struct _Traits_scalar {
+            struct _Acc_t {
+                uint64_t _Lane[8];
+            };
+
+            static _Acc_t _Load(const uint64_t* const _Src) noexcept {
+                _Acc_t _Acc;
+                memcpy(_Acc._Lane, _Src, sizeof(_Acc._Lane));
+                return _Acc;
+            }
+
+            static void _Store(uint64_t* const _Dest, const _Acc_t& _Acc) noexcept {
+                memcpy(_Dest, _Acc._Lane, sizeof(_Acc._Lane));
+            }
+
+            static void _Accumulate(
+                _Acc_t& _Acc, const unsigned char* const _Data, const unsigned char* const _Key) noexcept {
+                for (size_t _Ix = 0; _Ix != 8; ++_Ix) {
+                    const uint64_t _Val   = _Read64(_Data + 8 * _Ix);
+                    const uint64_t _Mixed = _Val ^ _Read64(_Key + 8 * _Ix);
+                    _Acc._Lane[_Ix ^ 1] += _Val;
+                    _Acc._Lane[_Ix] += (_Mixed & 0xFFFF'FFFFU) * (_Mixed >> 32);
+                }
+            }
+
+            static void _Scramble(_Acc_t& _Acc, const unsigned char* const _Key) noexcept {
+                for (size_t _Ix = 0; _Ix != 8; ++_Ix) {
+                    uint64_t _Val = _Acc._Lane[_Ix];
+                    _Val ^= _Val >> 47;
+                    _Val ^= _Read64(_Key + 8 * _Ix);
+                    _Acc._Lane[_Ix] = _Val * _Prime32_1;
+                }
+            }
+        };
+
+#if !defined(_M_ARM64) && !defined(_M_ARM64EC)
+        struct _Traits_sse {
+            struct _Acc_t {
+                __m128i _Lane[4];
+            };
+
+            static _Acc_t _Load(const uint64_t* const _Src) noexcept {
+                _Acc_t _Acc;
+                for (size_t _Ix = 0; _Ix != 4; ++_Ix) {
+                    _Acc._Lane[_Ix] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Src) + _Ix);
+                }
+
+                return _Acc;
+            }
+
+            static void _Store(uint64_t* const _Dest, const _Acc_t& _Acc) noexcept {
+                for (size_t _Ix = 0; _Ix != 4; ++_Ix) {
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(_Dest) + _Ix, _Acc._Lane[_Ix]);
+                }
+            }
+
+            static void _Accumulate(
+                _Acc_t& _Acc, const unsigned char* const _Data, const unsigned char* const _Key) noexcept {
+                for (size_t _Ix = 0; _Ix != 4; ++_Ix) {
+                    const __m128i _Val = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Data) + _Ix);
+                    const __m128i _Mixed =
+                        _mm_xor_si128(_Val, _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Key) + _Ix));
+                    const __m128i _Product = _mm_mul_epu32(_Mixed, _mm_shuffle_epi32(_Mixed, _MM_SHUFFLE(3, 3, 1, 1)));
+                    const __m128i _Swapped = _mm_shuffle_epi32(_Val, _MM_SHUFFLE(1, 0, 3, 2));
+                    _Acc._Lane[_Ix]        = _mm_add_epi64(_Acc._Lane[_Ix], _mm_add_epi64(_Product, _Swapped));
+                }
+            }
+
+            static void _Scramble(_Acc_t& _Acc, const unsigned char* const _Key) noexcept {
+                const __m128i _Prime = _mm_set1_epi32(static_cast<int>(_Prime32_1));
+                for (size_t _Ix = 0; _Ix != 4; ++_Ix) {
+                    const __m128i _Key_val = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Key) + _Ix);
+                    __m128i _Val           = _Acc._Lane[_Ix];
+                    _Val                   = _mm_xor_si128(_Val, _mm_srli_epi64(_Val, 47));
+                    _Val                   = _mm_xor_si128(_Val, _Key_val);
+                    const __m128i _Low     = _mm_mul_epu32(_Val, _Prime);
+                    const __m128i _High    = _mm_mul_epu32(_mm_srli_epi64(_Val, 32), _Prime);
+                    _Acc._Lane[_Ix]        = _mm_add_epi64(_Low, _mm_slli_epi64(_High, 32));
+                }
+            }
+        };
+
+        struct _Traits_avx {
+            struct _Acc_t {
+                __m256i _Lane[2];
+            };
+
+            static _Acc_t _Load(const uint64_t* const _Src) noexcept {
+                _Acc_t _Acc;
+                for (size_t _Ix = 0; _Ix != 2; ++_Ix) {
+                    _Acc._Lane[_Ix] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Src) + _Ix);
+                }
+
+                return _Acc;
+            }
+
+            static void _Store(uint64_t* const _Dest, const _Acc_t& _Acc) noexcept {
+                for (size_t _Ix = 0; _Ix != 2; ++_Ix) {
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Dest) + _Ix, _Acc._Lane[_Ix]);
+                }
+            }
+
+            static void _Accumulate(
+                _Acc_t& _Acc, const unsigned char* const _Data, const unsigned char* const _Key) noexcept {
+                for (size_t _Ix = 0; _Ix != 2; ++_Ix) {
+                    const __m256i _Val = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Data) + _Ix);
+                    const __m256i _Mixed =
+                        _mm256_xor_si256(_Val, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Key) + _Ix));
+                    const __m256i _Product =
+                        _mm256_mul_epu32(_Mixed, _mm256_shuffle_epi32(_Mixed, _MM_SHUFFLE(3, 3, 1, 1)));
+                    const __m256i _Swapped = _mm256_shuffle_epi32(_Val, _MM_SHUFFLE(1, 0, 3, 2));
+                    _Acc._Lane[_Ix]        = _mm256_add_epi64(_Acc._Lane[_Ix], _mm256_add_epi64(_Product, _Swapped));
+                }
+            }
+
+            static void _Scramble(_Acc_t& _Acc, const unsigned char* const _Key) noexcept {
+                const __m256i _Prime = _mm256_set1_epi32(static_cast<int>(_Prime32_1));
+                for (size_t _Ix = 0; _Ix != 2; ++_Ix) {
+                    const __m256i _Key_val = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Key) + _Ix);
+                    __m256i _Val           = _Acc._Lane[_Ix];
+                    _Val                   = _mm256_xor_si256(_Val, _mm256_srli_epi64(_Val, 47));
+                    _Val                   = _mm256_xor_si256(_Val, _Key_val);
+                    const __m256i _Low     = _mm256_mul_epu32(_Val, _Prime);
+                    const __m256i _High    = _mm256_mul_epu32(_mm256_srli_epi64(_Val, 32), _Prime);
+                    _Acc._Lane[_Ix]        = _mm256_add_epi64(_Low, _mm256_slli_epi64(_High, 32));
+                }
+            }
+        };
+#endif // ^^^ !defined(_M_ARM64) && !defined(_M_ARM64EC) ^^^
+
+        template <class _Traits>
+        uint64_t _Hash_long(const unsigned char* const _First, const size_t _Count) noexcept {
+            // More than 128 bytes
+            uint64_t _Lanes[8] = {
+                _Prime32_3, _Prime64_1, _Prime64_2, _Prime64_3, _Prime64_4, _Prime32_2, _Prime64_5, _Prime32_1};
+
+            const auto _Key = _Secret_bytes();
+            auto _Acc       = _Traits::_Load(_Lanes);
+            auto _Data      = _First;
+
+            // The last stripe is always handled separately below, even when _Count is a multiple of the block size
+            const size_t _Blocks = (_Count - 1) / _Block_size;
+            for (size_t _Block = 0; _Block != _Blocks; ++_Block) {
+                for (size_t _Stripe = 0; _Stripe != _Stripes_per_block; ++_Stripe) {
+                    _Traits::_Accumulate(_Acc, _Data, _Key + 8 * _Stripe);
+                    _Data += _Stripe_size;
+                }
+
+                _Traits::_Scramble(_Acc, _Key + _Scramble_key_offset);
+            }
+
+            const size_t _Stripes = (_Count - 1 - _Blocks * _Block_size) / _Stripe_size;
+            for (size_t _Stripe = 0; _Stripe != _Stripes; ++_Stripe) {
+                _Traits::_Accumulate(_Acc, _Data, _Key + 8 * _Stripe);
+                _Data += _Stripe_size;
+            }
+
+            // The last stripe may overlap the previous one
+            _Traits::_Accumulate(_Acc, _First + _Count - _Stripe_size, _Key + _Last_stripe_key_offset);
+
+            _Traits::_Store(_Lanes, _Acc);
+
+            uint64_t _Result = _Count * _Prime64_1;
+            for (size_t _Ix = 0; _Ix != 8; _Ix += 2) {
+                _Result += _Mul_fold(_Lanes[_Ix] ^ _Secret[12 + _Ix], _Lanes[_Ix + 1] ^ _Secret[13 + _Ix]);
+            }
+
+            return _Avalanche(_Result);
+        }
+
+        uint64_t _Hash_long_dispatch(const unsigned char* const _First, const size_t _Count) noexcept {
+#if !defined(_M_ARM64) && !defined(_M_ARM64EC)
+            if (_Use_avx2()) {
+                _Zeroupper_on_exit _Guard; // TRANSITION, DevCom-10331414
+                return _Hash_long<_Traits_avx>(_First, _Count);
+            }
+
+            return _Hash_long<_Traits_sse>(_First, _Count);
+#else // ^^^ !defined(_M_ARM64) && !defined(_M_ARM64EC) / defined(_M_ARM64) || defined(_M_ARM64EC) vvv
+            return _Hash_long<_Traits_scalar>(_First, _Count);
+#endif // ^^^ defined(_M_ARM64) || defined(_M_ARM64EC) ^^^
+        }
+    } // namespace _String_hash
+} // unnamed namespace
+
+extern "C" {
+
+__declspec(noalias) size_t __stdcall __std_hash_bytes(const void* const _First, const size_t _Count) noexcept {
+    using namespace _String_hash;
+
+    const auto _Ptr = static_cast<const unsigned char*>(_First);
+
+    uint64_t _Result;
+    if (_Count <= 16) {
+        _Result = _Hash_short(_Ptr, _Count);
+    } else if (_Count <= 128) {
+        _Result = _Hash_medium(_Ptr, _Count);
+    } else {
+        _Result = _Hash_long_dispatch(_Ptr, _Count);
+    }
+
+#ifdef _WIN64
+    return _Result;
+#else // ^^^ 64-bit / 32-bit vvv
+    return static_cast<size_t>(_Result ^ (_Result >> 32));
+#endif // ^^^ 32-bit ^^^
+}
+
+} // extern "C"
@@ -0,0 +1,50 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#if _HAS_CXX20
+#include <ranges>
+#endif // _HAS_CXX20
+
+template <class FwdIt, class T>
+FwdIt last_known_good_lower_bound(FwdIt first, const FwdIt last, const T& val) {
+    for (; first != last && std::less<>{}(*first, val); ++first) {
+    }
+
+    return first;
+}
+
+template <class FwdIt, class T>
+FwdIt last_known_good_upper_bound(FwdIt first, const FwdIt last, const T& val) {
+    for (; first != last && !std::less<>{}(val, *first); ++first) {
+    }
+
+    return first;
+}
+
+template <class T, class U>
+void test_case_binary_search(const std::vector<T>& input, const U val) {
+    const auto expected_lower = last_known_good_lower_bound(input.begin(), input.end(), val);
+    const auto expected_upper = last_known_good_upper_bound(expected_lower, input.end(), val);
+    const bool expected_found = expected_lower != expected_upper;
+
+    assert(std::lower_bound(input.begin(), input.end(), val) == expected_lower);
+    assert(std::upper_bound(input.begin(), input.end(), val) == expected_upper);
+    assert(std::equal_range(input.begin(), input.end(), val) == std::make_pair(expected_lower, expected_upper));
+    assert(std::binary_search(input.begin(), input.end(), val) == expected_found);
+
+#if _HAS_CXX20
+    assert(std::ranges::lower_bound(input, val) == expected_lower);
+    assert(std::ranges::upper_bound(input, val) == expected_upper);
+    const auto range = std::ranges::equal_range(input, val);
+    assert(range.begin() == expected_lower && range.end() == expected_upper);
+    assert(std::ranges::binary_search(input, val) == expected_found);
+#endif // _HAS_CXX20
+}
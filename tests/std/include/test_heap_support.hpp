@@ -0,0 +1,88 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <queue>
+#include <vector>
+
+template <class RanIt, class Comp>
+RanIt last_known_good_is_heap_until(RanIt first, RanIt last, Comp comp) {
+    const auto size = last - first;
+    for (std::ptrdiff_t off = 1; off < size; ++off) {
+        if (comp(first[(off - 1) / 2], first[off])) {
+            return first + off;
+        }
+    }
+
+    return last;
+}
+
+template <class T, class Comp>
+void test_case_is_heap_until(const std::vector<T>& input, Comp comp) {
+    auto expected = last_known_good_is_heap_until(input.begin(), input.end(), comp);
+    assert(std::is_heap_until(input.begin(), input.end(), comp) == expected);
+    assert(std::is_heap(input.begin(), input.end(), comp) == (expected == input.end()));
+#if _HAS_CXX20
+    assert(std::ranges::is_heap_until(input, comp) == expected);
+    assert(std::ranges::is_heap(input, comp) == (expected == input.end()));
+#endif // _HAS_CXX20
+}
+
+template <class T, class Comp>
+void test_case_heap(const std::vector<T>& input, Comp comp) {
+    auto sorted = input;
+    std::sort(sorted.begin(), sorted.end(), comp);
+
+    // Popping every element of a valid heap leaves the values sorted
+    const auto check = [&](const std::vector<T>& heap) {
+        assert(last_known_good_is_heap_until(heap.begin(), heap.end(), comp) == heap.end());
+        test_case_is_heap_until(heap, comp);
+
+        auto popped = heap;
+        for (auto last = popped.end(); last != popped.begin(); --last) {
+            std::pop_heap(popped.begin(), last, comp);
+        }
+        assert(popped == sorted);
+
+        auto sorted_heap = heap;
+        std::sort_heap(sorted_heap.begin(), sorted_heap.end(), comp);
+        assert(sorted_heap == sorted);
+#if _HAS_CXX20
+        auto popped_r = heap;
+        for (auto last = popped_r.end(); last != popped_r.begin(); --last) {
+            std::ranges::pop_heap(popped_r.begin(), last, comp);
+        }
+        assert(popped_r == sorted);
+
+        auto sorted_heap_r = heap;
+        std::ranges::sort_heap(sorted_heap_r, comp);
+        assert(sorted_heap_r == sorted);
+#endif // _HAS_CXX20
+    };
+
+    auto made = input;
+    std::make_heap(made.begin(), made.end(), comp);
+    check(made);
+
+    auto pushed = input;
+    for (auto last = pushed.begin(); last != pushed.end();) {
+        std::push_heap(pushed.begin(), ++last, comp);
+    }
+    check(pushed);
+#if _HAS_CXX20
+    auto made_r = input;
+    std::ranges::make_heap(made_r, comp);
+    check(made_r);
+#endif // _HAS_CXX20
+
+    std::priority_queue<T, std::vector<T>, Comp> queue(comp, input);
+    for (auto it = sorted.rbegin(); it != sorted.rend(); ++it) {
+        assert(queue.top() == *it);
+        queue.pop();
+    }
+    assert(queue.empty());
+}
@@ -0,0 +1,87 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+template <class T, class Comp>
+void test_case_sort(const std::vector<T>& input, Comp comp) {
+    // The lambda predicate isn't recognized by the vectorization, so std::sort falls back to the generic algorithm.
+    auto expected = input;
+    std::sort(expected.begin(), expected.end(), [comp](const T& left, const T& right) { return comp(left, right); });
+
+    auto actual = input;
+    std::sort(actual.begin(), actual.end(), comp);
+    assert(expected == actual);
+#if _HAS_CXX20
+    auto actual_r = input;
+    std::ranges::sort(actual_r, comp);
+    assert(expected == actual_r);
+#endif // _HAS_CXX20
+}
+
+template <class T, class Comp>
+void test_case_nth_element(const std::vector<T>& input, const std::size_t nth_pos, Comp comp) {
+    // Compared to the fully sorted sequence, which the vectorized algorithms don't have to produce
+    auto expected = input;
+    std::sort(expected.begin(), expected.end(), [comp](const T& left, const T& right) { return comp(left, right); });
+
+    const auto check = [&](std::vector<T>& actual) {
+        const auto nth = actual.begin() + static_cast<std::ptrdiff_t>(nth_pos);
+        if (nth == actual.end()) {
+            assert(actual == input);
+            return;
+        }
+
+        assert(*nth == expected[nth_pos]);
+        assert(std::none_of(actual.begin(), nth, [&](const T& val) { return comp(*nth, val); }));
+        assert(std::none_of(nth, actual.end(), [&](const T& val) { return comp(val, *nth); }));
+    };
+
+    auto actual = input;
+    std::nth_element(actual.begin(), actual.begin() + static_cast<std::ptrdiff_t>(nth_pos), actual.end(), comp);
+    check(actual);
+#if _HAS_CXX20
+    auto actual_r = input;
+    std::ranges::nth_element(actual_r, actual_r.begin() + static_cast<std::ptrdiff_t>(nth_pos), comp);
+    check(actual_r);
+#endif // _HAS_CXX20
+}
+
+template <class T, class Comp>
+void test_case_partial_sort(const std::vector<T>& input, const std::size_t mid_pos, Comp comp) {
+    auto expected = input;
+    std::sort(expected.begin(), expected.end(), [comp](const T& left, const T& right) { return comp(left, right); });
+    expected.resize(mid_pos);
+
+    const auto check = [&](const std::vector<T>& actual) {
+        assert(std::equal(expected.begin(), expected.end(), actual.begin(), actual.begin() + expected.size()));
+    };
+
+    auto actual = input;
+    std::partial_sort(actual.begin(), actual.begin() + static_cast<std::ptrdiff_t>(mid_pos), actual.end(), comp);
+    check(actual);
+
+    std::vector<T> copied(mid_pos);
+    assert(std::partial_sort_copy(input.begin(), input.end(), copied.begin(), copied.end(), comp) == copied.end());
+    assert(copied == expected);
+
+    // A destination larger than the source gets all of it
+    std::vector<T> copied_all(input.size() + 1);
+    assert(std::partial_sort_copy(input.begin(), input.end(), copied_all.begin(), copied_all.end(), comp)
+           == copied_all.begin() + static_cast<std::ptrdiff_t>(input.size()));
+    assert(std::is_sorted(copied_all.begin(), copied_all.end() - 1, comp));
+#if _HAS_CXX20
+    auto actual_r = input;
+    std::ranges::partial_sort(actual_r, actual_r.begin() + static_cast<std::ptrdiff_t>(mid_pos), comp);
+    check(actual_r);
+
+    std::vector<T> copied_r(mid_pos);
+    assert(std::ranges::partial_sort_copy(input, copied_r, comp).out == copied_r.end());
+    assert(copied_r == expected);
+#endif // _HAS_CXX20
+}
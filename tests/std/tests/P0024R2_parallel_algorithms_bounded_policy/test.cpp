@@ -0,0 +1,166 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <execution>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <set>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+// par.with(max_threads, min_grain) is an extension; the policies it returns must work everywhere par does
+static_assert(is_execution_policy_v<remove_const_t<decltype(par.with(2, 64))>>);
+static_assert(is_execution_policy_v<remove_const_t<decltype(par_unseq.with(2))>>);
+
+constexpr auto constexpr_bounded = par.with(4, 1024);
+
+unsigned int make_value(const size_t idx) {
+    return static_cast<unsigned int>((idx * 2654435761u) % 1000);
+}
+
+template <class ExecutionPolicy>
+void test_case_bounded_policy(const size_t testSize, const ExecutionPolicy& exec) {
+    vector<unsigned int> values(testSize);
+    for (size_t idx = 0; idx < testSize; ++idx) {
+        values[idx] = make_value(idx);
+    }
+
+    const auto is_odd = [](const unsigned int val) { return val % 2 != 0; };
+
+    {
+        auto c = values;
+        for_each(exec, c.begin(), c.end(), [](unsigned int& val) { ++val; });
+        assert(equal(c.begin(), c.end(), values.begin(), [](unsigned int l, unsigned int r) { return l == r + 1; }));
+    }
+
+    {
+        vector<unsigned int> out(testSize);
+        transform(exec, values.begin(), values.end(), out.begin(), [](unsigned int val) { return val * 3; });
+        assert(
+            equal(out.begin(), out.end(), values.begin(), [](unsigned int l, unsigned int r) { return l == r * 3; }));
+        assert(equal(exec, out.begin(), out.end(), out.begin(), out.end()));
+    }
+
+    const size_t expectedSum = accumulate(values.begin(), values.end(), size_t{0});
+    assert(reduce(exec, values.begin(), values.end(), size_t{0}) == expectedSum);
+    assert(count_if(exec, values.begin(), values.end(), is_odd) == count_if(values.begin(), values.end(), is_odd));
+    assert(find_if(exec, values.begin(), values.end(), is_odd) == find_if(values.begin(), values.end(), is_odd));
+    assert(all_of(exec, values.begin(), values.end(), [](unsigned int val) { return val < 1000; }));
+
+    {
+        vector<size_t> expected(testSize);
+        vector<size_t> actual(testSize);
+        inclusive_scan(values.begin(), values.end(), expected.begin(), plus<size_t>{});
+        inclusive_scan(exec, values.begin(), values.end(), actual.begin(), plus<size_t>{});
+        assert(expected == actual);
+        exclusive_scan(values.begin(), values.end(), expected.begin(), size_t{0});
+        exclusive_scan(exec, values.begin(), values.end(), actual.begin(), size_t{0});
+        assert(expected == actual);
+    }
+
+    {
+        vector<unsigned int> expected;
+        vector<unsigned int> actual(testSize);
+        copy_if(values.begin(), values.end(), back_inserter(expected), is_odd);
+        actual.erase(copy_if(exec, values.begin(), values.end(), actual.begin(), is_odd), actual.end());
+        assert(expected == actual);
+    }
+
+    {
+        auto expected = values;
+        auto actual   = values;
+        sort(expected.begin(), expected.end());
+        sort(exec, actual.begin(), actual.end());
+        assert(expected == actual);
+        actual = values;
+        stable_sort(exec, actual.begin(), actual.end());
+        assert(expected == actual);
+        actual = values;
+        sort(exec, actual.begin(), actual.end(), [](unsigned int l, unsigned int r) { return l < r; });
+        assert(expected == actual);
+        assert(is_sorted(exec, actual.begin(), actual.end()));
+    }
+
+    {
+        auto c = values;
+        partition(exec, c.begin(), c.end(), is_odd);
+        assert(is_partitioned(c.begin(), c.end(), is_odd));
+        c = values;
+        stable_partition(exec, c.begin(), c.end(), is_odd);
+        assert(is_partitioned(exec, c.begin(), c.end(), is_odd));
+        c.erase(remove_if(exec, c.begin(), c.end(), is_odd), c.end());
+        assert(none_of(exec, c.begin(), c.end(), is_odd));
+    }
+
+    if (testSize != 0) {
+        auto c         = values;
+        const auto nth = c.begin() + static_cast<ptrdiff_t>(testSize / 2);
+        nth_element(exec, c.begin(), nth, c.end());
+        auto sorted = values;
+        sort(sorted.begin(), sorted.end());
+        assert(*nth == sorted[testSize / 2]);
+    }
+
+    {
+        allocator<unsigned int> alloc;
+        const auto raw = alloc.allocate(testSize + 1);
+        uninitialized_copy(exec, values.begin(), values.end(), raw);
+        assert(equal(values.begin(), values.end(), raw));
+        alloc.deallocate(raw, testSize + 1);
+    }
+}
+
+template <class ExecutionPolicy>
+void test_thread_limit(const ExecutionPolicy& exec, const size_t maxThreads) {
+    // algorithm calls made with a policy from par.with(maxThreads, ...) never run on more than maxThreads threads
+    vector<int> c(100'000);
+    mutex idsMutex;
+    set<thread::id> ids;
+    for_each(exec, c.begin(), c.end(), [&](int&) {
+        lock_guard<mutex> lock(idsMutex);
+        ids.insert(this_thread::get_id());
+    });
+    assert(ids.size() <= maxThreads);
+}
+
+void test_min_grain() {
+    // a chunk is never smaller than the grain, so a grain as big as the range keeps the range in one chunk, processed
+    // by a single thread
+    vector<thread::id> ids(100'000);
+    for_each(par.with(0, ids.size()), ids.begin(), ids.end(), [](thread::id& id) { id = this_thread::get_id(); });
+    assert(all_of(ids.begin(), ids.end(), [&](const thread::id& id) { return id == ids.front(); }));
+}
+
+int main() {
+    const auto unbounded       = par.with(0, 0);
+    const auto one_thread      = par.with(1);
+    const auto two_threads     = par.with(2);
+    const auto coarse          = par.with(0, 1000);
+    const auto bounded_unseq   = par_unseq.with(3, 64);
+    const auto bounded_compile = constexpr_bounded;
+    parallel_test_case(test_case_bounded_policy<decltype(unbounded)>, unbounded);
+    parallel_test_case(test_case_bounded_policy<decltype(one_thread)>, one_thread);
+    parallel_test_case(test_case_bounded_policy<decltype(two_threads)>, two_threads);
+    parallel_test_case(test_case_bounded_policy<decltype(coarse)>, coarse);
+    parallel_test_case(test_case_bounded_policy<decltype(bounded_unseq)>, bounded_unseq);
+    parallel_test_case(test_case_bounded_policy<decltype(bounded_compile)>, bounded_compile);
+    test_case_bounded_policy(100'000, two_threads);
+    test_case_bounded_policy(100'000, coarse);
+
+    test_thread_limit(one_thread, 1);
+    test_thread_limit(two_threads, 2);
+    test_thread_limit(bounded_unseq, 3);
+    test_min_grain();
+}
@@ -0,0 +1,112 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <execution>
+#include <forward_list>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <numeric>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+const auto is_odd  = [](unsigned int i) { return (i & 0x1u) != 0; };
+const auto is_even = [](unsigned int i) { return (i & 0x1u) == 0; };
+const auto never   = [](unsigned int) { return false; };
+const auto always  = [](unsigned int) { return true; };
+
+template <class Container, class Pred>
+void test_one_copy_if(const Container& input, Pred pred) {
+    vector<unsigned int> expected;
+    copy_if(input.begin(), input.end(), back_inserter(expected), pred);
+
+    // random-access destination, parallelized
+    vector<unsigned int> actual(expected.size() + 1, 0xDEADBEEFu);
+    const auto actualEnd = copy_if(par, input.begin(), input.end(), actual.begin(), pred);
+    assert(equal(actual.begin(), actualEnd, expected.begin(), expected.end()));
+    assert(*actualEnd == 0xDEADBEEFu);
+
+    // bidirectional destination, serial
+    list<unsigned int> actualList(input.begin(), input.end());
+    const auto actualListEnd = copy_if(par, input.begin(), input.end(), actualList.begin(), pred);
+    assert(equal(actualList.begin(), actualListEnd, expected.begin(), expected.end()));
+}
+
+template <class Container, class Pred>
+void test_one_partition_copy(const Container& input, Pred pred) {
+    vector<unsigned int> expectedTrue;
+    vector<unsigned int> expectedFalse;
+    partition_copy(input.begin(), input.end(), back_inserter(expectedTrue), back_inserter(expectedFalse), pred);
+
+    // random-access destinations, parallelized
+    vector<unsigned int> actualTrue(input.begin(), input.end());
+    vector<unsigned int> actualFalse(input.begin(), input.end());
+    const auto actual = partition_copy(par, input.begin(), input.end(), actualTrue.begin(), actualFalse.begin(), pred);
+    assert(equal(actualTrue.begin(), actual.first, expectedTrue.begin(), expectedTrue.end()));
+    assert(equal(actualFalse.begin(), actual.second, expectedFalse.begin(), expectedFalse.end()));
+
+    // mixed destinations, serial
+    list<unsigned int> actualFalseList(input.begin(), input.end());
+    const auto actualMixed =
+        partition_copy(par, input.begin(), input.end(), actualTrue.begin(), actualFalseList.begin(), pred);
+    assert(equal(actualTrue.begin(), actualMixed.first, expectedTrue.begin(), expectedTrue.end()));
+    assert(equal(actualFalseList.begin(), actualMixed.second, expectedFalse.begin(), expectedFalse.end()));
+}
+
+template <template <class...> class Container>
+void test_case_copy_if_parallel(const size_t testSize, mt19937& gen) {
+    Container<unsigned int> input(testSize);
+
+    for (int i = 0; i < 50; ++i) {
+        generate(input.begin(), input.end(), ref(gen));
+        test_one_copy_if(input, is_even);
+        test_one_copy_if(input, is_odd);
+        test_one_partition_copy(input, is_even);
+    }
+
+    test_one_copy_if(input, never);
+    test_one_copy_if(input, always);
+    test_one_partition_copy(input, never);
+    test_one_partition_copy(input, always);
+}
+
+void test_case_predicate_applied_once(const size_t testSize) {
+    vector<unsigned int> input(testSize);
+    iota(input.begin(), input.end(), 0u);
+    vector<unsigned int> output(testSize);
+    vector<unsigned int> outputFalse(testSize);
+    atomic<size_t> calls{0};
+    const auto countingPred = [&calls](unsigned int i) {
+        calls.fetch_add(1, memory_order_relaxed);
+        return i % 3 == 0;
+    };
+
+    const auto copied = copy_if(par, input.begin(), input.end(), output.begin(), countingPred);
+    assert(calls.load() == testSize);
+    assert(static_cast<size_t>(copied - output.begin()) == (testSize + 2) / 3);
+
+    calls.store(0);
+    const auto partitioned =
+        partition_copy(par, input.begin(), input.end(), output.begin(), outputFalse.begin(), countingPred);
+    assert(calls.load() == testSize);
+    assert(static_cast<size_t>(partitioned.first - output.begin()) == (testSize + 2) / 3);
+    assert(static_cast<size_t>(partitioned.second - outputFalse.begin()) == testSize - (testSize + 2) / 3);
+}
+
+int main() {
+    mt19937 gen(1729);
+    parallel_test_case(test_case_copy_if_parallel<forward_list>, gen);
+    parallel_test_case(test_case_copy_if_parallel<list>, gen);
+    parallel_test_case(test_case_copy_if_parallel<vector>, gen);
+    parallel_test_case(test_case_predicate_applied_once);
+}
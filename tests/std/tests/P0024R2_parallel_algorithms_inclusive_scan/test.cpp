@@ -69,6 +69,16 @@ void test_case_inclusive_scan_parallel(const size_t testSize, mt19937& gen) {
     assert(s == d);
 }
 
+void test_case_inclusive_scan_parallel_in_place(const size_t testSize, mt19937& gen) {
+    // also test where dest == first
+    vector<unsigned int> s(testSize);
+    generate(s.begin(), s.end(), ref(gen));
+    vector<unsigned int> d(testSize);
+    inclusive_scan(s.cbegin(), s.cend(), d.begin()); // prepare expected values using serial algorithm
+    assert(s.end() == inclusive_scan(par, s.begin(), s.end(), s.begin()));
+    assert(s == d);
+}
+
 void test_case_inclusive_scan_parallel_associative(const size_t testSize) {
     // string concat is associative but not commutative
     vector<string> results(testSize);
@@ -206,6 +216,7 @@ int main() {
     mt19937 gen(1729);
 
     parallel_test_case(test_case_inclusive_scan_parallel, gen);
+    parallel_test_case(test_case_inclusive_scan_parallel_in_place, gen);
     parallel_test_case(test_case_inclusive_scan_parallel_associative);
     parallel_test_case(test_case_inclusive_scan_parallel_associative_in_place);
     parallel_test_case(test_case_inclusive_scan_bop_parallel, gen);
@@ -0,0 +1,122 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <execution>
+#include <functional>
+#include <list>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+// keys compare equal often; the second member records where each element came from, to check stability
+using tagged = pair<unsigned int, size_t>;
+
+const auto key_less    = [](const tagged& lhs, const tagged& rhs) { return lhs.first < rhs.first; };
+const auto key_greater = [](const tagged& lhs, const tagged& rhs) { return lhs.first > rhs.first; };
+
+template <class Pred>
+vector<tagged> make_sorted_input(const size_t size, const size_t tagBase, const unsigned int maxKey, mt19937& gen,
+    Pred pred) {
+    uniform_int_distribution<unsigned int> dist(0, maxKey);
+    vector<tagged> result(size);
+    for (auto& elem : result) {
+        elem.first = dist(gen);
+    }
+
+    sort(result.begin(), result.end(), pred);
+    for (size_t idx = 0; idx < size; ++idx) {
+        result[idx].second = tagBase + idx;
+    }
+
+    return result;
+}
+
+template <class Pred>
+void test_one_merge(const vector<tagged>& input1, const vector<tagged>& input2, Pred pred) {
+    vector<tagged> expected(input1.size() + input2.size());
+    merge(input1.begin(), input1.end(), input2.begin(), input2.end(), expected.begin(), pred);
+
+    vector<tagged> actual(expected.size());
+    const auto actualEnd = merge(par, input1.begin(), input1.end(), input2.begin(), input2.end(), actual.begin(), pred);
+    assert(actualEnd == actual.end());
+    assert(actual == expected);
+
+    // bidirectional output isn't parallelized
+    list<tagged> actualList(expected.size());
+    const auto actualListEnd =
+        merge(par, input1.begin(), input1.end(), input2.begin(), input2.end(), actualList.begin(), pred);
+    assert(actualListEnd == actualList.end());
+    assert(equal(actualList.begin(), actualList.end(), expected.begin(), expected.end()));
+
+    vector<tagged> inplace(input1);
+    inplace.insert(inplace.end(), input2.begin(), input2.end());
+    inplace_merge(par, inplace.begin(), inplace.begin() + static_cast<ptrdiff_t>(input1.size()), inplace.end(), pred);
+    assert(inplace == expected);
+
+    list<tagged> inplaceList(input1.begin(), input1.end());
+    inplaceList.insert(inplaceList.end(), input2.begin(), input2.end());
+    inplace_merge(par, inplaceList.begin(), next(inplaceList.begin(), static_cast<ptrdiff_t>(input1.size())),
+        inplaceList.end(), pred);
+    assert(equal(inplaceList.begin(), inplaceList.end(), expected.begin(), expected.end()));
+}
+
+void test_case_merge_parallel(const size_t testSize, mt19937& gen) {
+    for (const size_t leftSize : {size_t{0}, testSize / 3, testSize / 2, testSize - testSize / 4, testSize}) {
+        const size_t rightSize = testSize - leftSize;
+        for (const unsigned int maxKey : {0u, 3u, 1000u}) {
+            const auto left  = make_sorted_input(leftSize, 0, maxKey, gen, key_less);
+            const auto right = make_sorted_input(rightSize, testSize, maxKey, gen, key_less);
+            test_one_merge(left, right, key_less);
+
+            const auto leftDescending  = make_sorted_input(leftSize, 0, maxKey, gen, key_greater);
+            const auto rightDescending = make_sorted_input(rightSize, testSize, maxKey, gen, key_greater);
+            test_one_merge(leftDescending, rightDescending, key_greater);
+        }
+    }
+
+    // disjoint inputs, already in order and reversed
+    vector<unsigned int> v(testSize);
+    for (size_t idx = 0; idx < testSize; ++idx) {
+        v[idx] = static_cast<unsigned int>(idx);
+    }
+
+    vector<unsigned int> result(testSize);
+    const auto mid = v.begin() + static_cast<ptrdiff_t>(testSize / 2);
+    merge(par, v.begin(), mid, mid, v.end(), result.begin());
+    assert(result == v);
+    merge(par, mid, v.end(), v.begin(), mid, result.begin());
+    assert(result == v);
+
+    rotate(v.begin(), mid, v.end());
+    inplace_merge(par, v.begin(), v.begin() + static_cast<ptrdiff_t>(testSize - testSize / 2), v.end());
+    assert(is_sorted(v.begin(), v.end()));
+}
+
+void test_case_inplace_merge_move_only() {
+    // each element is moved exactly once into place; the values track the original positions
+    vector<unique_ptr<size_t>> v;
+    for (size_t idx = 0; idx < 1000; ++idx) {
+        v.push_back(make_unique<size_t>(idx % 500 * 2 + idx / 500));
+    }
+
+    inplace_merge(
+        par, v.begin(), v.begin() + 500, v.end(), [](const auto& lhs, const auto& rhs) { return *lhs < *rhs; });
+    for (size_t idx = 0; idx < 1000; ++idx) {
+        assert(*v[idx] == idx);
+    }
+}
+
+int main() {
+    mt19937 gen(1729);
+    parallel_test_case(test_case_merge_parallel, gen);
+    test_case_inplace_merge_move_only();
+}
@@ -0,0 +1,109 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <execution>
+#include <functional>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+template <class Pred>
+void check_nth_element(const vector<unsigned int>& input, const size_t nth, Pred pred) {
+    auto sorted = input;
+    sort(sorted.begin(), sorted.end(), pred);
+
+    auto actual = input;
+    nth_element(par, actual.begin(), actual.begin() + static_cast<ptrdiff_t>(nth), actual.end(), pred);
+    if (nth == input.size()) {
+        assert(is_permutation(actual.begin(), actual.end(), input.begin(), input.end()));
+        return;
+    }
+
+    assert(actual[nth] == sorted[nth]);
+    for (size_t idx = 0; idx < nth; ++idx) {
+        assert(!pred(actual[nth], actual[idx]));
+    }
+
+    for (size_t idx = nth + 1; idx < actual.size(); ++idx) {
+        assert(!pred(actual[idx], actual[nth]));
+    }
+
+    sort(actual.begin(), actual.end(), pred);
+    assert(actual == sorted);
+}
+
+template <class Pred>
+void check_partial_sort(const vector<unsigned int>& input, const size_t mid, Pred pred) {
+    auto sorted = input;
+    sort(sorted.begin(), sorted.end(), pred);
+
+    auto actual = input;
+    partial_sort(par, actual.begin(), actual.begin() + static_cast<ptrdiff_t>(mid), actual.end(), pred);
+    assert(equal(actual.begin(), actual.begin() + static_cast<ptrdiff_t>(mid), sorted.begin()));
+    sort(actual.begin() + static_cast<ptrdiff_t>(mid), actual.end(), pred);
+    assert(actual == sorted);
+}
+
+void test_case_nth_element_parallel(const size_t testSize, mt19937& gen) {
+    vector<unsigned int> input(testSize);
+    for (const unsigned int maxKey : {0u, 2u, 1000u, 0xFFFF'FFFFu}) {
+        uniform_int_distribution<unsigned int> dist(0, maxKey);
+        generate(input.begin(), input.end(), [&] { return dist(gen); });
+        for (const size_t nth : {size_t{0}, testSize / 5, testSize / 2, testSize - testSize / 10, testSize}) {
+            check_nth_element(input, nth, less<>{});
+            check_nth_element(input, nth, greater<>{});
+            check_partial_sort(input, nth, less<>{});
+        }
+    }
+}
+
+void test_case_large_inputs(mt19937& gen) {
+    // large enough to go through several rounds of sample-select
+    for (const size_t testSize : {100'000u, 250'001u}) {
+        test_case_nth_element_parallel(testSize, gen);
+
+        vector<unsigned int> ascending(testSize);
+        for (size_t idx = 0; idx < testSize; ++idx) {
+            ascending[idx] = static_cast<unsigned int>(idx);
+        }
+
+        const vector<unsigned int> descending(ascending.rbegin(), ascending.rend());
+        vector<unsigned int> organPipe(ascending.begin(), ascending.begin() + static_cast<ptrdiff_t>(testSize / 2));
+        organPipe.insert(organPipe.end(), descending.begin() + static_cast<ptrdiff_t>(testSize / 2), descending.end());
+        for (const size_t nth : {size_t{1}, testSize / 3, testSize - 2}) {
+            check_nth_element(ascending, nth, less<>{});
+            check_nth_element(descending, nth, less<>{});
+            check_nth_element(organPipe, nth, less<>{});
+        }
+    }
+}
+
+void test_case_move_only() {
+    vector<unique_ptr<unsigned int>> v;
+    for (unsigned int idx = 0; idx < 50'000; ++idx) {
+        v.push_back(make_unique<unsigned int>(idx * 7919u % 50'000u));
+    }
+
+    const auto pred = [](const auto& lhs, const auto& rhs) { return *lhs < *rhs; };
+    nth_element(par, v.begin(), v.begin() + 12'345, v.end(), pred);
+    assert(*v[12'345] == 12'345u);
+    partial_sort(par, v.begin(), v.begin() + 1'000, v.end(), pred);
+    for (unsigned int idx = 0; idx < 1'000; ++idx) {
+        assert(*v[idx] == idx);
+    }
+}
+
+int main() {
+    mt19937 gen(1729);
+    parallel_test_case(test_case_nth_element_parallel, gen);
+    test_case_large_inputs(gen);
+    test_case_move_only();
+}
@@ -0,0 +1,80 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <execution>
+#include <functional>
+#include <numeric>
+#include <vector>
+
+using namespace std;
+using namespace std::execution;
+
+// The parallel algorithms learn, per operation type, whether elements are too cheap to be worth waking the thread
+// pool. Each call below shares its estimate between cheap and expensive elements at many sizes, so whichever way the
+// estimate leans, later calls switch between serial and parallel execution; results must not depend on the choice.
+
+unsigned int work(const unsigned int val, const unsigned int rounds) {
+    unsigned int result = val;
+    for (unsigned int round = 0; round < rounds; ++round) {
+        result = result * 1664525u + 1013904223u;
+    }
+
+    return result;
+}
+
+void test_case_sequential_cutoff(const size_t testSize, const unsigned int rounds) {
+    vector<unsigned int> input(testSize);
+    iota(input.begin(), input.end(), 0u);
+    vector<unsigned int> expected(testSize);
+    transform(input.begin(), input.end(), expected.begin(), [=](unsigned int val) { return work(val, rounds); });
+
+    {
+        auto actual = input;
+        for_each(par, actual.begin(), actual.end(), [=](unsigned int& val) { val = work(val, rounds); });
+        assert(actual == expected);
+    }
+
+    {
+        vector<unsigned int> actual(testSize);
+        transform(par, input.begin(), input.end(), actual.begin(), [=](unsigned int val) { return work(val, rounds); });
+        assert(actual == expected);
+    }
+
+    const auto expectedSum = accumulate(expected.begin(), expected.end(), 0u);
+    assert(transform_reduce(par, input.begin(), input.end(), 0u, plus<>{},
+               [=](unsigned int val) { return work(val, rounds); })
+           == expectedSum);
+    assert(reduce(par, expected.begin(), expected.end(), 0u) == expectedSum);
+
+    const auto isOdd = [](unsigned int val) { return val % 2 != 0; };
+    assert(count_if(par, expected.begin(), expected.end(), isOdd) == count_if(expected.begin(), expected.end(), isOdd));
+
+    {
+        vector<unsigned int> actual(testSize);
+        inclusive_scan(par, expected.begin(), expected.end(), actual.begin());
+        vector<unsigned int> serial(testSize);
+        partial_sum(expected.begin(), expected.end(), serial.begin());
+        assert(actual == serial);
+    }
+}
+
+int main() {
+    for (const unsigned int rounds : {0u, 1000u, 0u, 1u, 200u}) {
+        for (const size_t testSize : {size_t{0}, size_t{1}, size_t{2}, size_t{100}, size_t{5'000}, size_t{50'000}}) {
+            test_case_sequential_cutoff(testSize, rounds);
+        }
+    }
+
+    for (const size_t testSize : {size_t{200'000}, size_t{1'000}, size_t{200'000}}) {
+        test_case_sequential_cutoff(testSize, 0);
+    }
+
+    // an estimate taken from expensive elements sends later cheap calls to the thread pool until a periodic
+    // re-measurement brings it back down; run enough cheap calls to re-measure several times
+    for (unsigned int run = 0; run < 64; ++run) {
+        test_case_sequential_cutoff(5'000, run == 0 ? 1000u : 0u);
+    }
+}
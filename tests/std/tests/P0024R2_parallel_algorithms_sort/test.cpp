@@ -6,6 +6,7 @@
 #include <execution>
 #include <numeric>
 #include <random>
+#include <thread>
 #include <vector>
 
 #include <parallel_algorithms_utilities.hpp>
@@ -35,9 +36,52 @@ void test_case_sort_parallel(const size_t testSize, mt19937& gen) {
     assert(is_sorted(c.begin(), c.end()));
 }
 
+// Large enough for every hardware thread to get a chunk of a radix sort
+const size_t radix_sort_test_size = 40'000 + thread::hardware_concurrency() * 16'384;
+
+template <class T, class Pred>
+void test_case_sort_parallel_arithmetic(const vector<T>& input, Pred pred) {
+    auto expected = input;
+    sort(expected.begin(), expected.end(), pred);
+    auto c = input;
+    sort(par, c.begin(), c.end(), pred);
+    assert(c == expected);
+}
+
+template <class T>
+void test_case_sort_parallel_arithmetic(mt19937& gen) {
+    vector<T> c(radix_sort_test_size);
+    uniform_int_distribution<int> dist(-1000, 1000);
+    generate(c.begin(), c.end(), [&] { return static_cast<T>(dist(gen)); });
+    test_case_sort_parallel_arithmetic(c, less<>{});
+    test_case_sort_parallel_arithmetic(c, greater<>{});
+    test_case_sort_parallel_arithmetic(c, less<T>{});
+    test_case_sort_parallel_arithmetic(c, greater<T>{});
+
+    // all elements in the same bucket for most digits
+    for (auto& val : c) {
+        val = static_cast<T>(static_cast<int>(val) % 4);
+    }
+
+    test_case_sort_parallel_arithmetic(c, less<>{});
+    test_case_sort_parallel_arithmetic(c, greater<>{});
+}
+
 int main() {
     mt19937 gen(1729);
 
     test_case_sort_parallel_special_cases();
     parallel_test_case(test_case_sort_parallel, gen);
+
+    test_case_sort_parallel_arithmetic<signed char>(gen);
+    test_case_sort_parallel_arithmetic<unsigned char>(gen);
+    test_case_sort_parallel_arithmetic<short>(gen);
+    test_case_sort_parallel_arithmetic<unsigned short>(gen);
+    test_case_sort_parallel_arithmetic<int>(gen);
+    test_case_sort_parallel_arithmetic<unsigned int>(gen);
+    test_case_sort_parallel_arithmetic<long long>(gen);
+    test_case_sort_parallel_arithmetic<unsigned long long>(gen);
+    test_case_sort_parallel_arithmetic<float>(gen);
+    test_case_sort_parallel_arithmetic<double>(gen);
+    test_case_sort_parallel_arithmetic<long double>(gen);
 }
@@ -0,0 +1,117 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <execution>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+// the second member records the original position, to check that relative order is preserved
+using keyed = pair<unsigned int, size_t>;
+
+const auto is_even = [](const keyed& elem) { return (elem.first & 0x1u) == 0; };
+
+template <class Container>
+void check_stable_partition(const Container& input) {
+    vector<keyed> expected(input.begin(), input.end());
+    const auto expectedResult = stable_partition(expected.begin(), expected.end(), is_even);
+
+    auto tested       = input;
+    const auto result = stable_partition(par, tested.begin(), tested.end(), is_even);
+    assert(distance(tested.begin(), result) == expectedResult - expected.begin());
+    assert(equal(tested.begin(), tested.end(), expected.begin(), expected.end()));
+}
+
+template <template <class...> class Container>
+void test_case_stable_partition_parallel(const size_t testSize, mt19937& gen) {
+    Container<keyed> input(testSize);
+    size_t idx = 0;
+    for (auto& elem : input) {
+        elem = {static_cast<unsigned int>(idx), idx};
+        ++idx;
+    }
+
+    check_stable_partition(input);
+
+    for (auto& elem : input) {
+        elem.first = 0;
+    }
+
+    check_stable_partition(input); // all true
+
+    for (auto& elem : input) {
+        elem.first = 1;
+    }
+
+    check_stable_partition(input); // all false
+
+    // "fuzz" testing:
+    for (int i = 0; i < 100; ++i) {
+        for (auto& elem : input) {
+            elem.first = static_cast<unsigned int>(gen());
+        }
+
+        check_stable_partition(input);
+    }
+}
+
+void test_case_large_inputs(mt19937& gen) {
+    vector<keyed> input(100000);
+    for (size_t idx = 0; idx < input.size(); ++idx) {
+        input[idx] = {static_cast<unsigned int>(gen()), idx};
+    }
+
+    check_stable_partition(input);
+
+    // mostly true, and mostly false
+    for (auto& elem : input) {
+        elem.first = gen() % 16 == 0 ? 1U : 0U;
+    }
+
+    check_stable_partition(input);
+
+    for (auto& elem : input) {
+        elem.first = gen() % 16 == 0 ? 0U : 1U;
+    }
+
+    check_stable_partition(input);
+}
+
+void test_case_move_only_elements() {
+    vector<unique_ptr<unsigned int>> tested;
+    for (unsigned int idx = 0; idx < 10000; ++idx) {
+        tested.push_back(make_unique<unsigned int>(idx));
+    }
+
+    const auto is_multiple_of_3 = [](const unique_ptr<unsigned int>& elem) { return *elem % 3 == 0; };
+    const auto result           = stable_partition(par, tested.begin(), tested.end(), is_multiple_of_3);
+    assert(result - tested.begin() == 3334);
+    for (unsigned int idx = 0; idx < 3334; ++idx) {
+        assert(*tested[idx] == idx * 3);
+    }
+
+    for (unsigned int idx = 3334; idx < 10000; ++idx) {
+        const auto falseIdx = idx - 3334;
+        assert(*tested[idx] == falseIdx / 2 * 3 + falseIdx % 2 + 1);
+    }
+}
+
+int main() {
+    mt19937 gen(1729);
+    parallel_test_case(test_case_stable_partition_parallel<list>, gen);
+    parallel_test_case(test_case_stable_partition_parallel<vector>, gen);
+
+    test_case_large_inputs(gen);
+    test_case_move_only_elements();
+}
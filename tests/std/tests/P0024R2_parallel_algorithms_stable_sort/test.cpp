@@ -3,9 +3,11 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <execution>
 #include <list>
 #include <random>
+#include <thread>
 #include <vector>
 
 #include <parallel_algorithms_utilities.hpp>
@@ -82,6 +84,44 @@ void test_case_stable_sort_parallel_vector(const size_t testSize, mt19937& gen)
     assert_stable_sort_cmpTens_test_case(c.begin(), c.end());
 }
 
+// Large enough for every hardware thread to get a chunk of a radix sort
+const size_t radix_sort_test_size = 40'000 + thread::hardware_concurrency() * 16'384;
+
+template <class T>
+void test_case_stable_sort_parallel_floating(mt19937& gen) {
+    // -0.0 and 0.0 are equivalent, so they must keep their relative order
+    vector<T> c(radix_sort_test_size);
+    uniform_int_distribution<int> dist(-50, 50);
+    generate(c.begin(), c.end(), [&] {
+        const int val = dist(gen);
+        return val == 0 ? static_cast<T>(-0.0) : static_cast<T>(val) / 4;
+    });
+
+    const auto assert_stable = [&](auto pred) {
+        auto expected = c;
+        stable_sort(expected.begin(), expected.end(), pred);
+        auto actual = c;
+        stable_sort(par, actual.begin(), actual.end(), pred);
+        assert(actual == expected);
+        assert(equal(actual.begin(), actual.end(), expected.begin(), expected.end(),
+            [](T left, T right) { return signbit(left) == signbit(right); }));
+    };
+
+    assert_stable(less<>{});
+    assert_stable(greater<T>{});
+}
+
+template <class T>
+void test_case_stable_sort_parallel_integral(mt19937& gen) {
+    vector<T> c(radix_sort_test_size);
+    uniform_int_distribution<long long> dist(-100'000, 100'000);
+    generate(c.begin(), c.end(), [&] { return static_cast<T>(dist(gen)); });
+    auto expected = c;
+    stable_sort(expected.begin(), expected.end(), greater<>{});
+    stable_sort(par, c.begin(), c.end(), greater<>{});
+    assert(c == expected);
+}
+
 int main() {
     mt19937 gen(1729);
 
@@ -89,4 +129,11 @@ int main() {
     test_case_stable_sort_parallel_special_cases<vector>();
     parallel_test_case(test_case_stable_sort_parallel_list, gen);
     parallel_test_case(test_case_stable_sort_parallel_vector, gen);
+
+    test_case_stable_sort_parallel_floating<float>(gen);
+    test_case_stable_sort_parallel_floating<double>(gen);
+    test_case_stable_sort_parallel_integral<signed char>(gen);
+    test_case_stable_sort_parallel_integral<unsigned short>(gen);
+    test_case_stable_sort_parallel_integral<int>(gen);
+    test_case_stable_sort_parallel_integral<unsigned long long>(gen);
 }
@@ -0,0 +1,100 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <execution>
+#include <functional>
+#include <numeric>
+#include <vector>
+
+using namespace std;
+using namespace std::execution;
+
+// Exercises the thread pool under the parallel algorithms through the same hooks <execution> uses. With the
+// std::thread pool (see STL_STD_THREAD_POOL in the README), this covers a worker submitting more than fit in its
+// work-stealing deque, a worker popping its last submission while idle workers try to steal it, and parallel
+// algorithms nested in the chunks of a scan, which must not run unrelated chunks while they wait.
+
+struct counting_work {
+    atomic<size_t> runs{0};
+
+    static void __stdcall callback(__std_PTP_CALLBACK_INSTANCE, void* const context, __std_PTP_WORK) noexcept {
+        static_cast<counting_work*>(context)->runs.fetch_add(1, memory_order_relaxed);
+    }
+};
+
+void submit_and_wait(const size_t submissions) {
+    counting_work counter;
+    const auto work = __std_create_threadpool_work(&counting_work::callback, &counter, nullptr);
+    assert(work);
+    __std_bulk_submit_threadpool_work(work, submissions);
+    __std_wait_for_threadpool_work_callbacks(work, false);
+    __std_close_threadpool_work(work);
+    assert(counter.runs.load() == submissions);
+}
+
+void race_one_submission(const size_t rounds) {
+    // each round leaves a single submission in the deque, so the owner's pop and any thief's steal compete for it
+    counting_work counter;
+    const auto work = __std_create_threadpool_work(&counting_work::callback, &counter, nullptr);
+    assert(work);
+    for (size_t round = 1; round <= rounds; ++round) {
+        __std_submit_threadpool_work(work);
+        __std_wait_for_threadpool_work_callbacks(work, false);
+        assert(counter.runs.load() == round);
+    }
+
+    __std_close_threadpool_work(work);
+}
+
+struct from_pool_work {
+    void (*test)(size_t);
+    size_t arg;
+
+    static void __stdcall callback(__std_PTP_CALLBACK_INSTANCE, void* const context, __std_PTP_WORK) noexcept {
+        const auto self = static_cast<from_pool_work*>(context);
+        self->test(self->arg);
+    }
+};
+
+void run_from_pool(void (*const test)(size_t), const size_t arg, const size_t copies) {
+    // run copies of the test at once, on the pool's threads, so their submissions go to the workers' own deques
+    from_pool_work context{test, arg};
+    const auto work = __std_create_threadpool_work(&from_pool_work::callback, &context, nullptr);
+    assert(work);
+    __std_bulk_submit_threadpool_work(work, copies);
+    __std_wait_for_threadpool_work_callbacks(work, false);
+    __std_close_threadpool_work(work);
+}
+
+void test_nested_in_scan(const size_t testSize) {
+    vector<size_t> inner(5'000);
+    iota(inner.begin(), inner.end(), size_t{0});
+    const size_t innerSum = accumulate(inner.begin(), inner.end(), size_t{0});
+    vector<size_t> input(testSize, 1);
+    vector<size_t> actual(testSize);
+    inclusive_scan(par, input.begin(), input.end(), actual.begin(), [&](size_t lhs, size_t rhs) {
+        assert(reduce(par, inner.begin(), inner.end(), size_t{0}) == innerSum);
+        return lhs + rhs;
+    });
+
+    for (size_t idx = 0; idx < testSize; ++idx) {
+        assert(actual[idx] == idx + 1);
+    }
+}
+
+int main() {
+    for (const size_t submissions : {size_t{1}, size_t{1'023}, size_t{1'024}, size_t{1'025}, size_t{5'000}}) {
+        submit_and_wait(submissions);
+        run_from_pool(submit_and_wait, submissions, 1);
+        run_from_pool(submit_and_wait, submissions, 8);
+    }
+
+    race_one_submission(10'000);
+    run_from_pool(race_one_submission, 10'000, 1);
+    run_from_pool(race_one_submission, 2'000, 16);
+
+    test_nested_in_scan(2'000);
+}
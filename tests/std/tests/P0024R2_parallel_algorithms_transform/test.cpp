@@ -4,12 +4,15 @@
 #include <algorithm>
 #include <atomic>
 #include <cassert>
+#include <cstddef>
 #include <execution>
 #include <forward_list>
 #include <functional>
 #include <iterator>
 #include <list>
+#include <numeric>
 #include <random>
+#include <string>
 #include <vector>
 
 #include <parallel_algorithms_utilities.hpp>
@@ -43,6 +46,58 @@ void test_case_binary_transform_parallel(const size_t testSize, mt19937& gen) {
     assert(equal(expected.begin(), expected.end(), d.begin(), d.end()));
 }
 
+template <class ExecutionPolicy>
+void test_case_transform_unsequenced(const size_t testSize, const ExecutionPolicy& exec) {
+    // the unsequenced policies run transform and fill loops with their iterations marked independent
+    vector<unsigned int> s(testSize);
+    iota(s.begin(), s.end(), 0u);
+    vector<unsigned int> d(testSize);
+    assert(d.end() == transform(exec, s.cbegin(), s.cend(), d.begin(), add_twenty));
+    assert(equal(s.cbegin(), s.cend(), d.cbegin(), d.cend(), equal_twenty));
+
+    vector<unsigned int> sums(testSize);
+    assert(sums.end() == transform(exec, s.cbegin(), s.cend(), d.cbegin(), sums.begin(), plus<>{}));
+    for (size_t idx = 0; idx < testSize; ++idx) {
+        assert(sums[idx] == idx * 2 + 20);
+    }
+
+    // in place
+    assert(s.end() == transform(exec, s.begin(), s.end(), s.begin(), add_twenty));
+    assert(s == d);
+    assert(s.end() == transform(exec, s.begin(), s.end(), d.cbegin(), s.begin(), minus<>{}));
+    assert(all_of(s.begin(), s.end(), [](unsigned int x) { return x == 0; }));
+
+    // neighboring vector<bool> elements share storage
+    vector<bool> bits(testSize);
+    transform(exec, d.cbegin(), d.cend(), bits.begin(), [](unsigned int x) { return x % 3 == 0; });
+    for (size_t idx = 0; idx < testSize; ++idx) {
+        assert(bits[idx] == ((idx + 20) % 3 == 0));
+    }
+
+    vector<string> strs(testSize);
+    fill(exec, strs.begin(), strs.end(), "meow");
+    assert(all_of(strs.begin(), strs.end(), [](const string& str) { return str == "meow"; }));
+    if (testSize != 0) {
+        // the value may alias an element being filled
+        strs.back() = "purr";
+        fill(exec, strs.begin(), strs.end(), strs.back());
+        assert(all_of(strs.begin(), strs.end(), [](const string& str) { return str == "purr"; }));
+    }
+
+    const auto half = static_cast<ptrdiff_t>(testSize / 2);
+    assert(strs.begin() + half == fill_n(exec, strs.begin(), half, string{}));
+    assert(all_of(strs.begin(), strs.begin() + half, [](const string& str) { return str.empty(); }));
+    assert(all_of(strs.begin() + half, strs.end(), [](const string& str) { return str == "purr"; }));
+
+    vector<double> doubles(testSize, 1.5);
+    fill(exec, doubles.begin(), doubles.end(), 0.0);
+    assert(all_of(doubles.begin(), doubles.end(), [](double x) { return x == 0.0; }));
+    assert(doubles.end() == fill_n(exec, doubles.begin(), testSize, 2.5));
+    assert(all_of(doubles.begin(), doubles.end(), [](double x) { return x == 2.5; }));
+    fill(exec, bits.begin(), bits.end(), true);
+    assert(all_of(bits.begin(), bits.end(), [](bool b) { return b; }));
+}
+
 int main() {
     mt19937 gen(1729);
 
@@ -83,4 +138,9 @@ int main() {
     parallel_test_case(test_case_binary_transform_parallel<vector, vector, forward_list>, gen);
     parallel_test_case(test_case_binary_transform_parallel<vector, vector, list>, gen);
     parallel_test_case(test_case_binary_transform_parallel<vector, vector, vector>, gen);
+
+    parallel_test_case(test_case_transform_unsequenced<parallel_unsequenced_policy>, par_unseq);
+#if _HAS_CXX20
+    parallel_test_case(test_case_transform_unsequenced<unsequenced_policy>, unseq);
+#endif // _HAS_CXX20
 }
@@ -0,0 +1,108 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <execution>
+#include <forward_list>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+template <class T>
+struct raw_buffer {
+    allocator<T> alloc;
+    size_t size;
+    T* data;
+
+    explicit raw_buffer(const size_t size_) : size(size_), data(alloc.allocate(size_ + 1)) {}
+    raw_buffer(const raw_buffer&)            = delete;
+    raw_buffer& operator=(const raw_buffer&) = delete;
+
+    ~raw_buffer() {
+        alloc.deallocate(data, size + 1);
+    }
+};
+
+template <class T>
+T make_value(size_t idx);
+
+template <>
+unsigned int make_value<unsigned int>(const size_t idx) {
+    return static_cast<unsigned int>(idx * 7);
+}
+
+template <>
+string make_value<string>(const size_t idx) {
+    return "this string is long enough to be allocated " + to_string(idx);
+}
+
+template <class T, template <class...> class Container>
+void test_case_uninitialized_parallel(const size_t testSize) {
+    vector<T> values;
+    for (size_t idx = 0; idx < testSize; ++idx) {
+        values.push_back(make_value<T>(idx));
+    }
+
+    const Container<T> source(values.begin(), values.end());
+
+    const auto testCount = static_cast<ptrdiff_t>(testSize);
+    raw_buffer<T> buffer(testSize);
+    const auto first = buffer.data;
+    const auto last  = buffer.data + testSize;
+
+    assert(uninitialized_copy(par, source.begin(), source.end(), first) == last);
+    assert(equal(first, last, source.begin(), source.end()));
+    destroy(par, first, last);
+
+    assert(uninitialized_copy_n(par, source.begin(), testCount, first) == last);
+    assert(equal(first, last, source.begin(), source.end()));
+    destroy_n(par, first, testSize);
+
+    {
+        auto moved = source;
+        assert(uninitialized_move(par, moved.begin(), moved.end(), first) == last);
+        assert(equal(first, last, source.begin(), source.end()));
+        destroy(par, first, last);
+    }
+
+    {
+        auto moved        = source;
+        const auto result = uninitialized_move_n(par, moved.begin(), testCount, first);
+        assert(result.first == moved.end());
+        assert(result.second == last);
+        assert(equal(first, last, source.begin(), source.end()));
+        destroy(par, first, last);
+    }
+
+    const T val = make_value<T>(1729);
+    uninitialized_fill(par, first, last, val);
+    assert(all_of(first, last, [&](const T& elem) { return elem == val; }));
+    destroy(par, first, last);
+
+    assert(uninitialized_fill_n(par, first, testCount, val) == last);
+    assert(all_of(first, last, [&](const T& elem) { return elem == val; }));
+    destroy(par, first, last);
+
+    // non-positive counts do nothing
+    assert(uninitialized_copy_n(par, source.begin(), -1, first) == first);
+    assert(uninitialized_move_n(par, source.begin(), 0, first).second == first);
+    assert(uninitialized_fill_n(par, first, -1, val) == first);
+}
+
+int main() {
+    parallel_test_case(test_case_uninitialized_parallel<unsigned int, forward_list>);
+    parallel_test_case(test_case_uninitialized_parallel<unsigned int, vector>);
+    parallel_test_case(test_case_uninitialized_parallel<string, forward_list>);
+    parallel_test_case(test_case_uninitialized_parallel<string, list>);
+    parallel_test_case(test_case_uninitialized_parallel<string, vector>);
+}
@@ -0,0 +1,103 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <execution>
+#include <forward_list>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+// the key is the first member; the second member records the original position, to check which element of each group
+// is kept
+using keyed = pair<unsigned int, size_t>;
+
+const auto same_key = [](const keyed& lhs, const keyed& rhs) { return lhs.first == rhs.first; };
+
+template <template <class...> class Container>
+void test_case_unique_parallel(const size_t testSize, mt19937& gen) {
+    Container<keyed> input(testSize);
+    for (const unsigned int maxKey : {0U, 1U, 3U, 1000U}) {
+        uniform_int_distribution<unsigned int> dist(0, maxKey);
+        size_t idx = 0;
+        for (auto& elem : input) {
+            elem = {dist(gen), idx++};
+        }
+
+        vector<keyed> expected(input.begin(), input.end());
+        expected.erase(unique(expected.begin(), expected.end(), same_key), expected.end());
+
+        {
+            auto tested       = input;
+            const auto result = unique(par, tested.begin(), tested.end(), same_key);
+            assert(equal(tested.begin(), result, expected.begin(), expected.end()));
+        }
+
+        {
+            vector<keyed> output(testSize);
+            const auto result = unique_copy(par, input.begin(), input.end(), output.begin(), same_key);
+            assert(equal(output.begin(), result, expected.begin(), expected.end()));
+        }
+
+        {
+            list<keyed> output(testSize);
+            const auto result = unique_copy(par, input.begin(), input.end(), output.begin(), same_key);
+            assert(equal(output.begin(), result, expected.begin(), expected.end()));
+        }
+    }
+}
+
+void test_case_sorted_runs() {
+    // long runs that span several chunks
+    for (const size_t runLength : {1U, 7U, 1000U, 20000U}) {
+        vector<unsigned int> input(50000);
+        for (size_t idx = 0; idx < input.size(); ++idx) {
+            input[idx] = static_cast<unsigned int>(idx / runLength);
+        }
+
+        vector<unsigned int> expected(input);
+        expected.erase(unique(expected.begin(), expected.end()), expected.end());
+
+        vector<unsigned int> output(input.size());
+        assert(equal(output.begin(), unique_copy(par, input.begin(), input.end(), output.begin()), expected.begin(),
+            expected.end()));
+
+        auto tested = input;
+        assert(equal(tested.begin(), unique(par, tested.begin(), tested.end()), expected.begin(), expected.end()));
+    }
+}
+
+void test_case_move_only_elements() {
+    vector<unique_ptr<unsigned int>> tested;
+    for (unsigned int idx = 0; idx < 10000; ++idx) {
+        tested.push_back(make_unique<unsigned int>(idx / 3));
+    }
+
+    const auto result = unique(par, tested.begin(), tested.end(),
+        [](const unique_ptr<unsigned int>& lhs, const unique_ptr<unsigned int>& rhs) { return *lhs == *rhs; });
+    assert(result - tested.begin() == 3334);
+    for (unsigned int idx = 0; idx < 3334; ++idx) {
+        assert(*tested[idx] == idx);
+    }
+}
+
+int main() {
+    mt19937 gen(1729);
+    parallel_test_case(test_case_unique_parallel<forward_list>, gen);
+    parallel_test_case(test_case_unique_parallel<list>, gen);
+    parallel_test_case(test_case_unique_parallel<vector>, gen);
+
+    test_case_sorted_runs();
+    test_case_move_only_elements();
+}
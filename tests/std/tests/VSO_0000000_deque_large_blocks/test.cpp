@@ -0,0 +1,147 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <deque>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+template <size_t Size>
+struct bytes {
+    unsigned char vals[Size];
+
+    bytes(const int val = 0) {
+        fill(begin(vals), end(vals), static_cast<unsigned char>(val));
+    }
+
+    friend bool operator==(const bytes& left, const bytes& right) {
+        return equal(begin(left.vals), end(left.vals), begin(right.vals));
+    }
+};
+
+template <class T>
+constexpr int block_size = _Deque_val<_Deque_simple_types<T>>::_Block_size;
+
+// blocks hold at least 16 elements and span at least 512 bytes
+static_assert(block_size<char> == 512, "bad block size");
+static_assert(block_size<int> == 128, "bad block size");
+static_assert(block_size<long long> == 64, "bad block size");
+static_assert(block_size<bytes<24>> == 32, "bad block size");
+static_assert(block_size<bytes<32>> == 16, "bad block size");
+static_assert(block_size<bytes<1000>> == 16, "bad block size");
+
+template <class T>
+void assert_same(const deque<T>& actual, const vector<T>& expected) {
+    assert(actual.size() == expected.size());
+    assert(equal(actual.begin(), actual.end(), expected.begin(), expected.end()));
+    assert(equal(actual.rbegin(), actual.rend(), expected.rbegin(), expected.rend()));
+    for (size_t idx = 0; idx < expected.size(); ++idx) {
+        assert(actual[idx] == expected[idx]);
+        assert(*(actual.begin() + static_cast<ptrdiff_t>(idx)) == expected[idx]);
+        assert(*(actual.end() - static_cast<ptrdiff_t>(expected.size() - idx)) == expected[idx]);
+    }
+}
+
+template <class T>
+void test_against_vector(const unsigned int seed) {
+    mt19937 gen(seed);
+    deque<T> actual;
+    vector<T> expected;
+    for (int op = 0; op < 3000; ++op) {
+        const int val = static_cast<int>(gen() % 256);
+        switch (gen() % 8) {
+        case 0:
+        case 1:
+            actual.push_back(T(val));
+            expected.push_back(T(val));
+            break;
+        case 2:
+        case 3:
+            actual.push_front(T(val));
+            expected.insert(expected.begin(), T(val));
+            break;
+        case 4:
+            if (!expected.empty()) {
+                actual.pop_back();
+                expected.pop_back();
+            }
+            break;
+        case 5:
+            if (!expected.empty()) {
+                actual.pop_front();
+                expected.erase(expected.begin());
+            }
+            break;
+        case 6:
+            {
+                const auto where = static_cast<ptrdiff_t>(gen() % (expected.size() + 1));
+                const auto count = static_cast<size_t>(gen() % 100);
+                actual.insert(actual.begin() + where, count, T(val));
+                expected.insert(expected.begin() + where, count, T(val));
+                break;
+            }
+        default:
+            {
+                const auto first = static_cast<ptrdiff_t>(gen() % (expected.size() + 1));
+                const auto last  = first + static_cast<ptrdiff_t>(gen() % (expected.size() - first + 1));
+                actual.erase(actual.begin() + first, actual.begin() + last);
+                expected.erase(expected.begin() + first, expected.begin() + last);
+                break;
+            }
+        }
+    }
+
+    assert_same(actual, expected);
+
+    actual.shrink_to_fit();
+    assert_same(actual, expected);
+
+    const deque<T> copied(actual);
+    assert_same(copied, expected);
+
+    actual.resize(expected.size() + 1000);
+    expected.resize(expected.size() + 1000);
+    assert_same(actual, expected);
+
+    actual.clear();
+    assert(actual.empty());
+    assert(actual.begin() == actual.end());
+}
+
+void test_strings() {
+    deque<string> d;
+    for (int idx = 0; idx < 1000; ++idx) {
+        d.push_back(to_string(idx));
+        d.push_front(to_string(-idx));
+    }
+
+    for (int idx = 0; idx < 1000; ++idx) {
+        assert(d[static_cast<size_t>(999 - idx)] == to_string(-idx));
+        assert(d[static_cast<size_t>(1000 + idx)] == to_string(idx));
+    }
+
+    while (d.size() > 10) {
+        d.pop_front();
+        d.pop_back();
+    }
+
+    assert(d.front() == "-4");
+    assert(d.back() == "4");
+}
+
+int main() {
+    for (unsigned int seed = 0; seed < 5; ++seed) {
+        test_against_vector<char>(seed);
+        test_against_vector<int>(seed);
+        test_against_vector<bytes<24>>(seed);
+        test_against_vector<bytes<1000>>(seed);
+    }
+
+    test_strings();
+}
@@ -0,0 +1,130 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#if _HAS_CXX17
+#include <string_view>
+#endif // _HAS_CXX17
+
+using namespace std;
+
+template <class T>
+size_t hash_of(const T& val) {
+    return hash<T>{}(val);
+}
+
+// The kernel has separate paths for up to 16 bytes, up to 128 bytes, and longer keys,
+// where the long path works in 64-byte stripes and 512-byte blocks.
+constexpr size_t max_length = 1100;
+
+template <class Elem>
+void test_equal_keys(mt19937_64& gen) {
+    uniform_int_distribution<int> dis(0, 255);
+    basic_string<Elem> str;
+    for (size_t len = 0; len != max_length; ++len) {
+        const auto hashed = hash_of(str);
+
+        // The hash only depends on the characters, not on their address or on the capacity
+        const basic_string<Elem> copied(str.begin(), str.end());
+        assert(hash_of(copied) == hashed);
+
+        basic_string<Elem> shifted(len + 1, Elem{});
+        shifted.assign(str.begin(), str.end());
+        assert(hash_of(shifted) == hashed);
+
+#if _HAS_CXX17
+        assert(hash_of(basic_string_view<Elem>{str}) == hashed);
+
+        const basic_string<Elem> longer = Elem{} + str;
+        assert(hash_of(basic_string_view<Elem>{longer}.substr(1)) == hashed);
+#endif // _HAS_CXX17
+
+        str.push_back(static_cast<Elem>(dis(gen)));
+    }
+}
+
+void test_different_keys(mt19937_64& gen) {
+    uniform_int_distribution<int> dis(0, 255);
+    for (size_t len = 1; len < max_length; len += 1 + len / 16) {
+        string str(len, '\0');
+        for (auto& ch : str) {
+            ch = static_cast<char>(dis(gen));
+        }
+
+        const auto hashed = hash_of(str);
+
+        // Changing any one character or the length changes the hash
+        for (size_t pos = 0; pos != len; ++pos) {
+            const char saved = str[pos];
+            str[pos]         = static_cast<char>(saved ^ 0x20);
+            assert(hash_of(str) != hashed);
+            str[pos] = saved;
+        }
+
+        str.push_back('\0');
+        assert(hash_of(str) != hashed);
+        str.pop_back();
+        str.pop_back();
+        assert(hash_of(str) != hashed);
+    }
+}
+
+void test_unordered_containers() {
+    // Keys that differ only in a few characters, in the middle of each length class
+    vector<string> keys;
+    for (const size_t len : {5, 12, 40, 100, 300, 700}) {
+        for (int idx = 0; idx != 2000; ++idx) {
+            string key(len, '*');
+            const auto digits = to_string(idx);
+            key.replace(len / 2, digits.size(), digits);
+            keys.push_back(key);
+        }
+    }
+
+    unordered_set<string> set(keys.begin(), keys.end());
+    assert(set.size() == keys.size());
+
+    size_t largest_bucket = 0;
+    for (size_t bucket = 0; bucket != set.bucket_count(); ++bucket) {
+        if (set.bucket_size(bucket) > largest_bucket) {
+            largest_bucket = set.bucket_size(bucket);
+        }
+    }
+    assert(largest_bucket < 16);
+
+    unordered_map<string, size_t> map;
+    for (size_t idx = 0; idx != keys.size(); ++idx) {
+        map.emplace(keys[idx], idx);
+    }
+
+    for (size_t idx = 0; idx != keys.size(); ++idx) {
+        const auto found = map.find(keys[idx]);
+        assert(found != map.end());
+        assert(found->second == idx);
+    }
+
+    assert(map.find(string(40, '*')) == map.end());
+}
+
+int main() {
+    mt19937_64 gen(1729);
+
+    test_equal_keys<char>(gen);
+    test_equal_keys<wchar_t>(gen);
+    test_equal_keys<char16_t>(gen);
+    test_equal_keys<char32_t>(gen);
+#ifdef __cpp_char8_t
+    test_equal_keys<char8_t>(gen);
+#endif // defined(__cpp_char8_t)
+
+    test_different_keys(gen);
+    test_unordered_containers();
+}
@@ -0,0 +1,362 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cassert>
+#include <cstddef>
+#include <flat_hash_map>
+#include <flat_hash_set>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#if _HAS_CXX20
+#include <string_view>
+#endif // _HAS_CXX20
+
+using namespace std;
+using stdext::flat_hash_map;
+using stdext::flat_hash_set;
+
+// all keys collide in a handful of groups, exercising long probe sequences
+struct bad_hash {
+    size_t operator()(const int val) const {
+        return static_cast<size_t>(val % 7);
+    }
+};
+
+// leaves the high bits of nearby keys equal; the table must mix the hash before choosing a group
+struct identity_hash {
+    size_t operator()(const int val) const {
+        return static_cast<size_t>(static_cast<unsigned int>(val));
+    }
+};
+
+template <class Map>
+void assert_same_elements(const Map& actual, const unordered_map<int, int>& expected) {
+    assert(actual.size() == expected.size());
+    assert(static_cast<size_t>(distance(actual.begin(), actual.end())) == expected.size());
+    for (const auto& [key, mapped] : actual) {
+        const auto it = expected.find(key);
+        assert(it != expected.end());
+        assert(it->second == mapped);
+    }
+
+    for (const auto& [key, mapped] : expected) {
+        const auto it = actual.find(key);
+        assert(it != actual.end());
+        assert(it->second == mapped);
+    }
+}
+
+template <class Hasher>
+void test_against_unordered_map(const unsigned int seed, const int keyRange, const int operations) {
+    mt19937 gen(seed);
+    flat_hash_map<int, int, Hasher> actual;
+    unordered_map<int, int> expected;
+    for (int idx = 0; idx < operations; ++idx) {
+        const int key = static_cast<int>(gen() % static_cast<unsigned int>(keyRange));
+        switch (gen() % 7) {
+        case 0:
+            {
+                const auto actual_result   = actual.insert({key, idx});
+                const auto expected_result = expected.insert({key, idx});
+                assert(actual_result.second == expected_result.second);
+                assert(actual_result.first->first == key);
+                assert(actual_result.first->second == expected_result.first->second);
+                break;
+            }
+        case 1:
+            actual[key]   = idx;
+            expected[key] = idx;
+            break;
+        case 2:
+            assert(actual.erase(key) == expected.erase(key));
+            break;
+        case 3:
+            if (const auto it = actual.find(key); it != actual.end()) {
+                actual.erase(it);
+                expected.erase(key);
+            }
+            break;
+        case 4:
+            assert(actual.try_emplace(key, idx).second == expected.try_emplace(key, idx).second);
+            break;
+        case 5:
+            actual.insert_or_assign(key, idx);
+            expected.insert_or_assign(key, idx);
+            break;
+        default:
+            assert(actual.count(key) == expected.count(key));
+            assert(actual.contains(key) == (expected.count(key) != 0));
+            break;
+        }
+    }
+
+    assert_same_elements(actual, expected);
+    assert(actual.load_factor() <= actual.max_load_factor());
+
+    auto copied = actual;
+    assert_same_elements(copied, expected);
+    auto moved = move(copied);
+    assert_same_elements(moved, expected);
+    copied = moved;
+    assert_same_elements(copied, expected);
+    copied.rehash(0);
+    assert_same_elements(copied, expected);
+    copied.reserve(10'000);
+    assert(copied.bucket_count() >= 10'000);
+    assert_same_elements(copied, expected);
+
+    for (auto it = copied.begin(); it != copied.end();) {
+        it = copied.erase(it);
+    }
+
+    assert(copied.empty());
+    assert(copied.begin() == copied.end());
+}
+
+void test_erase_churn() {
+    // erasing leaves tombstones behind; they must be reclaimed instead of growing the table forever
+    flat_hash_map<int, int> m;
+    for (int idx = 0; idx < 100'000; ++idx) {
+        m[idx] = idx;
+        if (idx >= 10) {
+            assert(m.erase(idx - 10) == 1);
+        }
+    }
+
+    assert(m.size() == 10);
+    assert(m.bucket_count() < 1000);
+}
+
+void test_identity_hash() {
+    flat_hash_map<int, int, identity_hash> m;
+    for (int idx = 0; idx < 20'000; ++idx) {
+        assert(m.emplace(idx * 128, idx).second);
+        assert(m.emplace(idx * 128 + 1, -idx).second);
+    }
+
+    assert(m.size() == 40'000);
+    for (int idx = 0; idx < 20'000; ++idx) {
+        assert(m.at(idx * 128) == idx);
+        assert(m.at(idx * 128 + 1) == -idx);
+        assert(m.find(idx * 128 + 2) == m.end());
+    }
+}
+
+void test_strings() {
+    flat_hash_map<string, string> m;
+    for (int idx = 0; idx < 1000; ++idx) {
+        m.emplace(to_string(idx), string(40, static_cast<char>('a' + idx % 26)));
+    }
+
+    for (int idx = 0; idx < 1000; idx += 2) {
+        assert(m.erase(to_string(idx)) == 1);
+    }
+
+    for (int idx = 0; idx < 1000; ++idx) {
+        assert(m.count(to_string(idx)) == static_cast<size_t>(idx % 2));
+    }
+
+    flat_hash_map<string, string> other(m.begin(), m.end());
+    assert(m == other);
+    other["x"] = "y";
+    assert(m != other);
+    swap(m, other);
+    assert(m.at("x") == "y");
+    assert(other.count("x") == 0);
+
+    try {
+        (void) other.at("x");
+        assert(false);
+    } catch (const out_of_range&) {
+    }
+
+    // the argument refers to an element of the container, which a growing insertion moves
+    flat_hash_map<string, string> aliased{{"k", "v"}};
+    for (int idx = 0; idx < 100; ++idx) {
+        aliased.emplace(to_string(idx), aliased.begin()->second);
+    }
+
+    for (int idx = 0; idx < 100; ++idx) {
+        assert(aliased.at(to_string(idx)) == "v");
+    }
+
+#if _HAS_CXX20
+    assert(erase_if(aliased, [](const auto& val) { return val.first.size() == 1; }) == 11);
+    assert(aliased.size() == 90);
+#endif // _HAS_CXX20
+}
+
+void test_set() {
+    flat_hash_set<int> s{1, 2, 3, 3, 4};
+    assert(s.size() == 4);
+    s.insert({5, 6});
+    const vector<int> vals{7, 8, 9, 1};
+    s.insert(vals.begin(), vals.end());
+    assert(s.size() == 9);
+
+    const flat_hash_set<int> copied(s);
+    assert(copied == s);
+    for (const int val : copied) {
+        assert(val >= 1 && val <= 9);
+    }
+
+    const auto found = s.equal_range(3);
+    assert(distance(found.first, found.second) == 1);
+    const auto missing = s.equal_range(42);
+    assert(missing.first == s.end());
+    assert(missing.second == s.end());
+
+    s.erase(s.begin(), s.end());
+    assert(s.empty());
+    s = copied;
+    assert(s == copied);
+}
+
+int throw_countdown = -1;
+
+struct throwing_key {
+    int val;
+
+    throwing_key(const int val_) : val(val_) {
+        maybe_throw();
+    }
+
+    throwing_key(const throwing_key& other) : val(other.val) {
+        maybe_throw();
+    }
+
+    static void maybe_throw() {
+        if (throw_countdown > 0 && --throw_countdown == 0) {
+            throw runtime_error{"throwing_key"};
+        }
+    }
+
+    friend bool operator==(const throwing_key& left, const throwing_key& right) {
+        return left.val == right.val;
+    }
+};
+
+struct throwing_key_hash {
+    size_t operator()(const throwing_key& key) const {
+        return hash<int>{}(key.val);
+    }
+};
+
+void test_exceptions() {
+    // an exception during insertion or rehashing leaves a valid container behind
+    for (int countdown = 1; countdown < 100; ++countdown) {
+        flat_hash_map<throwing_key, int, throwing_key_hash> m;
+        throw_countdown = -1;
+        for (int idx = 0; idx < 20; ++idx) {
+            m.emplace(idx, idx);
+        }
+
+        throw_countdown = countdown;
+        try {
+            for (int idx = 20; idx < 100; ++idx) {
+                m.emplace(idx, idx);
+            }
+
+            auto copied = m;
+        } catch (const runtime_error&) {
+        }
+
+        throw_countdown = -1;
+        for (const auto& val : m) {
+            assert(m.find(val.first) != m.end());
+        }
+
+        assert(static_cast<size_t>(distance(m.begin(), m.end())) == m.size());
+        m.emplace(1000, 1000);
+        assert(m.at(1000) == 1000);
+    }
+}
+
+struct nothrow_key_hash {
+    size_t operator()(const throwing_key& key) const noexcept {
+        return hash<int>{}(key.val);
+    }
+};
+
+struct throwing_int_hash {
+    size_t operator()(const int key) const {
+        throwing_key::maybe_throw();
+        return hash<int>{}(key);
+    }
+};
+
+template <class Map>
+void test_strong_rehash() {
+    // a rehash that throws, from the hasher or from copying an element, leaves the container unchanged
+    for (int countdown = 1; countdown < 40; ++countdown) {
+        throw_countdown = -1;
+        Map m;
+        for (int idx = 0; idx < 14; ++idx) {
+            m.emplace(idx, idx * 10);
+        }
+
+        const auto oldBuckets = m.bucket_count();
+        throw_countdown       = countdown;
+        bool threw            = false;
+        try {
+            m.rehash(500);
+        } catch (const runtime_error&) {
+            threw = true;
+        }
+
+        throw_countdown = -1;
+        assert(threw ? m.bucket_count() == oldBuckets : m.bucket_count() >= 500);
+        assert(m.size() == 14);
+        for (int idx = 0; idx < 14; ++idx) {
+            const auto found = m.find(idx);
+            assert(found != m.end() && found->second == idx * 10);
+        }
+    }
+}
+
+#if _HAS_CXX20
+struct string_view_hash {
+    using is_transparent = void;
+
+    size_t operator()(const string_view str) const {
+        return hash<string_view>{}(str);
+    }
+};
+
+void test_transparent_lookup() {
+    flat_hash_map<string, int, string_view_hash, equal_to<>> m;
+    m["hello"] = 1;
+    assert(m.find(string_view{"hello"}) != m.end());
+    assert(m.contains("hello"));
+    assert(m.count(string_view{"world"}) == 0);
+}
+#endif // _HAS_CXX20
+
+int main() {
+    for (unsigned int seed = 0; seed < 10; ++seed) {
+        test_against_unordered_map<hash<int>>(seed, 50, 5000);
+        test_against_unordered_map<hash<int>>(seed, 5000, 20000);
+        test_against_unordered_map<bad_hash>(seed, 300, 4000);
+        test_against_unordered_map<identity_hash>(seed, 5000, 20000);
+    }
+
+    test_erase_churn();
+    test_identity_hash();
+    test_strings();
+    test_set();
+    test_exceptions();
+    test_strong_rehash<flat_hash_map<throwing_key, int, throwing_key_hash>>();
+    test_strong_rehash<flat_hash_map<throwing_key, int, nothrow_key_hash>>();
+    test_strong_rehash<flat_hash_map<int, int, throwing_int_hash>>();
+#if _HAS_CXX20
+    test_transparent_lookup();
+#endif // _HAS_CXX20
+}
@@ -0,0 +1,256 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <random>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+template <class Container>
+void assert_valid(Container& c) {
+    assert(static_cast<size_t>(distance(c.begin(), c.end())) == c.size());
+    assert(is_sorted(c.begin(), c.end(), [&](const auto& left, const auto& right) {
+        return c.value_comp()(left, right);
+    }));
+
+    // erasing every other element, then the rest, rebalances the tree throughout
+    for (auto it = c.begin(); it != c.end();) {
+        it = c.erase(it);
+        if (it != c.end()) {
+            ++it;
+        }
+    }
+
+    assert(static_cast<size_t>(distance(c.begin(), c.end())) == c.size());
+    c.clear();
+    assert(c.begin() == c.end());
+}
+
+vector<int> make_input(mt19937& gen, const size_t size, const int range, const bool sorted) {
+    vector<int> vals(size);
+    for (auto& val : vals) {
+        val = static_cast<int>(gen() % static_cast<unsigned int>(range));
+    }
+
+    if (sorted) {
+        sort(vals.begin(), vals.end());
+    }
+
+    return vals;
+}
+
+void test_construction() {
+    mt19937 gen(1729);
+    for (size_t size = 0; size < 300; ++size) {
+        for (const int range : {3, 100, 100'000}) {
+            for (const bool sorted : {true, false}) {
+                const auto vals = make_input(gen, size, range, sorted);
+
+                set<int> s(vals.begin(), vals.end());
+                set<int> expected_set;
+                for (const int val : vals) {
+                    expected_set.insert(expected_set.end(), val);
+                }
+
+                assert(s == expected_set);
+                assert_valid(s);
+
+                multiset<int> ms(vals.begin(), vals.end());
+                assert(ms.size() == vals.size());
+                for (const int val : expected_set) {
+                    assert(ms.count(val) == static_cast<size_t>(count(vals.begin(), vals.end(), val)));
+                }
+
+                assert_valid(ms);
+            }
+        }
+    }
+
+    {
+        // the first of several equivalent keys is kept, and equivalent keys stay in input order
+        const vector<pair<int, int>> vals{{1, 10}, {1, 11}, {2, 20}, {3, 30}, {3, 31}, {3, 32}, {4, 40}};
+        const map<int, int> m(vals.begin(), vals.end());
+        assert((m == map<int, int>{{1, 10}, {2, 20}, {3, 30}, {4, 40}}));
+
+        const multimap<int, int> mm(vals.begin(), vals.end());
+        assert(equal(mm.begin(), mm.end(), vals.begin(), vals.end(), [](const auto& left, const auto& right) {
+            return left.first == right.first && left.second == right.second;
+        }));
+    }
+
+    {
+        // the ascending prefix is built at once, the rest is inserted one at a time
+        const vector<int> vals{1, 2, 3, 4, 5, 3, 0, 6, 5, 9, 8};
+        set<int> s(vals.begin(), vals.end());
+        assert((s == set<int>{0, 1, 2, 3, 4, 5, 6, 8, 9}));
+        assert_valid(s);
+
+        multiset<int> ms(vals.begin(), vals.end());
+        assert((ms == multiset<int>{0, 1, 2, 3, 3, 4, 5, 5, 6, 8, 9}));
+        assert_valid(ms);
+
+        set<int, greater<int>> descending(vals.begin(), vals.end());
+        assert((descending == set<int, greater<int>>{0, 1, 2, 3, 4, 5, 6, 8, 9}));
+        assert_valid(descending);
+    }
+
+    {
+        // inserting into a nonempty tree, and from input iterators
+        set<int> s{10, 20};
+        const vector<int> vals{1, 2, 3, 30, 40};
+        s.insert(vals.begin(), vals.end());
+        assert((s == set<int>{1, 2, 3, 10, 20, 30, 40}));
+
+        istringstream stream("1 2 2 3 5 4");
+        const multiset<int> ms(istream_iterator<int>{stream}, istream_iterator<int>{});
+        assert((ms == multiset<int>{1, 2, 2, 3, 4, 5}));
+
+        set<int> il;
+        il = {5, 6, 7, 8};
+        assert(il.size() == 4);
+        assert(*il.begin() == 5);
+    }
+}
+
+int throw_countdown = -1;
+
+struct throwing_int {
+    int val;
+
+    throwing_int(const int val_) : val(val_) {}
+
+    throwing_int(const throwing_int& other) : val(other.val) {
+        if (throw_countdown > 0 && --throw_countdown == 0) {
+            throw runtime_error{"throwing_int"};
+        }
+    }
+
+    throwing_int& operator=(const throwing_int&) = default;
+
+    friend bool operator<(const throwing_int& left, const throwing_int& right) {
+        return left.val < right.val;
+    }
+};
+
+void test_exceptions() {
+    // an exception during a range insertion keeps the elements inserted before it
+    vector<throwing_int> vals;
+    for (int val = 0; val < 100; ++val) {
+        vals.emplace_back(val);
+    }
+
+    vals.emplace_back(50);
+    vals.emplace_back(200);
+
+    for (int countdown = 1; countdown < 110; ++countdown) {
+        set<throwing_int> s;
+        throw_countdown = countdown;
+        try {
+            s.insert(vals.begin(), vals.end());
+        } catch (const runtime_error&) {
+            assert(s.size() == static_cast<size_t>(min(countdown - 1, 100)));
+        }
+
+        throw_countdown = -1;
+        int expected = 0;
+        for (const auto& elem : s) {
+            assert(elem.val == (expected == 100 ? 200 : expected));
+            ++expected;
+        }
+
+        s.insert(throwing_int{-1});
+        assert(s.begin()->val == -1);
+        assert_valid(s);
+    }
+}
+
+#if _HAS_CXX17
+template <class Target, class Source>
+void test_merge_sizes(mt19937& gen, const size_t target_size, const size_t source_size, const int range) {
+    const auto target_vals = make_input(gen, target_size, range, false);
+    const auto source_vals = make_input(gen, source_size, range, false);
+    Target target(target_vals.begin(), target_vals.end());
+    Source source(source_vals.begin(), source_vals.end());
+
+    multiset<int> expected_all(target.begin(), target.end());
+    expected_all.insert(source.begin(), source.end());
+
+    const auto source_first = source.begin();
+    const auto source_value = source_first == source.end() ? 0 : *source_first;
+    const bool moves        = source_first != source.end() && target.count(source_value) == 0;
+
+    target.merge(source);
+
+    // every element ends up in exactly one of the containers
+    multiset<int> actual_all(target.begin(), target.end());
+    actual_all.insert(source.begin(), source.end());
+    assert(actual_all == expected_all);
+
+    for (const int val : source) {
+        assert(target.count(val) != 0);
+    }
+
+    if (moves) { // iterators to merged elements remain valid, and now refer into target
+        assert(*source_first == source_value);
+        assert(target.find(source_value) != target.end());
+        size_t position = 0;
+        for (auto it = target.begin(); it != source_first; ++it) {
+            ++position;
+        }
+
+        assert(position < target.size());
+    }
+
+    assert_valid(target);
+    assert_valid(source);
+}
+
+void test_merge() {
+    mt19937 gen(1234);
+    // similar sizes relink both trees in linear time; a small source is inserted node by node
+    for (const size_t target_size : {0, 1, 10, 100, 2000}) {
+        for (const size_t source_size : {0, 1, 10, 100, 2000}) {
+            for (const int range : {10, 1000, 1'000'000}) {
+                test_merge_sizes<set<int>, set<int>>(gen, target_size, source_size, range);
+                test_merge_sizes<set<int>, multiset<int>>(gen, target_size, source_size, range);
+                test_merge_sizes<multiset<int>, set<int>>(gen, target_size, source_size, range);
+                test_merge_sizes<multiset<int>, multiset<int>>(gen, target_size, source_size, range);
+                test_merge_sizes<set<int, greater<int>>, multiset<int>>(gen, target_size, source_size, range);
+            }
+        }
+    }
+
+    {
+        // equivalent elements of the target come first, then those of the source in order
+        multimap<int, int> target{{1, 0}, {2, 0}, {2, 1}};
+        multimap<int, int> source{{0, 2}, {2, 2}, {2, 3}, {3, 2}};
+        target.merge(source);
+        assert(source.empty());
+        assert((target == multimap<int, int>{{0, 2}, {1, 0}, {2, 0}, {2, 1}, {2, 2}, {2, 3}, {3, 2}}));
+
+        map<int, int> unique_target{{1, 0}, {2, 0}};
+        multimap<int, int> duplicates{{1, 1}, {1, 2}, {3, 1}, {3, 2}};
+        unique_target.merge(duplicates);
+        assert((unique_target == map<int, int>{{1, 0}, {2, 0}, {3, 1}}));
+        assert((duplicates == multimap<int, int>{{1, 1}, {1, 2}, {3, 2}}));
+    }
+}
+#endif // _HAS_CXX17
+
+int main() {
+    test_construction();
+    test_exceptions();
+#if _HAS_CXX17
+    test_merge();
+#endif // _HAS_CXX17
+}
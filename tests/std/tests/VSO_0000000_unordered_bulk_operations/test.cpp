@@ -0,0 +1,258 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+using namespace std;
+
+size_t hash_calls = 0;
+
+struct counting_hash {
+    size_t operator()(const int val) const {
+        ++hash_calls;
+        return hash<int>{}(val);
+    }
+};
+
+void test_range_insert() {
+    // inserting a forward range grows the buckets once for the rest of the range, instead of once per doubling
+    constexpr int elements = 100'000;
+    vector<int> vals;
+    for (int val = 0; val < elements; ++val) {
+        vals.push_back(val);
+    }
+
+    {
+        unordered_set<int, counting_hash> s;
+        hash_calls = 0;
+        s.insert(vals.begin(), vals.end());
+        assert(s.size() == static_cast<size_t>(elements));
+        assert(hash_calls < static_cast<size_t>(elements) + 64);
+        assert(s.load_factor() <= s.max_load_factor());
+        for (int val = 0; val < elements; ++val) {
+            assert(s.count(val) == 1);
+        }
+    }
+
+    {
+        // duplicates don't grow the buckets before an insertion needs them
+        const vector<int> dups(elements, 42);
+        unordered_multiset<int> ms(dups.begin(), dups.end());
+        assert(ms.count(42) == static_cast<size_t>(elements));
+        unordered_set<int> s(dups.begin(), dups.end());
+        assert(s.size() == 1);
+        assert(s.bucket_count() < 64);
+    }
+
+    {
+        unordered_map<int, int> m;
+        for (int val = 0; val < 1000; ++val) {
+            m.emplace(val, val);
+        }
+
+        unordered_map<int, int> other;
+        other.insert(m.begin(), m.end());
+        assert(other == m);
+    }
+
+    {
+        // input iterators are inserted one at a time
+        istringstream stream("1 2 3 2 1");
+        unordered_multiset<int> ms(istream_iterator<int>{stream}, istream_iterator<int>{});
+        assert(ms.size() == 5);
+        assert(ms.count(1) == 2);
+    }
+}
+
+template <class Container>
+void assert_buckets_consistent(const Container& c) {
+    size_t elements = 0;
+    for (size_t bucket = 0; bucket < c.bucket_count(); ++bucket) {
+        for (auto it = c.begin(bucket); it != c.end(bucket); ++it) {
+            assert(c.bucket(*it) == bucket);
+            ++elements;
+        }
+    }
+
+    assert(elements == c.size());
+}
+
+template <class Map>
+void assert_map_buckets_consistent(const Map& m) {
+    size_t elements = 0;
+    for (size_t bucket = 0; bucket < m.bucket_count(); ++bucket) {
+        for (auto it = m.begin(bucket); it != m.end(bucket); ++it) {
+            assert(m.bucket(it->first) == bucket);
+            ++elements;
+        }
+    }
+
+    assert(elements == m.size());
+}
+
+void test_range_insert_batches() {
+    // keys are hashed in batches ahead of insertion; exercise ranges that end inside, at, and after a batch
+    for (int count = 0; count <= 70; ++count) {
+        vector<int> keys;
+        vector<pair<int, string>> vals;
+        for (int i = 0; i < count; ++i) {
+            keys.push_back(i % 23);
+            vals.emplace_back(i % 23, string(30, static_cast<char>('a' + i % 23)));
+        }
+
+        const auto expected_count = [&](const int key) {
+            return static_cast<size_t>(count / 23 + (key < count % 23 ? 1 : 0));
+        };
+
+        unordered_set<int> s(keys.begin(), keys.end());
+        unordered_multiset<int> ms(keys.begin(), keys.end());
+        assert(s.size() == static_cast<size_t>(count < 23 ? count : 23));
+        assert(ms.size() == static_cast<size_t>(count));
+        for (int key = 0; key < 23; ++key) {
+            assert(s.count(key) == (expected_count(key) != 0 ? 1u : 0u));
+            assert(ms.count(key) == expected_count(key));
+        }
+
+        assert_buckets_consistent(s);
+        assert_buckets_consistent(ms);
+
+        unordered_map<int, string> m;
+        unordered_multimap<int, string> mm;
+        m.insert(vals.begin(), vals.end());
+        mm.insert(make_move_iterator(vals.begin()), make_move_iterator(vals.end()));
+        assert(m.size() == s.size());
+        assert(mm.size() == ms.size());
+        for (int key = 0; key < 23; ++key) {
+            if (expected_count(key) != 0) {
+                assert(m.at(key) == string(30, static_cast<char>('a' + key)));
+            }
+
+            const auto range = mm.equal_range(key);
+            assert(static_cast<size_t>(distance(range.first, range.second)) == expected_count(key));
+            for (auto it = range.first; it != range.second; ++it) {
+                assert(it->second == string(30, static_cast<char>('a' + key)));
+            }
+        }
+
+        assert_map_buckets_consistent(m);
+        assert_map_buckets_consistent(mm);
+    }
+}
+
+void test_erase_keys() {
+    // stdext::erase_keys() erases each key's elements, hashing each key once
+    unordered_map<int, int, counting_hash> m;
+    unordered_multiset<int, counting_hash> ms;
+    for (int val = 0; val < 1000; ++val) {
+        m.emplace(val, val);
+        ms.insert(val % 100);
+    }
+
+    vector<int> keys;
+    for (int key = 0; key < 2000; key += 3) {
+        keys.push_back(key);
+    }
+
+    keys.push_back(3); // duplicate keys erase nothing more
+
+    hash_calls = 0;
+    assert(stdext::erase_keys(m, keys.begin(), keys.end()) == 334);
+    assert(hash_calls == keys.size());
+    assert(m.size() == 666);
+    for (int val = 0; val < 1000; ++val) {
+        assert(m.count(val) == static_cast<size_t>(val % 3 != 0));
+    }
+
+    assert_map_buckets_consistent(m);
+
+    assert(stdext::erase_keys(ms, keys.begin(), keys.end()) == 340);
+    assert(ms.size() == 660);
+    for (int val = 0; val < 100; ++val) {
+        assert(ms.count(val) == (val % 3 == 0 ? 0u : 10u));
+    }
+
+    assert_buckets_consistent(ms);
+
+    assert(stdext::erase_keys(m, keys.begin(), keys.begin()) == 0);
+    assert(m.size() == 666);
+
+    unordered_set<string> s{"apple", "banana", "cherry"};
+    const string fruit[] = {"cherry", "durian", "apple"};
+    assert(stdext::erase_keys(s, begin(fruit), end(fruit)) == 2);
+    assert(s.size() == 1);
+    assert(s.count("banana") == 1);
+}
+
+#if _HAS_CXX20
+void test_erase_if() {
+    unordered_map<int, int, counting_hash> m;
+    for (int val = 0; val < 10'000; ++val) {
+        m.emplace(val, val * 2);
+    }
+
+    // the predicate sees the elements in iteration order
+    vector<int> expected_order;
+    for (const auto& [key, mapped] : m) {
+        expected_order.push_back(key);
+    }
+
+    vector<int> order;
+    hash_calls = 0;
+    const auto erased = erase_if(m, [&](const pair<const int, int>& val) {
+        order.push_back(val.first);
+        return val.first % 3 == 0;
+    });
+
+    assert(order == expected_order);
+    assert(erased == 3334);
+    assert(m.size() == 6666);
+    assert(hash_calls <= m.bucket_count());
+    for (int val = 0; val < 10'000; ++val) {
+        assert(m.count(val) == static_cast<size_t>(val % 3 != 0));
+    }
+
+    for (size_t bucket = 0; bucket < m.bucket_count(); ++bucket) {
+        for (auto it = m.begin(bucket); it != m.end(bucket); ++it) {
+            assert(m.bucket(it->first) == bucket);
+        }
+    }
+
+    assert(erase_if(m, [](const auto&) { return true; }) == 6666);
+    assert(m.empty());
+    m.emplace(1, 1);
+    assert(m.at(1) == 1);
+
+    unordered_multiset<int> ms;
+    for (int val = 0; val < 1000; ++val) {
+        ms.insert(val % 100);
+    }
+
+    assert(erase_if(ms, [](const int val) { return val >= 50; }) == 500);
+    assert(ms.size() == 500);
+    for (int val = 0; val < 100; ++val) {
+        const auto range = ms.equal_range(val);
+        assert(distance(range.first, range.second) == (val < 50 ? 10 : 0));
+    }
+
+    unordered_set<int> s{1, 2, 3};
+    assert(erase_if(s, [](const int val) { return val == 4; }) == 0);
+    assert(s.size() == 3);
+}
+#endif // _HAS_CXX20
+
+int main() {
+    test_range_insert();
+    test_range_insert_batches();
+    test_erase_keys();
+#if _HAS_CXX20
+    test_erase_if();
+#endif // _HAS_CXX20
+}
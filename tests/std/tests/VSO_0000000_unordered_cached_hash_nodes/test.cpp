@@ -0,0 +1,265 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+using namespace std;
+
+static_assert(is_same_v<decltype(_Unordered_node<int, void*>::_Hashval), size_t>, "nodes should store hashes");
+
+size_t hash_calls  = 0;
+size_t equal_calls = 0;
+
+// every hash is distinct, but their low bits are zero, so many elements share each bucket
+struct counting_hash {
+    size_t operator()(const int val) const {
+        ++hash_calls;
+        return static_cast<size_t>(val) << 10;
+    }
+};
+
+struct counting_equal {
+    bool operator()(const int left, const int right) const {
+        ++equal_calls;
+        return left == right;
+    }
+};
+
+using set_type      = unordered_set<int, counting_hash, counting_equal>;
+using multiset_type = unordered_multiset<int, counting_hash, counting_equal>;
+using map_type      = unordered_map<int, int, counting_hash, counting_equal>;
+using multimap_type = unordered_multimap<int, int, counting_hash, counting_equal>;
+
+template <class Container>
+constexpr bool is_multi = is_same_v<Container, multiset_type> || is_same_v<Container, multimap_type>;
+
+int key_of(const int val) {
+    return val;
+}
+
+int key_of(const pair<const int, int>& val) {
+    return val.first;
+}
+
+template <class Container>
+void add(Container& c, const int key) {
+    if constexpr (is_same_v<typename Container::key_type, typename Container::value_type>) {
+        c.insert(key);
+    } else {
+        c.emplace(key, -key);
+    }
+}
+
+template <class Container>
+Container make(const int keys) {
+    Container c;
+    for (int copy = 0; copy < (is_multi<Container> ? 2 : 1); ++copy) {
+        for (int key = 0; key < keys; ++key) {
+            add(c, key);
+        }
+    }
+
+    return c;
+}
+
+template <class Container>
+void assert_valid(const Container& c, const int keys) {
+    const size_t copies = is_multi<Container> ? 2 : 1;
+    assert(c.size() == static_cast<size_t>(keys) * copies);
+    assert(static_cast<size_t>(distance(c.begin(), c.end())) == c.size());
+
+    size_t elements = 0;
+    for (size_t bucket = 0; bucket < c.bucket_count(); ++bucket) {
+        assert(c.bucket_size(bucket) == static_cast<size_t>(distance(c.begin(bucket), c.end(bucket))));
+        for (auto it = c.begin(bucket); it != c.end(bucket); ++it) {
+            assert(c.bucket(key_of(*it)) == bucket);
+            ++elements;
+        }
+    }
+
+    assert(elements == c.size());
+    for (int key = 0; key < keys; ++key) {
+        const auto range = c.equal_range(key);
+        assert(static_cast<size_t>(distance(range.first, range.second)) == copies);
+        for (auto it = range.first; it != range.second; ++it) {
+            assert(key_of(*it) == key);
+        }
+    }
+}
+
+template <class Container>
+void test_rehash() {
+    // rehashing reuses the stored hashes
+    auto c = make<Container>(1000);
+    hash_calls  = 0;
+    equal_calls = 0;
+    c.rehash(4096);
+    assert(hash_calls == 0);
+    if constexpr (!is_multi<Container>) {
+        assert(equal_calls == 0);
+    }
+
+    assert_valid(c, 1000);
+}
+
+template <class Container>
+void test_lookup() {
+    // the key equality predicate is called only for elements with the same hash
+    Container c;
+    c.max_load_factor(100.0f);
+    equal_calls = 0;
+    for (int key = 0; key < 100; ++key) {
+        add(c, key);
+    }
+
+    assert(c.bucket_count() < 100);
+    if constexpr (!is_multi<Container>) {
+        assert(equal_calls == 0);
+    }
+
+    equal_calls = 0;
+    assert(c.find(42) != c.end());
+    assert(equal_calls == 1);
+
+    equal_calls = 0;
+    assert(c.find(1000) == c.end());
+    assert(c.count(1000) == 0);
+    assert(c.erase(1000) == 0);
+    assert(equal_calls == 0);
+
+    equal_calls = 0;
+    assert(c.count(42) == 1);
+    assert(c.erase(42) == 1);
+    assert(c.find(42) == c.end());
+    assert(equal_calls <= 3);
+}
+
+template <class Container>
+void test_copy_and_move() {
+    // copies take the stored hashes too
+    const auto original = make<Container>(500);
+    hash_calls          = 0;
+    Container copied(original);
+    assert(hash_calls == 0);
+    assert_valid(copied, 500);
+
+    Container assigned = make<Container>(20);
+    hash_calls         = 0;
+    assigned           = original;
+    assert(hash_calls == 0);
+    assert_valid(assigned, 500);
+
+    hash_calls = 0;
+    Container moved(move(copied));
+    assigned = move(moved);
+    assert(hash_calls == 0);
+    assert_valid(assigned, 500);
+    assert(assigned == original);
+}
+
+template <class Container>
+void test_erase() {
+    auto c = make<Container>(1000);
+    for (auto it = c.begin(); it != c.end();) {
+        if (key_of(*it) % 3 == 0) {
+            it = c.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    auto first = c.begin();
+    advance(first, 10);
+    auto last = first;
+    advance(last, 100);
+    const auto erased_key = key_of(*first);
+    c.erase(first, last);
+    if constexpr (!is_multi<Container>) {
+        assert(c.count(erased_key) == 0);
+    }
+
+    assert(static_cast<size_t>(distance(c.begin(), c.end())) == c.size());
+
+    hash_calls = 0;
+    c.rehash(8192);
+    assert(hash_calls == 0);
+    for (int key = 0; key < 1000; key += 3) {
+        assert(c.find(key) == c.end());
+    }
+
+    c.clear();
+    assert(c.empty());
+    assert_valid(c, 0);
+    add(c, 7);
+    assert(c.count(7) == 1);
+
+#if _HAS_CXX20
+    auto d     = make<Container>(1000);
+    hash_calls = 0;
+    erase_if(d, [](const auto& val) { return key_of(val) >= 500; });
+    assert(hash_calls == 0);
+    assert_valid(d, 500);
+#endif // _HAS_CXX20
+}
+
+template <class Container>
+void test_nodes() {
+    auto source = make<Container>(200);
+    Container target;
+    for (int key = 0; key < 200; key += 2) {
+        auto handle = source.extract(key);
+        assert(!handle.empty());
+        target.insert(move(handle));
+    }
+
+    if constexpr (!is_multi<Container>) {
+        add(target, 201);
+        add(source, 201);
+    }
+
+    target.merge(source);
+    if constexpr (is_multi<Container>) {
+        assert(source.empty());
+    } else {
+        assert(source.size() == 1);
+        assert(target.erase(201) == 1);
+    }
+
+    assert_valid(target, 200);
+
+    hash_calls = 0;
+    target.rehash(2048);
+    assert(hash_calls == 0);
+    assert_valid(target, 200);
+}
+
+int main() {
+    test_rehash<set_type>();
+    test_rehash<multiset_type>();
+    test_rehash<map_type>();
+    test_rehash<multimap_type>();
+
+    test_lookup<set_type>();
+    test_lookup<map_type>();
+
+    test_copy_and_move<set_type>();
+    test_copy_and_move<multiset_type>();
+    test_copy_and_move<map_type>();
+    test_copy_and_move<multimap_type>();
+
+    test_erase<set_type>();
+    test_erase<multiset_type>();
+    test_erase<map_type>();
+    test_erase<multimap_type>();
+
+    test_nodes<set_type>();
+    test_nodes<multiset_type>();
+    test_nodes<map_type>();
+    test_nodes<multimap_type>();
+}
@@ -0,0 +1,96 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <unordered_map>
+#include <unordered_set>
+
+using namespace std;
+
+size_t equal_calls = 0;
+
+// a few values per hash code, so that buckets hold several elements
+struct coarse_hash {
+    size_t operator()(const int val) const {
+        return static_cast<size_t>(val / 4);
+    }
+};
+
+struct counting_equal {
+    bool operator()(const int left, const int right) const {
+        ++equal_calls;
+        return left == right;
+    }
+};
+
+template <class Container>
+void fill(Container& c, const int copies) {
+    c.max_load_factor(8.0f);
+    for (int val = 0; val < 1000; ++val) {
+        for (int copy = 0; copy < copies; ++copy) {
+            c.insert(val);
+        }
+    }
+}
+
+void test_unique() {
+    // rehashing a container with unique keys never compares keys
+    unordered_set<int, coarse_hash, counting_equal> s;
+    fill(s, 1);
+
+    unordered_map<int, size_t> old_position;
+    for (const int val : s) {
+        old_position.emplace(val, old_position.size());
+    }
+
+    equal_calls = 0;
+    s.rehash(4096);
+    assert(equal_calls == 0);
+
+    for (int val = 0; val < 1000; ++val) {
+        assert(s.count(val) == 1);
+    }
+
+    // rehashing moves each element to the front of its bucket, reversing the old order of the bucket's elements
+    size_t elements = 0;
+    for (size_t bucket = 0; bucket < s.bucket_count(); ++bucket) {
+        size_t last_position = old_position.size();
+        for (auto it = s.begin(bucket); it != s.end(bucket); ++it) {
+            assert(s.bucket(*it) == bucket);
+            assert(old_position[*it] < last_position);
+            last_position = old_position[*it];
+            ++elements;
+        }
+    }
+
+    assert(elements == s.size());
+}
+
+void test_multi() {
+    // rehashing a container with equivalent keys keeps them adjacent
+    unordered_multiset<int, coarse_hash, counting_equal> s;
+    fill(s, 2);
+    s.rehash(4096);
+    for (int val = 0; val < 1000; ++val) {
+        const auto range = s.equal_range(val);
+        assert(distance(range.first, range.second) == 2);
+    }
+
+    unordered_multimap<int, int> m;
+    for (int val = 0; val < 1000; ++val) {
+        m.emplace(val % 100, val);
+    }
+
+    m.rehash(1024);
+    for (int val = 0; val < 100; ++val) {
+        const auto range = m.equal_range(val);
+        assert(distance(range.first, range.second) == 10);
+    }
+}
+
+int main() {
+    test_unique();
+    test_multi();
+}
@@ -26,8 +26,15 @@
 #include <ranges>
 #endif // _HAS_CXX20
 
+#if _HAS_CXX23
+#include <flat_set>
+#endif // _HAS_CXX23
+
+#include <test_binary_search_support.hpp>
+#include <test_heap_support.hpp>
 #include <test_is_sorted_until_support.hpp>
 #include <test_min_max_element_support.hpp>
+#include <test_sort_support.hpp>
 #include <test_vector_algorithms_support.hpp>
 
 using namespace std;
@@ -64,6 +71,17 @@ void test_case_adj_diff(const vector<T>& input, vector<T>& output_expected, vect
 
     assert(actual - output_actual.begin() == expected - output_expected.begin());
     assert(output_actual == output_expected);
+
+    if constexpr (sizeof(T) >= sizeof(int)) { // minus<> doesn't truncate for these types
+        const auto actual_minus = adjacent_difference(input.begin(), input.end(), output_actual.begin());
+        assert(actual_minus - output_actual.begin() == expected - output_expected.begin());
+        assert(output_actual == output_expected);
+
+        // also test where dest == first
+        output_actual = input;
+        adjacent_difference(output_actual.begin(), output_actual.end(), output_actual.begin());
+        assert(output_actual == output_expected);
+    }
 }
 
 template <class T>
@@ -105,6 +123,113 @@ void test_adjacent_difference_with_heterogeneous_types() {
     assert(output == expected);
 }
 
+template <class T>
+void test_case_reduce(const vector<T>& input1, const vector<T>& input2, const T init) {
+    unsigned long long expected_sum = static_cast<unsigned long long>(init);
+    unsigned long long expected_dot = static_cast<unsigned long long>(init);
+    for (size_t i = 0; i != input1.size(); ++i) {
+        expected_sum += static_cast<unsigned long long>(input1[i]);
+        expected_dot += static_cast<unsigned long long>(input1[i]) * static_cast<unsigned long long>(input2[i]);
+    }
+
+    assert(accumulate(input1.begin(), input1.end(), init) == static_cast<T>(expected_sum));
+    assert(inner_product(input1.begin(), input1.end(), input2.begin(), init) == static_cast<T>(expected_dot));
+
+#if _HAS_CXX17
+    assert(reduce(input1.begin(), input1.end(), init) == static_cast<T>(expected_sum));
+    assert(transform_reduce(input1.begin(), input1.end(), input2.begin(), init) == static_cast<T>(expected_dot));
+#endif // _HAS_CXX17
+}
+
+template <class T>
+void test_reduce(mt19937_64& gen) {
+    using Limits = numeric_limits<T>;
+
+    // Unsigned arithmetic wraps around, and products of bytes always fit in int, so these types use the full range.
+    // Other types use small values, so that neither T (when it's at least int) nor int (when T is promoted) overflows.
+    constexpr bool full_range = (is_unsigned_v<T> && sizeof(T) >= sizeof(int)) || sizeof(T) == 1;
+    constexpr T min_val       = full_range ? Limits::min() : static_cast<T>(is_signed_v<T> ? -1000 : 0);
+    constexpr T max_val       = full_range ? Limits::max() : static_cast<T>(1000);
+
+    uniform_int_distribution<conditional_t<sizeof(T) == 1, int, T>> dis(min_val, max_val);
+
+    vector<T> input1;
+    vector<T> input2;
+    input1.reserve(dataCount);
+    input2.reserve(dataCount);
+
+    test_case_reduce(input1, input2, T{0});
+    for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+        input1.push_back(static_cast<T>(dis(gen)));
+        input2.push_back(static_cast<T>(dis(gen)));
+        test_case_reduce(input1, input2, static_cast<T>(dis(gen)));
+    }
+}
+
+template <class T>
+void test_case_scan(const vector<T>& input, const T init) {
+    vector<T> expected_partial(input.size());
+    vector<T> expected_inclusive(input.size());
+    vector<T> expected_exclusive(input.size());
+    unsigned long long partial = 0;
+    unsigned long long sum     = static_cast<unsigned long long>(init);
+    for (size_t i = 0; i != input.size(); ++i) {
+        expected_exclusive[i] = static_cast<T>(sum);
+
+        partial += static_cast<unsigned long long>(input[i]);
+        sum += static_cast<unsigned long long>(input[i]);
+
+        expected_partial[i]   = static_cast<T>(partial);
+        expected_inclusive[i] = static_cast<T>(sum);
+    }
+
+    vector<T> output(input.size());
+    assert(partial_sum(input.begin(), input.end(), output.begin()) == output.end());
+    assert(output == expected_partial);
+
+    // also test where dest == first
+    output = input;
+    partial_sum(output.begin(), output.end(), output.begin());
+    assert(output == expected_partial);
+
+#if _HAS_CXX17
+    assert(inclusive_scan(input.begin(), input.end(), output.begin()) == output.end());
+    assert(output == expected_partial);
+
+    assert(inclusive_scan(input.begin(), input.end(), output.begin(), plus<>{}, init) == output.end());
+    assert(output == expected_inclusive);
+
+    assert(exclusive_scan(input.begin(), input.end(), output.begin(), init) == output.end());
+    assert(output == expected_exclusive);
+
+    output = input;
+    exclusive_scan(output.begin(), output.end(), output.begin(), init);
+    assert(output == expected_exclusive);
+#endif // _HAS_CXX17
+}
+
+template <class T>
+void test_scan(mt19937_64& gen) {
+    using Limits = numeric_limits<T>;
+
+    // Unsigned arithmetic wraps around, and types smaller than int are promoted, so these types use the full range.
+    // Other types use small values, so that partial sums of dataCount elements don't overflow.
+    constexpr bool full_range = is_unsigned_v<T> || sizeof(T) < sizeof(int);
+    constexpr T min_val       = full_range ? Limits::min() : static_cast<T>(-1000);
+    constexpr T max_val       = full_range ? Limits::max() : static_cast<T>(1000);
+
+    uniform_int_distribution<conditional_t<sizeof(T) == 1, int, T>> dis(min_val, max_val);
+
+    vector<T> input;
+    input.reserve(dataCount);
+
+    test_case_scan(input, T{0});
+    for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+        input.push_back(static_cast<T>(dis(gen)));
+        test_case_scan(input, static_cast<T>(dis(gen)));
+    }
+}
+
 template <class FwdIt>
 FwdIt last_known_good_adj_find(FwdIt first, FwdIt last) {
     if (first == last) {
@@ -543,6 +668,107 @@ void test_search(mt19937_64& gen) {
     }
 }
 
+// Elements whose size is 16 bytes or a fixed stride of 3, 6, 12, 24, 32, 48, or 64 bytes.
+// Components take only the values 0 and 1, and repeat every three, so that unequal elements often share some lanes.
+template <class T, size_t N>
+void assign_wide(array<T, N>& arr, const unsigned int val) {
+    for (size_t i = 0; i != N; ++i) {
+        arr[i] = static_cast<T>((val >> (i % 3)) & 1);
+    }
+}
+
+template <class T, class U>
+void assign_wide(pair<T, U>& pr, const unsigned int val) {
+    pr.first  = static_cast<T>(val & 1);
+    pr.second = static_cast<U>((val >> 1) & 3);
+}
+
+#if _HAS_CXX20
+// With a defaulted operator==, Clang can tell that these are trivially equality comparable, so they reach the kernels
+template <class T, size_t N>
+struct wide {
+    T vals[N];
+
+    bool operator==(const wide&) const = default;
+};
+
+template <class T, size_t N>
+void assign_wide(wide<T, N>& w, const unsigned int val) {
+    for (size_t i = 0; i != N; ++i) {
+        w.vals[i] = static_cast<T>((val >> (i % 3)) & 1);
+    }
+}
+#endif // _HAS_CXX20
+
+template <class T>
+void test_wide_elements(mt19937_64& gen) {
+    uniform_int_distribution<unsigned int> dis(0, 7);
+    const auto random_wide = [&] {
+        T val;
+        assign_wide(val, dis(gen));
+        return val;
+    };
+
+    vector<T> input;
+    input.reserve(dataCount);
+    test_case_find(input, random_wide());
+    test_case_count(input, random_wide());
+    for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+        input.push_back(random_wide());
+        test_case_find(input, random_wide());
+        test_case_count(input, random_wide());
+    }
+
+    vector<T> input_haystack;
+    vector<T> input_needle;
+    for (size_t haystack_size = 0; haystack_size <= haystackDataCount; haystack_size += 1 + haystack_size / 4) {
+        input_haystack.resize(haystack_size);
+        generate(input_haystack.begin(), input_haystack.end(), random_wide);
+
+        input_needle.clear();
+        test_case_search(input_haystack, input_needle);
+        for (size_t attempts = 0; attempts < needleDataCount; ++attempts) {
+            input_needle.push_back(random_wide());
+            test_case_search(input_haystack, input_needle);
+
+            // Guarantee a match, since random needles of more than a few elements won't be found
+            if (input_haystack.size() > input_needle.size()) {
+                uniform_int_distribution<size_t> pos_dis(0, input_haystack.size() - input_needle.size());
+                auto copied = input_haystack;
+                copy(input_needle.begin(), input_needle.end(), copied.begin() + static_cast<ptrdiff_t>(pos_dis(gen)));
+                test_case_search(copied, input_needle);
+                assert(equal(input_needle.begin(), input_needle.end(),
+                    search(copied.begin(), copied.end(), input_needle.begin(), input_needle.end())));
+            }
+        }
+    }
+}
+
+// pair and array compare their members with ==, which can find a user's overload that isn't bytewise
+enum class parity : unsigned char { zero, one, two, three };
+
+bool operator==(const parity left, const parity right) {
+    return ((static_cast<int>(left) ^ static_cast<int>(right)) & 1) == 0;
+}
+
+void test_user_equality_members() {
+    using P = pair<parity, unsigned char>;
+    const vector<P> pairs{{parity::zero, 1}, {parity::one, 1}, {parity::two, 1}, {parity::three, 1}};
+    assert(find(pairs.begin(), pairs.end(), P{parity::three, 1}) == pairs.begin() + 1);
+    assert(count(pairs.begin(), pairs.end(), P{parity::zero, 1}) == 2);
+    const vector<P> needle{{parity::three, 1}, {parity::zero, 1}};
+    assert(search(pairs.begin(), pairs.end(), needle.begin(), needle.end()) == pairs.begin() + 1);
+    assert(equal(pairs.begin(), pairs.begin() + 2, pairs.begin() + 2));
+
+    using A = array<parity, 3>;
+    const vector<A> arrays{{{parity::zero, parity::zero, parity::zero}}, {{parity::one, parity::two, parity::one}}};
+    const A target{{parity::three, parity::zero, parity::three}};
+    assert(find(arrays.begin(), arrays.end(), target) == arrays.begin() + 1);
+    assert(count(arrays.begin(), arrays.end(), target) == 1);
+    assert(arrays[1] == target);
+    assert(search(arrays.begin(), arrays.end(), &target, &target + 1) == arrays.begin() + 1);
+}
+
 template <class T>
 void test_min_max_element(mt19937_64& gen) {
     using Limits = numeric_limits<T>;
@@ -649,6 +875,191 @@ void test_is_sorted_until(mt19937_64& gen) {
     }
 }
 
+template <class T>
+void test_sort(mt19937_64& gen) {
+    using Limits = numeric_limits<T>;
+
+    uniform_int_distribution<conditional_t<sizeof(T) == 1, int, T>> dis(Limits::min(), Limits::max());
+
+    // A few distinct values, to have many equal elements
+    T few_values[5];
+    for (auto& val : few_values) {
+        val = static_cast<T>(dis(gen));
+    }
+    uniform_int_distribution<size_t> few_dis(0, size(few_values) - 1);
+
+    vector<T> input;
+    input.reserve(dataCount);
+
+    for (size_t count = 0; count <= dataCount; count += 1 + count / 8) {
+        input.resize(count);
+
+        for (auto& val : input) {
+            val = static_cast<T>(dis(gen));
+        }
+        test_case_sort(input, less<>{});
+        test_case_sort(input, greater<>{});
+
+        for (auto& val : input) {
+            val = few_values[few_dis(gen)];
+        }
+        test_case_sort(input, less<>{});
+        test_case_sort(input, greater<>{});
+
+        sort(input.begin(), input.end());
+        test_case_sort(input, less<>{});
+        test_case_sort(input, greater<>{});
+    }
+}
+
+template <class T>
+void test_nth_element_and_partial_sort(mt19937_64& gen) {
+    using Limits = numeric_limits<T>;
+
+    uniform_int_distribution<conditional_t<sizeof(T) == 1, int, T>> dis(Limits::min(), Limits::max());
+
+    // A few distinct values, to have many equal elements
+    T few_values[5];
+    for (auto& val : few_values) {
+        val = static_cast<T>(dis(gen));
+    }
+    uniform_int_distribution<size_t> few_dis(0, size(few_values) - 1);
+
+    vector<T> input;
+    input.reserve(dataCount);
+
+    for (size_t count = 0; count <= dataCount; count += 1 + count / 8) {
+        input.resize(count);
+        uniform_int_distribution<size_t> pos_dis(0, count);
+
+        for (auto& val : input) {
+            val = static_cast<T>(dis(gen));
+        }
+        test_case_nth_element(input, pos_dis(gen), less<>{});
+        test_case_nth_element(input, pos_dis(gen), greater<>{});
+        test_case_partial_sort(input, pos_dis(gen), less<>{});
+        test_case_partial_sort(input, pos_dis(gen), greater<>{});
+
+        for (auto& val : input) {
+            val = few_values[few_dis(gen)];
+        }
+        test_case_nth_element(input, pos_dis(gen), less<>{});
+        test_case_nth_element(input, pos_dis(gen), greater<>{});
+        test_case_partial_sort(input, pos_dis(gen), less<>{});
+        test_case_partial_sort(input, pos_dis(gen), greater<>{});
+    }
+}
+
+template <class T>
+void test_heap(mt19937_64& gen) {
+    using Limits = numeric_limits<T>;
+
+    uniform_int_distribution<conditional_t<sizeof(T) == 1, int, T>> dis(Limits::min(), Limits::max());
+
+    // A few distinct values, to have many equal elements
+    T few_values[5];
+    for (auto& val : few_values) {
+        val = static_cast<T>(dis(gen));
+    }
+    uniform_int_distribution<size_t> few_dis(0, size(few_values) - 1);
+
+    vector<T> input;
+    input.reserve(dataCount);
+
+    for (size_t count = 0; count <= dataCount; count += 1 + count / 8) {
+        input.resize(count);
+
+        for (auto& val : input) {
+            val = static_cast<T>(dis(gen));
+        }
+        test_case_heap(input, less<>{});
+        test_case_heap(input, greater<>{});
+        test_case_is_heap_until(input, less<>{});
+        test_case_is_heap_until(input, greater<>{});
+
+        for (auto& val : input) {
+            val = few_values[few_dis(gen)];
+        }
+        test_case_heap(input, less<>{});
+        test_case_heap(input, greater<>{});
+
+        if (count != 0) {
+            // A heap with one element replaced, which may leave it out of order with its parent or its children
+            uniform_int_distribution<size_t> pos_dis(0, count - 1);
+
+            make_heap(input.begin(), input.end(), less<>{});
+            input[pos_dis(gen)] = static_cast<T>(dis(gen));
+            test_case_is_heap_until(input, less<>{});
+
+            make_heap(input.begin(), input.end(), greater<>{});
+            input[pos_dis(gen)] = static_cast<T>(dis(gen));
+            test_case_is_heap_until(input, greater<>{});
+        }
+    }
+}
+
+template <class T>
+void test_binary_search(mt19937_64& gen) {
+    using Limits = numeric_limits<T>;
+    using Wider  = conditional_t<is_signed_v<T>, long long, unsigned long long>;
+
+    uniform_int_distribution<conditional_t<sizeof(T) == 1, int, T>> dis(Limits::min(), Limits::max());
+
+    // A few distinct values, to have many equal elements
+    T few_values[5];
+    for (auto& val : few_values) {
+        val = static_cast<T>(dis(gen));
+    }
+    uniform_int_distribution<size_t> few_dis(0, size(few_values) - 1);
+
+    vector<T> input;
+    input.reserve(dataCount);
+
+    for (size_t count = 0; count <= dataCount; count += 1 + count / 8) {
+        input.resize(count);
+
+        for (auto& val : input) {
+            val = static_cast<T>(dis(gen));
+        }
+        sort(input.begin(), input.end());
+
+        for (size_t attempts = 0; attempts != 8; ++attempts) {
+            test_case_binary_search(input, static_cast<T>(dis(gen)));
+        }
+
+        if (count != 0) {
+            uniform_int_distribution<size_t> pos_dis(0, count - 1);
+            const T existing = input[pos_dis(gen)];
+            test_case_binary_search(input, existing);
+            test_case_binary_search(input, static_cast<Wider>(existing));
+        }
+
+        for (auto& val : input) {
+            val = few_values[few_dis(gen)];
+        }
+        sort(input.begin(), input.end());
+
+        for (const auto& val : few_values) {
+            test_case_binary_search(input, val);
+            test_case_binary_search(input, static_cast<Wider>(val));
+        }
+        test_case_binary_search(input, Limits::min());
+        test_case_binary_search(input, Limits::max());
+
+#if _HAS_CXX23
+        const flat_multiset<T> fs(sorted_equivalent, input);
+        for (const auto& val : few_values) {
+            const auto expected_lower = last_known_good_lower_bound(fs.begin(), fs.end(), val);
+            const auto expected_upper = last_known_good_upper_bound(expected_lower, fs.end(), val);
+            assert(fs.lower_bound(val) == expected_lower);
+            assert(fs.upper_bound(val) == expected_upper);
+            assert(fs.equal_range(val) == make_pair(expected_lower, expected_upper));
+            assert(fs.contains(val) == (expected_lower != expected_upper));
+        }
+#endif // _HAS_CXX23
+    }
+}
+
 #if _HAS_CXX17
 template <class InIt1, class InIt2>
 bool last_known_good_includes(InIt1 first1, InIt1 last1, InIt2 first2, InIt2 last2) {
@@ -714,6 +1125,174 @@ void test_includes(mt19937_64& gen) {
 }
 #endif // _HAS_CXX17
 
+template <class InIt1, class InIt2, class OutIt>
+OutIt last_known_good_merge(InIt1 first1, InIt1 last1, InIt2 first2, InIt2 last2, OutIt dest) {
+    for (; first1 != last1 && first2 != last2; ++dest) {
+        if (*first2 < *first1) {
+            *dest = *first2;
+            ++first2;
+        } else {
+            *dest = *first1;
+            ++first1;
+        }
+    }
+
+    dest = copy(first1, last1, dest);
+    return copy(first2, last2, dest);
+}
+
+// Copies the elements of [first1, last1) and [first2, last2) selected by keep_first_only, keep_second_only,
+// and keep_both, for each position of a merge walk; covers the four set operations.
+template <class InIt1, class InIt2, class OutIt>
+OutIt last_known_good_set_operation(InIt1 first1, InIt1 last1, InIt2 first2, InIt2 last2, OutIt dest,
+    const bool keep_first_only, const bool keep_second_only, const bool keep_both) {
+    while (first1 != last1 || first2 != last2) {
+        if (first2 == last2 || (first1 != last1 && *first1 < *first2)) {
+            if (keep_first_only) {
+                *dest = *first1;
+                ++dest;
+            }
+            ++first1;
+        } else if (first1 == last1 || *first2 < *first1) {
+            if (keep_second_only) {
+                *dest = *first2;
+                ++dest;
+            }
+            ++first2;
+        } else {
+            if (keep_both) {
+                *dest = *first1;
+                ++dest;
+            }
+            ++first1;
+            ++first2;
+        }
+    }
+
+    return dest;
+}
+
+template <class T>
+void test_case_set_operations(const vector<T>& input1, const vector<T>& input2) {
+    vector<T> expected;
+    vector<T> actual;
+
+    {
+        expected.resize(input1.size() + input2.size());
+        last_known_good_merge(input1.begin(), input1.end(), input2.begin(), input2.end(), expected.begin());
+        actual.assign(expected.size(), T{});
+        const auto it = merge(input1.begin(), input1.end(), input2.begin(), input2.end(), actual.begin());
+        assert(it == actual.end());
+        assert(expected == actual);
+#if _HAS_CXX20
+        actual.assign(expected.size(), T{});
+        const auto result_r = ranges::merge(input1, input2, actual.begin());
+        assert(result_r.in1 == input1.end());
+        assert(result_r.in2 == input2.end());
+        assert(result_r.out == actual.end());
+        assert(expected == actual);
+#endif // _HAS_CXX20
+    }
+
+    // The output vectors are sized to the exact result, so that writes past the end would be noticed
+    const auto check = [&](const auto std_fn, const bool keep_first_only, const bool keep_second_only,
+                           const bool keep_both) {
+        expected.resize(input1.size() + input2.size());
+        const auto expected_end = last_known_good_set_operation(input1.begin(), input1.end(), input2.begin(),
+            input2.end(), expected.begin(), keep_first_only, keep_second_only, keep_both);
+        expected.erase(expected_end, expected.end());
+
+        actual.assign(expected.size(), T{});
+        const auto it = std_fn(input1.begin(), input1.end(), input2.begin(), input2.end(), actual.begin());
+        assert(it == actual.end());
+        assert(expected == actual);
+    };
+
+    check([](auto... args) { return set_intersection(args...); }, false, false, true);
+    check([](auto... args) { return set_difference(args...); }, true, false, false);
+    check([](auto... args) { return set_union(args...); }, true, true, true);
+    check([](auto... args) { return set_symmetric_difference(args...); }, true, true, false);
+
+#if _HAS_CXX20
+    check(
+        [](auto first1, auto last1, auto first2, auto last2, auto dest) {
+            const auto result = ranges::set_intersection(first1, last1, first2, last2, dest);
+            assert(result.in1 == last1);
+            assert(result.in2 == last2);
+            return result.out;
+        },
+        false, false, true);
+    check(
+        [](auto first1, auto last1, auto first2, auto last2, auto dest) {
+            const auto result = ranges::set_difference(first1, last1, first2, last2, dest);
+            assert(result.in == last1);
+            return result.out;
+        },
+        true, false, false);
+    check(
+        [](auto first1, auto last1, auto first2, auto last2, auto dest) {
+            const auto result = ranges::set_union(first1, last1, first2, last2, dest);
+            assert(result.in1 == last1);
+            assert(result.in2 == last2);
+            return result.out;
+        },
+        true, true, true);
+    check(
+        [](auto first1, auto last1, auto first2, auto last2, auto dest) {
+            const auto result = ranges::set_symmetric_difference(first1, last1, first2, last2, dest);
+            assert(result.in1 == last1);
+            assert(result.in2 == last2);
+            return result.out;
+        },
+        true, true, false);
+#endif // _HAS_CXX20
+}
+
+template <class T>
+void test_set_operations(mt19937_64& gen) {
+    using Limits = numeric_limits<T>;
+
+    uniform_int_distribution<conditional_t<sizeof(T) == 1, int, T>> dis(Limits::min(), Limits::max());
+    uniform_int_distribution<size_t> len_dis(0, dataCount);
+
+    vector<T> input1;
+    vector<T> input2;
+    input1.reserve(dataCount);
+    input2.reserve(dataCount * 20);
+
+    for (size_t attempts = 0; attempts < 100; ++attempts) {
+        // Values from a narrow span give runs of equal elements and many common elements
+        const T base           = static_cast<T>(dis(gen));
+        const size_t span_pick = attempts % 3;
+        const auto gen_val     = [&] {
+            if (span_pick == 0) {
+                return static_cast<T>(dis(gen));
+            }
+
+            const int span = span_pick == 1 ? 4 : 200;
+            return static_cast<T>(base + static_cast<T>(uniform_int_distribution<int>{0, span}(gen)));
+        };
+
+        input1.resize(len_dis(gen));
+        // Sometimes much longer than the other, to cover the lookup path
+        input2.resize(attempts % 5 == 0 ? len_dis(gen) * 20 : len_dis(gen));
+
+        for (auto& val : input1) {
+            val = gen_val();
+        }
+
+        for (auto& val : input2) {
+            val = gen_val();
+        }
+
+        sort(input1.begin(), input1.end());
+        sort(input2.begin(), input2.end());
+
+        test_case_set_operations(input1, input2);
+        test_case_set_operations(input2, input1);
+    }
+}
+
 template <class FwdIt, class T>
 void last_known_good_replace(FwdIt first, FwdIt last, const T old_val, const T new_val) {
     for (; first != last; ++first) {
@@ -1225,6 +1804,26 @@ void test_vector_algorithms(mt19937_64& gen) {
 
     test_adjacent_difference_with_heterogeneous_types();
 
+    test_reduce<char>(gen);
+    test_reduce<signed char>(gen);
+    test_reduce<unsigned char>(gen);
+    test_reduce<short>(gen);
+    test_reduce<unsigned short>(gen);
+    test_reduce<int>(gen);
+    test_reduce<unsigned int>(gen);
+    test_reduce<long long>(gen);
+    test_reduce<unsigned long long>(gen);
+
+    test_scan<char>(gen);
+    test_scan<signed char>(gen);
+    test_scan<unsigned char>(gen);
+    test_scan<short>(gen);
+    test_scan<unsigned short>(gen);
+    test_scan<int>(gen);
+    test_scan<unsigned int>(gen);
+    test_scan<long long>(gen);
+    test_scan<unsigned long long>(gen);
+
     test_adjacent_find<char>(gen);
     test_adjacent_find<signed char>(gen);
     test_adjacent_find<unsigned char>(gen);
@@ -1302,6 +1901,23 @@ void test_vector_algorithms(mt19937_64& gen) {
     test_search<long long>(gen);
     test_search<unsigned long long>(gen);
 
+    test_wide_elements<array<uint8_t, 3>>(gen);
+    test_wide_elements<array<uint16_t, 3>>(gen);
+    test_wide_elements<array<uint32_t, 3>>(gen);
+    test_wide_elements<array<uint32_t, 4>>(gen);
+    test_wide_elements<array<uint64_t, 3>>(gen);
+    test_wide_elements<array<uint64_t, 4>>(gen);
+    test_wide_elements<array<uint16_t, 24>>(gen);
+    test_wide_elements<array<uint64_t, 8>>(gen);
+    test_wide_elements<pair<uint64_t, uint64_t>>(gen);
+#if _HAS_CXX20
+    test_wide_elements<wide<uint8_t, 3>>(gen);
+    test_wide_elements<wide<uint32_t, 4>>(gen);
+    test_wide_elements<wide<uint64_t, 3>>(gen);
+    test_wide_elements<wide<uint64_t, 8>>(gen);
+#endif // _HAS_CXX20
+    test_user_equality_members();
+
     test_min_max_element<char>(gen);
     test_min_max_element<signed char>(gen);
     test_min_max_element<unsigned char>(gen);
@@ -1335,6 +1951,46 @@ void test_vector_algorithms(mt19937_64& gen) {
     test_is_sorted_until<long long>(gen);
     test_is_sorted_until<unsigned long long>(gen);
 
+    test_sort<char>(gen);
+    test_sort<signed char>(gen);
+    test_sort<unsigned char>(gen);
+    test_sort<short>(gen);
+    test_sort<unsigned short>(gen);
+    test_sort<int>(gen);
+    test_sort<unsigned int>(gen);
+    test_sort<long long>(gen);
+    test_sort<unsigned long long>(gen);
+
+    test_nth_element_and_partial_sort<char>(gen);
+    test_nth_element_and_partial_sort<signed char>(gen);
+    test_nth_element_and_partial_sort<unsigned char>(gen);
+    test_nth_element_and_partial_sort<short>(gen);
+    test_nth_element_and_partial_sort<unsigned short>(gen);
+    test_nth_element_and_partial_sort<int>(gen);
+    test_nth_element_and_partial_sort<unsigned int>(gen);
+    test_nth_element_and_partial_sort<long long>(gen);
+    test_nth_element_and_partial_sort<unsigned long long>(gen);
+
+    test_heap<char>(gen);
+    test_heap<signed char>(gen);
+    test_heap<unsigned char>(gen);
+    test_heap<short>(gen);
+    test_heap<unsigned short>(gen);
+    test_heap<int>(gen);
+    test_heap<unsigned int>(gen);
+    test_heap<long long>(gen);
+    test_heap<unsigned long long>(gen);
+
+    test_binary_search<char>(gen);
+    test_binary_search<signed char>(gen);
+    test_binary_search<unsigned char>(gen);
+    test_binary_search<short>(gen);
+    test_binary_search<unsigned short>(gen);
+    test_binary_search<int>(gen);
+    test_binary_search<unsigned int>(gen);
+    test_binary_search<long long>(gen);
+    test_binary_search<unsigned long long>(gen);
+
     // std::includes has been there forever, but we use std::sample in the test, and that one is C++17
 #if _HAS_CXX17
     test_includes<char>(gen);
@@ -1348,6 +2004,16 @@ void test_vector_algorithms(mt19937_64& gen) {
     test_includes<unsigned long long>(gen);
 #endif // _HAS_CXX17
 
+    test_set_operations<char>(gen);
+    test_set_operations<signed char>(gen);
+    test_set_operations<unsigned char>(gen);
+    test_set_operations<short>(gen);
+    test_set_operations<unsigned short>(gen);
+    test_set_operations<int>(gen);
+    test_set_operations<unsigned int>(gen);
+    test_set_operations<long long>(gen);
+    test_set_operations<unsigned long long>(gen);
+
     test_replace<char>(gen);
     test_replace<signed char>(gen);
     test_replace<unsigned char>(gen);
@@ -1983,6 +2649,23 @@ constexpr bool test_constexpr() {
     ranges::reverse(c);
     assert(equal(begin(a), end(a), begin(c), end(c)));
 
+    sort(begin(c), end(c));
+    assert(is_sorted(begin(c), end(c)));
+    ranges::sort(c, greater<>{});
+    assert(ranges::is_sorted(c, greater<>{}));
+
+    nth_element(begin(b), begin(b) + 4, end(b));
+    assert(b[4] == 30);
+    ranges::partial_sort(b, begin(b) + 3, greater<>{});
+    assert(b[0] == 60 && b[1] == 50 && b[2] == 40);
+
+    ranges::sort(c);
+    assert(lower_bound(begin(c), end(c), 30) == begin(c) + 2);
+    assert(upper_bound(begin(c), end(c), 30) == begin(c) + 6);
+    assert(ranges::equal_range(c, 30).size() == 4);
+    assert(ranges::binary_search(c, 50));
+    assert(!binary_search(begin(c), end(c), 35));
+
     return true;
 }
 
@@ -2005,6 +2688,51 @@ int main() {
         test_replace<unsigned int>(gen);
         test_replace<long long>(gen);
         test_replace<unsigned long long>(gen);
+
+        test_sort<signed char>(gen);
+        test_sort<unsigned char>(gen);
+        test_sort<short>(gen);
+        test_sort<unsigned short>(gen);
+        test_sort<int>(gen);
+        test_sort<unsigned int>(gen);
+        test_sort<long long>(gen);
+        test_sort<unsigned long long>(gen);
+
+        test_nth_element_and_partial_sort<signed char>(gen);
+        test_nth_element_and_partial_sort<unsigned char>(gen);
+        test_nth_element_and_partial_sort<short>(gen);
+        test_nth_element_and_partial_sort<unsigned short>(gen);
+        test_nth_element_and_partial_sort<int>(gen);
+        test_nth_element_and_partial_sort<unsigned int>(gen);
+        test_nth_element_and_partial_sort<long long>(gen);
+        test_nth_element_and_partial_sort<unsigned long long>(gen);
+
+        test_heap<signed char>(gen);
+        test_heap<unsigned char>(gen);
+        test_heap<short>(gen);
+        test_heap<unsigned short>(gen);
+        test_heap<int>(gen);
+        test_heap<unsigned int>(gen);
+        test_heap<long long>(gen);
+        test_heap<unsigned long long>(gen);
+
+        test_binary_search<signed char>(gen);
+        test_binary_search<unsigned char>(gen);
+        test_binary_search<short>(gen);
+        test_binary_search<unsigned short>(gen);
+        test_binary_search<int>(gen);
+        test_binary_search<unsigned int>(gen);
+        test_binary_search<long long>(gen);
+        test_binary_search<unsigned long long>(gen);
+
+        test_set_operations<signed char>(gen);
+        test_set_operations<unsigned char>(gen);
+        test_set_operations<short>(gen);
+        test_set_operations<unsigned short>(gen);
+        test_set_operations<int>(gen);
+        test_set_operations<unsigned int>(gen);
+        test_set_operations<long long>(gen);
+        test_set_operations<unsigned long long>(gen);
 #else // ^^^ defined(_CALL_ALL_X64_VECTOR_ALGORITHMS_ON_ARM64EC) / normal test coverage vvv
         test_vector_algorithms(gen);
         test_various_containers();
@@ -2,14 +2,20 @@
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 
 #include <algorithm>
+#include <cassert>
+#include <cmath>
 #include <cstddef>
 #include <functional>
 #include <limits>
+#include <numeric>
 #include <random>
 #include <vector>
 
+#include <test_binary_search_support.hpp>
+#include <test_heap_support.hpp>
 #include <test_is_sorted_until_support.hpp>
 #include <test_min_max_element_support.hpp>
+#include <test_sort_support.hpp>
 #include <test_vector_algorithms_support.hpp>
 
 using namespace std;
@@ -124,12 +130,231 @@ void test_is_sorted_until_floating_with_values(mt19937_64& gen, const vector<T>&
     }
 }
 
+template <class T>
+void test_sort_floating_with_values(mt19937_64& gen, const vector<T>& input_of_input) {
+    uniform_int_distribution<size_t> idx_dis(0, input_of_input.size() - 1);
+
+    vector<T> input;
+    input.reserve(dataCount);
+
+    for (size_t count = 0; count <= dataCount; count += 1 + count / 8) {
+        input.resize(count);
+        for (auto& val : input) {
+            val = input_of_input[idx_dis(gen)];
+        }
+
+        test_case_sort(input, less<>{});
+        test_case_sort(input, greater<>{});
+
+        uniform_int_distribution<size_t> pos_dis(0, count);
+        test_case_nth_element(input, pos_dis(gen), less<>{});
+        test_case_nth_element(input, pos_dis(gen), greater<>{});
+        test_case_partial_sort(input, pos_dis(gen), less<>{});
+        test_case_partial_sort(input, pos_dis(gen), greater<>{});
+    }
+}
+
+template <class T>
+void test_heap_floating_with_values(mt19937_64& gen, const vector<T>& input_of_input) {
+    uniform_int_distribution<size_t> idx_dis(0, input_of_input.size() - 1);
+
+    vector<T> input;
+    input.reserve(dataCount);
+
+    for (size_t count = 0; count <= dataCount; count += 1 + count / 8) {
+        input.resize(count);
+        for (auto& val : input) {
+            val = input_of_input[idx_dis(gen)];
+        }
+
+        test_case_heap(input, less<>{});
+        test_case_heap(input, greater<>{});
+        test_case_is_heap_until(input, less<>{});
+        test_case_is_heap_until(input, greater<>{});
+
+        if (count != 0) {
+            uniform_int_distribution<size_t> pos_dis(0, count - 1);
+
+            make_heap(input.begin(), input.end(), less<>{});
+            input[pos_dis(gen)] = input_of_input[idx_dis(gen)];
+            test_case_is_heap_until(input, less<>{});
+
+            make_heap(input.begin(), input.end(), greater<>{});
+            input[pos_dis(gen)] = input_of_input[idx_dis(gen)];
+            test_case_is_heap_until(input, greater<>{});
+        }
+    }
+}
+
+template <class T>
+void test_binary_search_floating_with_values(mt19937_64& gen, const vector<T>& input_of_input) {
+    uniform_int_distribution<size_t> idx_dis(0, input_of_input.size() - 1);
+
+    vector<T> input;
+    input.reserve(dataCount);
+
+    for (size_t count = 0; count <= dataCount; count += 1 + count / 8) {
+        input.resize(count);
+        for (auto& val : input) {
+            val = input_of_input[idx_dis(gen)];
+        }
+        sort(input.begin(), input.end());
+
+        for (size_t attempts = 0; attempts != 8; ++attempts) {
+            test_case_binary_search(input, input_of_input[idx_dis(gen)]);
+        }
+        test_case_binary_search(input, static_cast<T>(-0.0));
+        test_case_binary_search(input, static_cast<T>(+0.0));
+        test_case_binary_search(input, static_cast<T>(0.5));
+    }
+}
+
+#if _HAS_CXX17
+template <class T>
+void test_reduce_floating(mt19937_64& gen) {
+    // Small integers keep every partial sum exact, so the result doesn't depend on the order of additions.
+    uniform_int_distribution<int> dis(-30, 30);
+    normal_distribution<T> normal_dis(0, 100000.0);
+
+    vector<T> input1;
+    vector<T> input2;
+    vector<T> input_of_normal;
+    input1.reserve(dataCount);
+    input2.reserve(dataCount);
+    input_of_normal.reserve(dataCount);
+
+    for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+        input1.push_back(static_cast<T>(dis(gen)));
+        input2.push_back(static_cast<T>(dis(gen)));
+        input_of_normal.push_back(normal_dis(gen));
+
+        const T init          = static_cast<T>(dis(gen));
+        T expected_sum        = init;
+        T expected_dot        = init;
+        T expected_accumulate = init;
+        for (size_t i = 0; i != input1.size(); ++i) {
+            expected_sum += input1[i];
+            expected_dot += input1[i] * input2[i];
+            expected_accumulate += input_of_normal[i];
+        }
+
+        assert(reduce(input1.begin(), input1.end(), init) == expected_sum);
+        assert(transform_reduce(input1.begin(), input1.end(), input2.begin(), init) == expected_dot);
+
+#ifndef _M_FP_FAST
+        // accumulate() is a left fold, so it must not be reassociated.
+        assert(accumulate(input_of_normal.begin(), input_of_normal.end(), init) == expected_accumulate);
+#endif // !defined(_M_FP_FAST)
+    }
+
+#ifndef _M_FP_FAST
+    // -0.0 is the additive identity, so a sum of -0.0 values must stay -0.0.
+    for (size_t count = 0; count != 100; ++count) {
+        const vector<T> zeros(count, static_cast<T>(-0.0));
+        const T sum = reduce(zeros.begin(), zeros.end(), static_cast<T>(-0.0));
+        assert(sum == 0 && signbit(sum));
+    }
+#endif // !defined(_M_FP_FAST)
+}
+#endif // _HAS_CXX17
+
+template <class T>
+void test_scan_floating(mt19937_64& gen) {
+    // Small integers keep every partial sum exact, so the results don't depend on the order of additions.
+    uniform_int_distribution<int> dis(-30, 30);
+
+    vector<T> input;
+    vector<T> output;
+    input.reserve(dataCount);
+    output.reserve(dataCount);
+
+    for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+        input.push_back(static_cast<T>(dis(gen)));
+        output.resize(input.size());
+
+        const T init = static_cast<T>(dis(gen));
+        vector<T> expected_partial(input.size());
+        vector<T> expected_inclusive(input.size());
+        vector<T> expected_exclusive(input.size());
+        vector<T> expected_difference(input.size());
+        T partial = 0;
+        T sum     = init;
+        for (size_t i = 0; i != input.size(); ++i) {
+            expected_exclusive[i] = sum;
+
+            partial += input[i];
+            sum += input[i];
+
+            expected_partial[i]    = partial;
+            expected_inclusive[i]  = sum;
+            expected_difference[i] = i == 0 ? input[0] : input[i] - input[i - 1];
+        }
+
+        assert(partial_sum(input.begin(), input.end(), output.begin()) == output.end());
+        assert(output == expected_partial);
+
+        assert(adjacent_difference(input.begin(), input.end(), output.begin()) == output.end());
+        assert(output == expected_difference);
+
+        // also test where dest == first
+        output = input;
+        adjacent_difference(output.begin(), output.end(), output.begin());
+        assert(output == expected_difference);
+
+#if _HAS_CXX17
+        assert(inclusive_scan(input.begin(), input.end(), output.begin()) == output.end());
+        assert(output == expected_partial);
+
+        assert(inclusive_scan(input.begin(), input.end(), output.begin(), plus<>{}, init) == output.end());
+        assert(output == expected_inclusive);
+
+        assert(exclusive_scan(input.begin(), input.end(), output.begin(), init) == output.end());
+        assert(output == expected_exclusive);
+
+        output = input;
+        exclusive_scan(output.begin(), output.end(), output.begin(), init);
+        assert(output == expected_exclusive);
+#endif // _HAS_CXX17
+    }
+
+#if _HAS_CXX17 && !defined(_M_FP_FAST)
+    // -0.0 is the additive identity, so scans of -0.0 values must produce -0.0 everywhere.
+    for (size_t count = 0; count != 100; ++count) {
+        const vector<T> zeros(count, static_cast<T>(-0.0));
+        const auto is_negative_zero = [](const T val) { return val == 0 && signbit(val); };
+
+        inclusive_scan(zeros.begin(), zeros.end(), output.begin());
+        assert(all_of(output.begin(), output.begin() + static_cast<ptrdiff_t>(count), is_negative_zero));
+
+        exclusive_scan(zeros.begin(), zeros.end(), output.begin(), static_cast<T>(-0.0));
+        assert(all_of(output.begin(), output.begin() + static_cast<ptrdiff_t>(count), is_negative_zero));
+    }
+#endif // _HAS_CXX17 && !defined(_M_FP_FAST)
+}
+
 void test_vector_algorithms(mt19937_64& gen) {
     test_min_max_element_floating<float>(gen);
     test_min_max_element_floating<double>(gen);
 
     test_is_sorted_until_floating_with_values(gen, test_floating_input<float>(gen));
     test_is_sorted_until_floating_with_values(gen, test_floating_input<double>(gen));
+
+    test_sort_floating_with_values(gen, test_floating_input<float>(gen));
+    test_sort_floating_with_values(gen, test_floating_input<double>(gen));
+
+    test_heap_floating_with_values(gen, test_floating_input<float>(gen));
+    test_heap_floating_with_values(gen, test_floating_input<double>(gen));
+
+    test_binary_search_floating_with_values(gen, test_floating_input<float>(gen));
+    test_binary_search_floating_with_values(gen, test_floating_input<double>(gen));
+
+#if _HAS_CXX17
+    test_reduce_floating<float>(gen);
+    test_reduce_floating<double>(gen);
+#endif // _HAS_CXX17
+
+    test_scan_floating<float>(gen);
+    test_scan_floating<double>(gen);
 }
 
 int main() {